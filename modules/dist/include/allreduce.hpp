@@ -0,0 +1,68 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <type_traits>
+
+#include "dist/include/distribute.hpp"
+
+namespace ppc::dist {
+
+/// @brief Algorithm used by ppc::dist::Allreduce().
+enum class AllreduceAlgorithm : std::uint8_t {
+  /// Chosen per call by SelectAllreduceAlgorithm()
+  kAuto,
+  /// log(p) exchanges of the whole vector; fewest messages, for short vectors
+  kRecursiveDoubling,
+  /// Reduce-scatter and allgather around a ring: 2(p - 1) messages of n / p elements between neighbours
+  kRing,
+  /// Reduce-scatter by recursive halving and allgather by recursive doubling: 2 log(p) messages, n / p traffic
+  kRabenseifner,
+};
+
+/// @brief Returns the name of an algorithm, e.g. "ring".
+std::string GetAllreduceAlgorithmName(AllreduceAlgorithm algorithm);
+
+/// @brief Picks the allreduce algorithm for a vector of `bytes` split into `count` elements on `num_ranks` ranks.
+/// @details Short vectors and vectors with fewer elements than ranks use recursive doubling, whose cost is
+/// dominated by latency. Longer ones use Rabenseifner on a power-of-two number of ranks. Otherwise Rabenseifner
+/// first folds the extra ranks into the others with one more exchange of the whole vector, so from 1 MiB on the
+/// ring, which sends every rank only 2(p - 1) / p of the vector for any p, is cheaper.
+AllreduceAlgorithm SelectAllreduceAlgorithm(std::size_t bytes, std::size_t count, int num_ranks);
+
+namespace detail {
+
+// Combines `count` elements: inout[i] = op(inout[i], in[i])
+using CombineFn = std::function<void(const void *in, void *inout, std::size_t count)>;
+
+void Allreduce(void *data, std::size_t count, MPI_Datatype type, std::size_t element_size, const CombineFn &combine,
+               MPI_Comm comm, AllreduceAlgorithm algorithm);
+
+}  // namespace detail
+
+/// @brief Reduces `data` element-wise over all ranks of `comm` and leaves the result in `data` on every rank.
+/// @details Unlike MPI_Allreduce, the reduction runs in user code, so any associative and commutative `op` works
+/// on any trivially copyable T. Every element is combined in the same order on all ranks, so all of them get
+/// bit-identical results. Collective over `comm`; all ranks pass vectors of the same length and the same
+/// algorithm.
+/// @param data Contribution of the calling rank; overwritten with the result.
+/// @param op Binary operation on two elements, e.g. std::plus<>{}.
+template <typename T, typename Op = std::plus<>>
+void Allreduce(std::span<std::type_identity_t<T>> data, Op op = {}, MPI_Comm comm = MPI_COMM_WORLD,
+               AllreduceAlgorithm algorithm = AllreduceAlgorithm::kAuto) {
+  const detail::CombineFn combine = [&op](const void *in, void *inout, std::size_t count) {
+    const auto *src = static_cast<const T *>(in);
+    auto *dst = static_cast<T *>(inout);
+    for (std::size_t i = 0; i < count; i++) {
+      dst[i] = op(dst[i], src[i]);
+    }
+  };
+  detail::Allreduce(data.data(), data.size(), GetMpiType<T>(), sizeof(T), combine, comm, algorithm);
+}
+
+}  // namespace ppc::dist
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+namespace ppc::dist {
+
+/// @brief Contiguous range [begin, begin + count) of a block distribution.
+struct BlockRange {
+  /// First index of the block
+  std::size_t begin = 0;
+  /// Number of indices in the block
+  std::size_t count = 0;
+};
+
+/// @brief Returns the block of `part` when `total` indices are split over `num_parts` parts.
+/// @details The first `total % num_parts` parts get one extra index, the same layout the usual
+/// counts/displacements loop in front of MPI_Scatterv produces.
+inline BlockRange GetBlockRange(std::size_t total, int num_parts, int part) {
+  const auto parts = static_cast<std::size_t>(num_parts);
+  const auto index = static_cast<std::size_t>(part);
+  const std::size_t base = total / parts;
+  const std::size_t remainder = total % parts;
+  return {.begin = (index * base) + std::min(index, remainder), .count = base + (index < remainder ? 1 : 0)};
+}
+
+}  // namespace ppc::dist
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "dist/include/partition.hpp"
+
+namespace ppc::dist {
+
+/// @brief Returns the MPI datatype of T.
+/// @details Arithmetic types map to their predefined datatypes; any other trivially copyable type to a
+/// contiguous run of bytes of its size, committed on first use.
+template <typename T>
+MPI_Datatype GetMpiType() {
+  static_assert(std::is_trivially_copyable_v<T>, "Elements sent through MPI must be trivially copyable");
+  using U = std::remove_cv_t<T>;
+  if constexpr (std::is_same_v<U, char>) {
+    return MPI_CHAR;
+  } else if constexpr (std::is_same_v<U, signed char>) {
+    return MPI_SIGNED_CHAR;
+  } else if constexpr (std::is_same_v<U, unsigned char>) {
+    return MPI_UNSIGNED_CHAR;
+  } else if constexpr (std::is_same_v<U, bool>) {
+    return MPI_CXX_BOOL;
+  } else if constexpr (std::is_same_v<U, float>) {
+    return MPI_FLOAT;
+  } else if constexpr (std::is_same_v<U, double>) {
+    return MPI_DOUBLE;
+  } else if constexpr (std::is_same_v<U, long double>) {
+    return MPI_LONG_DOUBLE;
+  } else if constexpr (std::is_same_v<U, std::complex<double>>) {
+    return MPI_CXX_DOUBLE_COMPLEX;
+  } else if constexpr (std::is_integral_v<U> && std::is_signed_v<U> && sizeof(U) == sizeof(std::int16_t)) {
+    return MPI_INT16_T;
+  } else if constexpr (std::is_integral_v<U> && std::is_signed_v<U> && sizeof(U) == sizeof(std::int32_t)) {
+    return MPI_INT32_T;
+  } else if constexpr (std::is_integral_v<U> && std::is_signed_v<U> && sizeof(U) == sizeof(std::int64_t)) {
+    return MPI_INT64_T;
+  } else if constexpr (std::is_integral_v<U> && sizeof(U) == sizeof(std::uint16_t)) {
+    return MPI_UINT16_T;
+  } else if constexpr (std::is_integral_v<U> && sizeof(U) == sizeof(std::uint32_t)) {
+    return MPI_UINT32_T;
+  } else if constexpr (std::is_integral_v<U> && sizeof(U) == sizeof(std::uint64_t)) {
+    return MPI_UINT64_T;
+  } else {
+    static const MPI_Datatype kBytes = [] {
+      MPI_Datatype type = MPI_DATATYPE_NULL;
+      MPI_Type_contiguous(static_cast<int>(sizeof(U)), MPI_BYTE, &type);
+      MPI_Type_commit(&type);
+      return type;
+    }();
+    return kBytes;
+  }
+}
+
+// The element type of the helpers below is not deduced, so that vectors convert to spans: Scatter<int>(...)
+
+namespace detail {
+
+// Checks that a rank's buffer matches its part, so that a wrong size fails loudly instead of inside MPI
+inline void CheckLocalSize(const Partition &partition, std::size_t size, MPI_Comm comm, const char *operation) {
+  int rank = 0;
+  int num_ranks = 0;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &num_ranks);
+  if (partition.GetNumParts() != num_ranks) {
+    throw std::invalid_argument(std::string(operation) + ": partition has " +
+                                std::to_string(partition.GetNumParts()) + " parts for " + std::to_string(num_ranks) +
+                                " ranks");
+  }
+  if (size != static_cast<std::size_t>(partition.GetCount(rank))) {
+    throw std::invalid_argument(std::string(operation) + ": local buffer of rank " + std::to_string(rank) +
+                                " holds " + std::to_string(size) + " elements, its part " +
+                                std::to_string(partition.GetCount(rank)));
+  }
+}
+
+void ExchangeHalos(const HaloPartition &partition, void *local, MPI_Datatype type, std::size_t element_size,
+                   MPI_Comm comm);
+
+}  // namespace detail
+
+/// @brief Sends every rank its part of `global`; collective over `comm`.
+/// @param global Whole array, read on `root` only.
+/// @param local Receives the part of the calling rank; must hold exactly its count.
+template <typename T>
+void Scatter(const Partition &partition, std::span<const std::type_identity_t<T>> global,
+             std::span<std::type_identity_t<T>> local, int root = 0, MPI_Comm comm = MPI_COMM_WORLD) {
+  detail::CheckLocalSize(partition, local.size(), comm, "Scatter");
+  MPI_Scatterv(global.data(), partition.GetCounts().data(), partition.GetDispls().data(), GetMpiType<T>(),
+               local.data(), static_cast<int>(local.size()), GetMpiType<T>(), root, comm);
+}
+
+/// @brief Returns the part of `global` that belongs to the calling rank; collective over `comm`.
+/// @param global Whole array, read on `root` only.
+template <typename T>
+std::vector<T> Scatter(const Partition &partition, std::span<const std::type_identity_t<T>> global, int root = 0,
+                       MPI_Comm comm = MPI_COMM_WORLD) {
+  int rank = 0;
+  MPI_Comm_rank(comm, &rank);
+  std::vector<T> local(static_cast<std::size_t>(partition.GetCount(rank)));
+  Scatter<T>(partition, global, local, root, comm);
+  return local;
+}
+
+/// @brief Collects the parts of all ranks into `global` on `root`; collective over `comm`.
+/// @param local Part of the calling rank.
+/// @param global Whole array, written on `root` only; must hold GetTotal() elements there.
+template <typename T>
+void Gather(const Partition &partition, std::span<const std::type_identity_t<T>> local,
+            std::span<std::type_identity_t<T>> global, int root = 0, MPI_Comm comm = MPI_COMM_WORLD) {
+  detail::CheckLocalSize(partition, local.size(), comm, "Gather");
+  MPI_Gatherv(local.data(), static_cast<int>(local.size()), GetMpiType<T>(), global.data(),
+              partition.GetCounts().data(), partition.GetDispls().data(), GetMpiType<T>(), root, comm);
+}
+
+/// @brief Collects the parts of all ranks into `global` on every rank; collective over `comm`.
+/// @param global Whole array; must hold GetTotal() elements.
+template <typename T>
+void Allgather(const Partition &partition, std::span<const std::type_identity_t<T>> local,
+               std::span<std::type_identity_t<T>> global, MPI_Comm comm = MPI_COMM_WORLD) {
+  detail::CheckLocalSize(partition, local.size(), comm, "Allgather");
+  MPI_Allgatherv(local.data(), static_cast<int>(local.size()), GetMpiType<T>(), global.data(),
+                 partition.GetCounts().data(), partition.GetDispls().data(), GetMpiType<T>(), comm);
+}
+
+/// @brief Refreshes the halos of the calling rank from the blocks of the ranks that own them; collective over
+/// `comm`.
+/// @details Only ranks whose blocks overlap a halo exchange messages, usually the two neighbours.
+/// @param local Buffer of the calling rank laid out as partition.GetExtended(); its block is sent, its halos are
+/// overwritten.
+template <typename T>
+void ExchangeHalos(const HaloPartition &partition, std::span<std::type_identity_t<T>> local,
+                   MPI_Comm comm = MPI_COMM_WORLD) {
+  detail::CheckLocalSize(partition.GetExtended(), local.size(), comm, "ExchangeHalos");
+  detail::ExchangeHalos(partition, local.data(), GetMpiType<T>(), sizeof(T), comm);
+}
+
+}  // namespace ppc::dist
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "dist/include/distribute.hpp"
+#include "dist/include/partition.hpp"
+
+namespace ppc::dist {
+
+/// @brief Ranks of a communicator grouped by the node (shared-memory domain) they run on.
+/// @details Splits a duplicate of the communicator with MPI_Comm_split_type(MPI_COMM_TYPE_SHARED) into one
+/// communicator per node and a communicator of the node leaders (node rank 0). Collectives built on it move
+/// data between nodes once per node and share it inside a node through MPI-3 shared windows, instead of copying
+/// it to every rank. Node ranks follow the rank order of the communicator.
+class NodeTopology {
+ public:
+  /// @brief Groups the ranks of `comm` by node; collective over `comm`.
+  explicit NodeTopology(MPI_Comm comm);
+
+  /// @brief Groups the ranks of `comm` by `node_id` instead of by host; collective over `comm`.
+  /// @details Ranks passing the same id must share memory. Lets tests emulate several nodes on one host.
+  NodeTopology(MPI_Comm comm, int node_id);
+
+  /// @brief Frees the communicators, unless MPI has already been finalized.
+  ~NodeTopology();
+
+  NodeTopology(const NodeTopology &) = delete;
+  NodeTopology &operator=(const NodeTopology &) = delete;
+  NodeTopology(NodeTopology &&) = delete;
+  NodeTopology &operator=(NodeTopology &&) = delete;
+
+  /// @brief Returns the topology of MPI_COMM_WORLD, created by the first call; that call is collective.
+  static const NodeTopology &World();
+
+  /// @brief Returns the duplicate of the split communicator, used for the messages between nodes.
+  [[nodiscard]] MPI_Comm GetComm() const {
+    return comm_;
+  }
+
+  /// @brief Returns the communicator of the ranks on this node.
+  [[nodiscard]] MPI_Comm GetNodeComm() const {
+    return node_comm_;
+  }
+
+  /// @brief Returns the communicator of the node leaders; MPI_COMM_NULL on other ranks.
+  /// @details The rank of a leader in it is the index of its node.
+  [[nodiscard]] MPI_Comm GetLeaderComm() const {
+    return leader_comm_;
+  }
+
+  /// @brief Returns the rank of the calling process in GetComm().
+  [[nodiscard]] int GetRank() const {
+    return rank_;
+  }
+
+  /// @brief Returns the number of ranks of GetComm().
+  [[nodiscard]] int GetSize() const {
+    return static_cast<int>(node_of_rank_.size());
+  }
+
+  /// @brief Returns true if the calling process is the leader of its node.
+  [[nodiscard]] bool IsLeader() const {
+    return leader_comm_ != MPI_COMM_NULL;
+  }
+
+  /// @brief Returns the number of nodes.
+  [[nodiscard]] int GetNumNodes() const {
+    return static_cast<int>(node_members_.size());
+  }
+
+  /// @brief Returns the node of a rank of GetComm().
+  [[nodiscard]] int GetNodeOf(int rank) const {
+    return node_of_rank_[static_cast<std::size_t>(rank)];
+  }
+
+  /// @brief Returns the ranks of GetComm() on `node`, in node-rank order; the first one is the leader.
+  [[nodiscard]] const std::vector<int> &GetNodeMembers(int node) const {
+    return node_members_[static_cast<std::size_t>(node)];
+  }
+
+ private:
+  void Split(MPI_Comm node_comm);
+
+  MPI_Comm comm_ = MPI_COMM_NULL;
+  MPI_Comm node_comm_ = MPI_COMM_NULL;
+  MPI_Comm leader_comm_ = MPI_COMM_NULL;
+  int rank_ = 0;
+  std::vector<int> node_of_rank_;
+  std::vector<std::vector<int>> node_members_;
+};
+
+/// @brief Memory allocated once per node with MPI_Win_allocate_shared and mapped by every rank of the node.
+/// @details Construction and destruction are collective over the node communicator.
+class SharedWindow {
+ public:
+  SharedWindow() = default;
+
+  /// @brief Allocates `bytes` on the node leader and maps them on the other ranks of the node.
+  SharedWindow(const NodeTopology &topology, std::size_t bytes);
+
+  ~SharedWindow();
+
+  SharedWindow(const SharedWindow &) = delete;
+  SharedWindow &operator=(const SharedWindow &) = delete;
+  SharedWindow(SharedWindow &&other) noexcept;
+  SharedWindow &operator=(SharedWindow &&other) noexcept;
+
+  /// @brief Returns the start of the segment, the same memory on every rank of the node.
+  [[nodiscard]] std::byte *GetData() const {
+    return data_;
+  }
+
+  /// @brief Returns the size of the segment in bytes.
+  [[nodiscard]] std::size_t GetSize() const {
+    return size_;
+  }
+
+  /// @brief Makes writes of every rank of the node visible to all of them; collective over the node.
+  void Synchronize() const;
+
+ private:
+  void Free();
+
+  MPI_Win win_ = MPI_WIN_NULL;
+  MPI_Comm node_comm_ = MPI_COMM_NULL;
+  std::byte *data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+template <typename T>
+/// @brief Read-only view of data that the ranks of a node share in one SharedWindow.
+/// @details Keep it alive while the view is used. Destroying it is collective over the node.
+/// @tparam T Element type.
+class SharedArray {
+ public:
+  SharedArray() = default;
+
+  SharedArray(SharedWindow window, std::size_t offset, std::size_t count)
+      : window_(std::move(window)), offset_(offset), count_(count) {}
+
+  /// @brief Returns the elements of the calling rank.
+  [[nodiscard]] std::span<const T> Get() const {
+    if (count_ == 0) {
+      return {};
+    }
+    return {reinterpret_cast<const T *>(window_.GetData()) + offset_, count_};
+  }
+
+ private:
+  SharedWindow window_;
+  std::size_t offset_ = 0;
+  std::size_t count_ = 0;
+};
+
+namespace detail {
+
+// Broadcasts the segment of the root's node to the segments of the other nodes; called by leaders only
+void BcastBetweenNodes(const NodeTopology &topology, SharedWindow &window, int root);
+
+// Sends every node the blocks of its ranks, one message per node, into its segment packed in node-rank order
+void ScatterBetweenNodes(const NodeTopology &topology, const Partition &partition, const void *global,
+                         MPI_Datatype type, std::size_t element_size, SharedWindow &window, int root);
+
+// Returns the offset of the block of `rank` in the segment of its node, in elements
+std::size_t GetNodeOffset(const NodeTopology &topology, const Partition &partition, int rank);
+
+}  // namespace detail
+
+/// @brief Broadcasts `data` from `root` so that every rank can read it, but stores it only once per node.
+/// @details The root copies the data into the shared segment of its node, the node leaders forward it to the
+/// segments of the other nodes, and every rank reads it in place. Collective over the communicator of
+/// `topology`.
+/// @param data Elements to broadcast, read on `root` only.
+/// @return View of all elements on every rank.
+template <typename T>
+SharedArray<T> BcastShared(std::span<const std::type_identity_t<T>> data, int root = 0,
+                           const NodeTopology &topology = NodeTopology::World()) {
+  static_assert(std::is_trivially_copyable_v<T>, "Shared elements must be trivially copyable");
+  std::uint64_t count = data.size();
+  MPI_Bcast(&count, 1, MPI_UINT64_T, root, topology.GetComm());
+
+  SharedWindow window(topology, static_cast<std::size_t>(count) * sizeof(T));
+  if (topology.GetRank() == root) {
+    std::ranges::copy(data, reinterpret_cast<T *>(window.GetData()));
+  }
+  window.Synchronize();
+  if (topology.GetNumNodes() > 1) {
+    if (topology.IsLeader()) {
+      detail::BcastBetweenNodes(topology, window, root);
+    }
+    window.Synchronize();
+  }
+  return {std::move(window), 0, static_cast<std::size_t>(count)};
+}
+
+/// @brief Scatters `global` from `root` by node: every node receives the blocks of its ranks in one message
+/// and the ranks read their blocks from the shared segment of the node.
+/// @details Compared with Scatter(), the root sends one message per remote node instead of one per rank and
+/// copies the blocks of its own node directly. Collective over the communicator of `topology`, whose size must
+/// equal the number of parts.
+/// @param global Whole array, read on `root` only.
+/// @return View of the block of the calling rank.
+template <typename T>
+SharedArray<T> ScatterShared(const Partition &partition, std::span<const std::type_identity_t<T>> global,
+                             int root = 0, const NodeTopology &topology = NodeTopology::World()) {
+  static_assert(std::is_trivially_copyable_v<T>, "Shared elements must be trivially copyable");
+  if (partition.GetNumParts() != topology.GetSize()) {
+    throw std::invalid_argument("ScatterShared: partition has " + std::to_string(partition.GetNumParts()) +
+                                " parts for " + std::to_string(topology.GetSize()) + " ranks");
+  }
+  const int rank = topology.GetRank();
+  const auto &members = topology.GetNodeMembers(topology.GetNodeOf(rank));
+  std::size_t node_count = 0;
+  for (const int member : members) {
+    node_count += static_cast<std::size_t>(partition.GetCount(member));
+  }
+
+  SharedWindow window(topology, node_count * sizeof(T));
+  detail::ScatterBetweenNodes(topology, partition, global.data(), GetMpiType<T>(), sizeof(T), window, root);
+  window.Synchronize();
+  return {std::move(window), detail::GetNodeOffset(topology, partition, rank),
+          static_cast<std::size_t>(partition.GetCount(rank))};
+}
+
+}  // namespace ppc::dist
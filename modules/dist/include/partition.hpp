@@ -0,0 +1,237 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "dist/include/block_range.hpp"
+
+namespace ppc::dist {
+
+/// @brief Split of a 1-D array over the parts (ranks) of a communicator, as the counts and displacements that
+/// MPI_Scatterv, MPI_Gatherv and MPI_Allgatherv take.
+/// @details Counts and displacements are computed once on construction; a task that keeps its partition, e.g.
+/// from PreProcessing() on, reuses them in every Run().
+class Partition {
+ public:
+  Partition() = default;
+
+  /// @brief Parts of the given sizes, laid out one after another.
+  /// @throws std::invalid_argument If a count is negative.
+  explicit Partition(std::vector<int> counts);
+
+  /// @brief Parts at explicit displacements; parts may overlap (see Halo()).
+  /// @throws std::invalid_argument If the vectors differ in size or hold negative values.
+  Partition(std::vector<int> counts, std::vector<int> displs);
+
+  /// @brief Balanced blocks of `total` elements: the first `total % num_parts` parts get one element more.
+  /// @details The same layout as GetBlockRange().
+  /// @throws std::overflow_error If `total` does not fit into int.
+  static Partition Block(std::size_t total, int num_parts);
+
+  /// @brief Balanced blocks of whole rows, counted in elements.
+  /// @throws std::overflow_error If `rows * row_size` does not fit into int.
+  static Partition BlockRows(std::size_t rows, std::size_t row_size, int num_parts);
+
+  /// @brief Balanced blocks, each extended by up to `halo` elements of its neighbours on either side.
+  /// @details The parts overlap, which MPI_Scatterv allows (since MPI 2.2), so every rank receives its halo with
+  /// the same call as its block. Parts are clamped at the ends of the array.
+  static Partition Halo(std::size_t total, int num_parts, std::size_t halo);
+
+  /// @brief Returns the number of parts.
+  [[nodiscard]] int GetNumParts() const {
+    return static_cast<int>(counts_.size());
+  }
+
+  /// @brief Returns the number of elements of every part.
+  [[nodiscard]] const std::vector<int> &GetCounts() const {
+    return counts_;
+  }
+
+  /// @brief Returns the offset of every part in the whole array.
+  [[nodiscard]] const std::vector<int> &GetDispls() const {
+    return displs_;
+  }
+
+  /// @brief Returns the number of elements of `part`.
+  [[nodiscard]] int GetCount(int part) const {
+    return counts_[static_cast<std::size_t>(part)];
+  }
+
+  /// @brief Returns the offset of `part` in the whole array.
+  [[nodiscard]] int GetDispl(int part) const {
+    return displs_[static_cast<std::size_t>(part)];
+  }
+
+  /// @brief Returns the elements [begin, begin + count) of `part`.
+  [[nodiscard]] BlockRange GetRange(int part) const {
+    return {.begin = static_cast<std::size_t>(GetDispl(part)), .count = static_cast<std::size_t>(GetCount(part))};
+  }
+
+  /// @brief Returns the number of elements of the whole array, i.e. the end of the last part.
+  [[nodiscard]] std::size_t GetTotal() const {
+    return total_;
+  }
+
+  /// @brief Returns the first part that holds element `index`, or -1 if none does.
+  /// @details Logarithmic in the number of parts when the parts are in ascending order, linear otherwise.
+  [[nodiscard]] int GetOwner(std::size_t index) const;
+
+ private:
+  std::vector<int> counts_;
+  std::vector<int> displs_;
+  std::size_t total_ = 0;
+  bool ascending_ = true;
+};
+
+/// @brief Balanced blocks of a 1-D array whose parts also need `halo` elements on either side of their block,
+/// as stencils do.
+/// @details The local buffer of a part holds GetExtended() of the array: the halo before the block, the block and
+/// the halo after it. Scatter it with GetExtended() and refresh the halos after every update with
+/// ppc::dist::ExchangeHalos(). A halo wider than the neighbouring block is filled from the parts further away.
+class HaloPartition {
+ public:
+  HaloPartition() = default;
+  HaloPartition(std::size_t total, int num_parts, std::size_t halo);
+
+  /// @brief Returns the blocks without halos, e.g. to gather the result.
+  [[nodiscard]] const Partition &GetOwned() const {
+    return owned_;
+  }
+
+  /// @brief Returns the blocks with their halos.
+  [[nodiscard]] const Partition &GetExtended() const {
+    return extended_;
+  }
+
+  /// @brief Returns the requested halo width.
+  [[nodiscard]] std::size_t GetHalo() const {
+    return halo_;
+  }
+
+  /// @brief Returns the offset of the block of `part` in its local buffer, i.e. the width of its leading halo.
+  [[nodiscard]] std::size_t GetOwnedOffset(int part) const {
+    return static_cast<std::size_t>(owned_.GetDispl(part) - extended_.GetDispl(part));
+  }
+
+ private:
+  Partition owned_;
+  Partition extended_;
+  std::size_t halo_ = 0;
+};
+
+/// @brief Partition whose parts are not contiguous in the array.
+/// @details MPI's v-collectives need every part in one piece, so the array is reordered part by part with Pack()
+/// before scattering it with GetPacked(), and gathered packed data is put back in place with Unpack().
+class PackedPartition {
+ public:
+  /// @brief Returns the parts as contiguous pieces of the packed array.
+  [[nodiscard]] const Partition &GetPacked() const {
+    return packed_;
+  }
+
+  /// @brief Returns a copy of `global` in which the elements of every part are contiguous.
+  template <typename T>
+  [[nodiscard]] std::vector<T> Pack(std::span<const T> global) const {
+    std::vector<T> packed;
+    packed.reserve(packed_.GetTotal());
+    for (const auto &segment : segments_) {
+      const auto first = global.begin() + static_cast<std::ptrdiff_t>(segment.begin);
+      packed.insert(packed.end(), first, first + static_cast<std::ptrdiff_t>(segment.count));
+    }
+    return packed;
+  }
+
+  /// @brief Writes packed data back to its place in `global`; inverse of Pack().
+  template <typename T>
+  void Unpack(std::span<const T> packed, std::span<T> global) const {
+    auto source = packed.begin();
+    for (const auto &segment : segments_) {
+      const auto count = static_cast<std::ptrdiff_t>(segment.count);
+      std::copy(source, source + count, global.begin() + static_cast<std::ptrdiff_t>(segment.begin));
+      source += count;
+    }
+  }
+
+ protected:
+  /// Contiguous run of elements of one part, [begin, begin + count) in the array
+  struct Segment {
+    std::size_t begin = 0;
+    std::size_t count = 0;
+  };
+
+  /// Segments of all parts, part 0 first, in packed order
+  std::vector<Segment> segments_;
+  /// Parts in the packed array
+  Partition packed_;
+};
+
+/// @brief Block-cyclic distribution: blocks of `block_size` elements are dealt to the parts in turn.
+/// @details Block `b` belongs to part `b % num_parts`, which balances work that grows or shrinks along the
+/// array better than one block per part.
+class BlockCyclicPartition : public PackedPartition {
+ public:
+  BlockCyclicPartition(std::size_t total, int num_parts, std::size_t block_size);
+
+  /// @brief Returns the part that holds element `index`.
+  [[nodiscard]] int GetOwner(std::size_t index) const {
+    return static_cast<int>((index / block_size_) % static_cast<std::size_t>(num_parts_));
+  }
+
+  /// @brief Returns the index in the array of the `local_index`-th element of `part`.
+  [[nodiscard]] std::size_t GetGlobalIndex(int part, std::size_t local_index) const {
+    const std::size_t round = local_index / block_size_;
+    return (((round * static_cast<std::size_t>(num_parts_)) + static_cast<std::size_t>(part)) * block_size_) +
+           (local_index % block_size_);
+  }
+
+ private:
+  int num_parts_ = 1;
+  std::size_t block_size_ = 1;
+};
+
+/// @brief Two-dimensional distribution of a row-major matrix over a grid of parts.
+/// @details Part `p` sits at grid row `p / GetGridCols()` and grid column `p % GetGridCols()` and holds the
+/// balanced row block of its grid row and column block of its grid column, row-major in its local buffer.
+class GridPartition : public PackedPartition {
+ public:
+  /// @brief Spreads `num_parts` over the grid that is closest to square, as MPI_Dims_create does.
+  GridPartition(std::size_t rows, std::size_t cols, int num_parts);
+
+  /// @brief Uses a grid of `grid_rows` x `grid_cols` parts.
+  /// @throws std::invalid_argument If a grid dimension is not positive.
+  GridPartition(std::size_t rows, std::size_t cols, int grid_rows, int grid_cols);
+
+  /// @brief Returns the number of grid rows.
+  [[nodiscard]] int GetGridRows() const {
+    return grid_rows_;
+  }
+
+  /// @brief Returns the number of grid columns.
+  [[nodiscard]] int GetGridCols() const {
+    return grid_cols_;
+  }
+
+  /// @brief Returns the matrix rows held by `part`.
+  [[nodiscard]] BlockRange GetRowRange(int part) const {
+    return GetBlockRange(rows_, grid_rows_, part / grid_cols_);
+  }
+
+  /// @brief Returns the matrix columns held by `part`.
+  [[nodiscard]] BlockRange GetColRange(int part) const {
+    return GetBlockRange(cols_, grid_cols_, part % grid_cols_);
+  }
+
+ private:
+  std::size_t rows_ = 0;
+  std::size_t cols_ = 0;
+  int grid_rows_ = 1;
+  int grid_cols_ = 1;
+};
+
+/// @brief Returns the factorization `{rows, cols}` of `num_parts` with `rows >= cols` that is closest to square.
+std::pair<int, int> GetGridShape(int num_parts);
+
+}  // namespace ppc::dist
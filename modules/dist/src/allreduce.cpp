@@ -0,0 +1,293 @@
+#include "dist/include/allreduce.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dist/include/partition.hpp"
+
+namespace {
+
+// Below this size an allreduce is bound by latency, and the fewest messages win
+constexpr std::size_t kShortBytes = std::size_t{16} << 10;
+// From this size on the ring beats Rabenseifner on a non-power-of-two number of ranks
+constexpr std::size_t kRingMinBytes = std::size_t{1} << 20;
+
+// Exchanges elements with one peer and combines what arrived into the local ones
+class Exchanger {
+ public:
+  Exchanger(std::byte *data, MPI_Datatype type, std::size_t element_size,
+            const ppc::dist::detail::CombineFn &combine, MPI_Comm comm)
+      : data_(data), type_(type), element_size_(element_size), combine_(&combine), comm_(comm) {}
+
+  // Sends [send_begin, send_begin + send_count) to `dest` and combines the elements from `source` into
+  // [recv_begin, recv_begin + recv_count)
+  void Reduce(int dest, std::size_t send_begin, std::size_t send_count, int source, std::size_t recv_begin,
+              std::size_t recv_count) {
+    MPI_Sendrecv(At(send_begin), static_cast<int>(send_count), type_, dest, 0, Buffer(recv_count),
+                 static_cast<int>(recv_count), type_, source, 0, comm_, MPI_STATUS_IGNORE);
+    (*combine_)(buffer_.data(), At(recv_begin), recv_count);
+  }
+
+  // The same, but the elements from `source` overwrite [recv_begin, recv_begin + recv_count)
+  void Copy(int dest, std::size_t send_begin, std::size_t send_count, int source, std::size_t recv_begin,
+            std::size_t recv_count) {
+    MPI_Sendrecv(At(send_begin), static_cast<int>(send_count), type_, dest, 0, At(recv_begin),
+                 static_cast<int>(recv_count), type_, source, 0, comm_, MPI_STATUS_IGNORE);
+  }
+
+  void Send(int dest, std::size_t count) const {
+    MPI_Send(data_, static_cast<int>(count), type_, dest, 0, comm_);
+  }
+
+  void Recv(int source, std::size_t count) const {
+    MPI_Recv(data_, static_cast<int>(count), type_, source, 0, comm_, MPI_STATUS_IGNORE);
+  }
+
+  void RecvAndCombine(int source, std::size_t count) {
+    MPI_Recv(Buffer(count), static_cast<int>(count), type_, source, 0, comm_, MPI_STATUS_IGNORE);
+    (*combine_)(buffer_.data(), data_, count);
+  }
+
+ private:
+  [[nodiscard]] std::byte *At(std::size_t element) const {
+    return data_ + (element * element_size_);
+  }
+
+  // Receive buffer of at least `count` elements, grown on demand and reused by later steps
+  std::byte *Buffer(std::size_t count) {
+    if (buffer_.size() < count * element_size_) {
+      buffer_.resize(count * element_size_);
+    }
+    return buffer_.data();
+  }
+
+  std::byte *data_;
+  MPI_Datatype type_;
+  std::size_t element_size_;
+  const ppc::dist::detail::CombineFn *combine_;
+  MPI_Comm comm_;
+  std::vector<std::byte> buffer_;
+};
+
+// Ranks beyond the largest power of two are folded into their neighbours: of the first 2 * rem ranks, the even
+// ones hand their vector to the next odd one and sit out, so that a power of two of ranks remains
+class FoldedRanks {
+ public:
+  FoldedRanks(int rank, int size) : pof2_(std::bit_floor(static_cast<unsigned>(size))), rem_(size - pof2_) {
+    if (rank < 2 * rem_) {
+      new_rank_ = (rank % 2 == 0) ? -1 : rank / 2;
+    } else {
+      new_rank_ = rank - rem_;
+    }
+  }
+
+  [[nodiscard]] int GetPof2() const {
+    return pof2_;
+  }
+
+  // Rank among the remaining power of two, -1 if the calling rank sits out
+  [[nodiscard]] int GetNewRank() const {
+    return new_rank_;
+  }
+
+  [[nodiscard]] int ToRank(int new_rank) const {
+    return new_rank < rem_ ? (new_rank * 2) + 1 : new_rank + rem_;
+  }
+
+  void Fold(int rank, Exchanger &exchanger, std::size_t count) const {
+    if (rank >= 2 * rem_) {
+      return;
+    }
+    if (rank % 2 == 0) {
+      exchanger.Send(rank + 1, count);
+    } else {
+      exchanger.RecvAndCombine(rank - 1, count);
+    }
+  }
+
+  void Unfold(int rank, Exchanger &exchanger, std::size_t count) const {
+    if (rank >= 2 * rem_) {
+      return;
+    }
+    if (rank % 2 == 0) {
+      exchanger.Recv(rank + 1, count);
+    } else {
+      exchanger.Send(rank - 1, count);
+    }
+  }
+
+ private:
+  int pof2_;
+  int rem_;
+  int new_rank_ = -1;
+};
+
+void RecursiveDoubling(int rank, int size, std::size_t count, Exchanger &exchanger) {
+  const FoldedRanks folded(rank, size);
+  folded.Fold(rank, exchanger, count);
+  if (folded.GetNewRank() >= 0) {
+    for (int mask = 1; mask < folded.GetPof2(); mask <<= 1) {
+      const int peer = folded.ToRank(folded.GetNewRank() ^ mask);
+      exchanger.Reduce(peer, 0, count, peer, 0, count);
+    }
+  }
+  folded.Unfold(rank, exchanger, count);
+}
+
+void Ring(int rank, int size, std::size_t count, Exchanger &exchanger) {
+  const auto blocks = ppc::dist::Partition::Block(count, size);
+  const auto begin = [&](int block) { return blocks.GetRange(block).begin; };
+  const auto length = [&](int block) { return blocks.GetRange(block).count; };
+  const int right = (rank + 1) % size;
+  const int left = (rank - 1 + size) % size;
+
+  // Reduce-scatter: block b travels from rank b + 1 around the ring and is complete on rank b
+  // after p - 1 steps; here rank r ends up with block r + 1
+  for (int step = 0; step < size - 1; step++) {
+    const int send_block = (rank - step + size) % size;
+    const int recv_block = (rank - step - 1 + size) % size;
+    exchanger.Reduce(right, begin(send_block), length(send_block), left, begin(recv_block), length(recv_block));
+  }
+  // Allgather: the complete blocks travel around the ring once more
+  for (int step = 0; step < size - 1; step++) {
+    const int send_block = (rank - step + 1 + size) % size;
+    const int recv_block = (rank - step + size) % size;
+    exchanger.Copy(right, begin(send_block), length(send_block), left, begin(recv_block), length(recv_block));
+  }
+}
+
+void Rabenseifner(int rank, int size, std::size_t count, Exchanger &exchanger) {
+  const FoldedRanks folded(rank, size);
+  folded.Fold(rank, exchanger, count);
+
+  const int new_rank = folded.GetNewRank();
+  if (new_rank >= 0) {
+    const int pof2 = folded.GetPof2();
+    const auto blocks = ppc::dist::Partition::Block(count, pof2);
+    // Elements of blocks [first, last)
+    const auto span_of = [&](int first, int last) {
+      if (first == last) {
+        return std::size_t{0};
+      }
+      return blocks.GetRange(last - 1).begin + blocks.GetRange(last - 1).count - blocks.GetRange(first).begin;
+    };
+    const auto begin = [&](int block) { return blocks.GetRange(block).begin; };
+
+    // Reduce-scatter by recursive halving: at every step the pair splits its current blocks [send_idx, last_idx)
+    // in two halves, keeps one and reduces it with the peer's copy
+    int send_idx = 0;
+    int recv_idx = 0;
+    int last_idx = pof2;
+    int mask = 1;
+    while (mask < pof2) {
+      const int new_peer = new_rank ^ mask;
+      const int half = pof2 / (mask * 2);
+      const int peer = folded.ToRank(new_peer);
+      if (new_rank < new_peer) {
+        send_idx = recv_idx + half;
+        exchanger.Reduce(peer, begin(send_idx), span_of(send_idx, last_idx), peer, begin(recv_idx),
+                         span_of(recv_idx, send_idx));
+      } else {
+        recv_idx = send_idx + half;
+        exchanger.Reduce(peer, begin(send_idx), span_of(send_idx, recv_idx), peer, begin(recv_idx),
+                         span_of(recv_idx, last_idx));
+      }
+      send_idx = recv_idx;
+      mask <<= 1;
+      if (mask < pof2) {
+        last_idx = recv_idx + (pof2 / mask);
+      }
+    }
+
+    // Allgather by recursive doubling, the same steps in reverse
+    mask >>= 1;
+    while (mask > 0) {
+      const int new_peer = new_rank ^ mask;
+      const int half = pof2 / (mask * 2);
+      const int peer = folded.ToRank(new_peer);
+      if (new_rank < new_peer) {
+        if (mask != pof2 / 2) {
+          last_idx += half;
+        }
+        recv_idx = send_idx + half;
+        exchanger.Copy(peer, begin(send_idx), span_of(send_idx, recv_idx), peer, begin(recv_idx),
+                       span_of(recv_idx, last_idx));
+      } else {
+        recv_idx = send_idx - half;
+        exchanger.Copy(peer, begin(send_idx), span_of(send_idx, last_idx), peer, begin(recv_idx),
+                       span_of(recv_idx, send_idx));
+        send_idx = recv_idx;
+      }
+      mask >>= 1;
+    }
+  }
+
+  folded.Unfold(rank, exchanger, count);
+}
+
+}  // namespace
+
+std::string ppc::dist::GetAllreduceAlgorithmName(AllreduceAlgorithm algorithm) {
+  switch (algorithm) {
+    case AllreduceAlgorithm::kAuto:
+      return "auto";
+    case AllreduceAlgorithm::kRecursiveDoubling:
+      return "recursive_doubling";
+    case AllreduceAlgorithm::kRing:
+      return "ring";
+    case AllreduceAlgorithm::kRabenseifner:
+      return "rabenseifner";
+  }
+  throw std::invalid_argument("Unknown allreduce algorithm");
+}
+
+ppc::dist::AllreduceAlgorithm ppc::dist::SelectAllreduceAlgorithm(std::size_t bytes, std::size_t count,
+                                                                 int num_ranks) {
+  const auto pof2 = std::bit_floor(static_cast<unsigned>(std::max(num_ranks, 1)));
+  if (bytes < kShortBytes || count < pof2) {
+    return AllreduceAlgorithm::kRecursiveDoubling;
+  }
+  if (std::cmp_equal(pof2, num_ranks) || bytes < kRingMinBytes) {
+    return AllreduceAlgorithm::kRabenseifner;
+  }
+  return AllreduceAlgorithm::kRing;
+}
+
+void ppc::dist::detail::Allreduce(void *data, std::size_t count, MPI_Datatype type, std::size_t element_size,
+                                  const CombineFn &combine, MPI_Comm comm, AllreduceAlgorithm algorithm) {
+  if (count > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+    throw std::overflow_error("Allreduce of " + std::to_string(count) + " elements exceeds the range of int");
+  }
+  int rank = 0;
+  int size = 0;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &size);
+  if (size == 1 || count == 0) {
+    return;
+  }
+  if (algorithm == AllreduceAlgorithm::kAuto) {
+    algorithm = SelectAllreduceAlgorithm(count * element_size, count, size);
+  }
+
+  Exchanger exchanger(static_cast<std::byte *>(data), type, element_size, combine, comm);
+  switch (algorithm) {
+    case AllreduceAlgorithm::kRing:
+      Ring(rank, size, count, exchanger);
+      break;
+    case AllreduceAlgorithm::kRabenseifner:
+      Rabenseifner(rank, size, count, exchanger);
+      break;
+    case AllreduceAlgorithm::kAuto:  // Resolved above
+    case AllreduceAlgorithm::kRecursiveDoubling:
+      RecursiveDoubling(rank, size, count, exchanger);
+      break;
+  }
+}
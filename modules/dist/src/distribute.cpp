@@ -0,0 +1,73 @@
+#include "dist/include/distribute.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "dist/include/block_range.hpp"
+#include "dist/include/partition.hpp"
+
+namespace {
+
+struct Interval {
+  std::size_t begin = 0;
+  std::size_t end = 0;
+};
+
+Interval Intersect(Interval a, Interval b) {
+  const std::size_t begin = std::max(a.begin, b.begin);
+  return {.begin = begin, .end = std::max(begin, std::min(a.end, b.end))};
+}
+
+Interval ToInterval(const ppc::dist::BlockRange &range) {
+  return {.begin = range.begin, .end = range.begin + range.count};
+}
+
+// Leading and trailing halo of a part; the tag of a halo message is its index here
+std::array<Interval, 2> GetHalos(const ppc::dist::HaloPartition &partition, int part) {
+  const auto owned = ToInterval(partition.GetOwned().GetRange(part));
+  const auto extended = ToInterval(partition.GetExtended().GetRange(part));
+  return {Interval{.begin = extended.begin, .end = owned.begin}, Interval{.begin = owned.end, .end = extended.end}};
+}
+
+}  // namespace
+
+void ppc::dist::detail::ExchangeHalos(const HaloPartition &partition, void *local, MPI_Datatype type,
+                                      std::size_t element_size, MPI_Comm comm) {
+  int rank = 0;
+  int num_ranks = 0;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &num_ranks);
+
+  auto *bytes = static_cast<char *>(local);
+  const std::size_t local_begin = partition.GetExtended().GetRange(rank).begin;
+  const auto at = [&](const Interval &interval) { return bytes + ((interval.begin - local_begin) * element_size); };
+  const auto my_owned = ToInterval(partition.GetOwned().GetRange(rank));
+  const auto my_halos = GetHalos(partition, rank);
+
+  std::vector<MPI_Request> requests;
+  for (int peer = 0; peer < num_ranks; peer++) {
+    if (peer == rank) {
+      continue;
+    }
+    const auto peer_owned = ToInterval(partition.GetOwned().GetRange(peer));
+    const auto peer_halos = GetHalos(partition, peer);
+    for (int tag = 0; tag < static_cast<int>(my_halos.size()); tag++) {
+      const auto index = static_cast<std::size_t>(tag);
+      const auto incoming = Intersect(my_halos[index], peer_owned);
+      if (incoming.end > incoming.begin) {
+        MPI_Irecv(at(incoming), static_cast<int>(incoming.end - incoming.begin), type, peer, tag, comm,
+                  &requests.emplace_back());
+      }
+      const auto outgoing = Intersect(peer_halos[index], my_owned);
+      if (outgoing.end > outgoing.begin) {
+        MPI_Isend(at(outgoing), static_cast<int>(outgoing.end - outgoing.begin), type, peer, tag, comm,
+                  &requests.emplace_back());
+      }
+    }
+  }
+  MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+}
@@ -0,0 +1,223 @@
+#include "dist/include/node_collectives.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dist/include/partition.hpp"
+
+namespace {
+
+bool IsMpiFinalized() {
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  return finalized != 0;
+}
+
+void FreeComm(MPI_Comm &comm) {
+  if (comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&comm);
+  }
+}
+
+int ToMessageCount(std::size_t count) {
+  if (count > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+    throw std::overflow_error("Node collective of " + std::to_string(count) + " elements exceeds the range of int");
+  }
+  return static_cast<int>(count);
+}
+
+}  // namespace
+
+ppc::dist::NodeTopology::NodeTopology(MPI_Comm comm) {
+  MPI_Comm_dup(comm, &comm_);
+  MPI_Comm_rank(comm_, &rank_);
+  MPI_Comm node_comm = MPI_COMM_NULL;
+  MPI_Comm_split_type(comm_, MPI_COMM_TYPE_SHARED, rank_, MPI_INFO_NULL, &node_comm);
+  Split(node_comm);
+}
+
+ppc::dist::NodeTopology::NodeTopology(MPI_Comm comm, int node_id) {
+  MPI_Comm_dup(comm, &comm_);
+  MPI_Comm_rank(comm_, &rank_);
+  MPI_Comm node_comm = MPI_COMM_NULL;
+  MPI_Comm_split(comm_, node_id, rank_, &node_comm);
+  Split(node_comm);
+}
+
+void ppc::dist::NodeTopology::Split(MPI_Comm node_comm) {
+  node_comm_ = node_comm;
+  int node_rank = 0;
+  MPI_Comm_rank(node_comm_, &node_rank);
+  MPI_Comm_split(comm_, node_rank == 0 ? 0 : MPI_UNDEFINED, rank_, &leader_comm_);
+
+  // Leaders number the nodes by their rank among the leaders and tell their node
+  int node = 0;
+  if (IsLeader()) {
+    MPI_Comm_rank(leader_comm_, &node);
+  }
+  MPI_Bcast(&node, 1, MPI_INT, 0, node_comm_);
+
+  int size = 0;
+  MPI_Comm_size(comm_, &size);
+  node_of_rank_.resize(static_cast<std::size_t>(size));
+  MPI_Allgather(&node, 1, MPI_INT, node_of_rank_.data(), 1, MPI_INT, comm_);
+
+  // Node ranks follow the ranks of comm_, which were the split keys
+  for (int rank = 0; rank < size; rank++) {
+    const auto rank_node = static_cast<std::size_t>(node_of_rank_[static_cast<std::size_t>(rank)]);
+    if (node_members_.size() <= rank_node) {
+      node_members_.resize(rank_node + 1);
+    }
+    node_members_[rank_node].push_back(rank);
+  }
+}
+
+ppc::dist::NodeTopology::~NodeTopology() {
+  if (IsMpiFinalized()) {
+    return;
+  }
+  FreeComm(leader_comm_);
+  FreeComm(node_comm_);
+  FreeComm(comm_);
+}
+
+const ppc::dist::NodeTopology &ppc::dist::NodeTopology::World() {
+  static const NodeTopology kWorld(MPI_COMM_WORLD);
+  return kWorld;
+}
+
+ppc::dist::SharedWindow::SharedWindow(const NodeTopology &topology, std::size_t bytes)
+    : node_comm_(topology.GetNodeComm()), size_(bytes) {
+  void *base = nullptr;
+  const auto local_bytes = static_cast<MPI_Aint>(topology.IsLeader() ? bytes : 0);
+  MPI_Win_allocate_shared(local_bytes, 1, MPI_INFO_NULL, node_comm_, &base, &win_);
+  if (!topology.IsLeader()) {
+    MPI_Aint leader_bytes = 0;
+    int disp_unit = 0;
+    MPI_Win_shared_query(win_, 0, &leader_bytes, &disp_unit, &base);
+  }
+  data_ = static_cast<std::byte *>(base);
+  // One passive epoch for the lifetime of the window; Synchronize() orders the accesses inside it
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, win_);
+}
+
+ppc::dist::SharedWindow::~SharedWindow() {
+  Free();
+}
+
+ppc::dist::SharedWindow::SharedWindow(SharedWindow &&other) noexcept
+    : win_(std::exchange(other.win_, MPI_WIN_NULL)),
+      node_comm_(std::exchange(other.node_comm_, MPI_COMM_NULL)),
+      data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)) {}
+
+ppc::dist::SharedWindow &ppc::dist::SharedWindow::operator=(SharedWindow &&other) noexcept {
+  if (this != &other) {
+    Free();
+    win_ = std::exchange(other.win_, MPI_WIN_NULL);
+    node_comm_ = std::exchange(other.node_comm_, MPI_COMM_NULL);
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+  }
+  return *this;
+}
+
+void ppc::dist::SharedWindow::Free() {
+  if (win_ == MPI_WIN_NULL || IsMpiFinalized()) {
+    return;
+  }
+  MPI_Win_unlock_all(win_);
+  MPI_Win_free(&win_);
+  data_ = nullptr;
+}
+
+void ppc::dist::SharedWindow::Synchronize() const {
+  MPI_Win_sync(win_);
+  MPI_Barrier(node_comm_);
+  MPI_Win_sync(win_);
+}
+
+void ppc::dist::detail::BcastBetweenNodes(const NodeTopology &topology, SharedWindow &window, int root) {
+  // Large segments go in chunks, since MPI counts are int
+  constexpr std::size_t kChunkBytes = std::size_t{1} << 30;
+  for (std::size_t offset = 0; offset < window.GetSize(); offset += kChunkBytes) {
+    const std::size_t bytes = std::min(kChunkBytes, window.GetSize() - offset);
+    MPI_Bcast(window.GetData() + offset, static_cast<int>(bytes), MPI_BYTE, topology.GetNodeOf(root),
+              topology.GetLeaderComm());
+  }
+}
+
+std::size_t ppc::dist::detail::GetNodeOffset(const NodeTopology &topology, const Partition &partition, int rank) {
+  std::size_t offset = 0;
+  for (const int member : topology.GetNodeMembers(topology.GetNodeOf(rank))) {
+    if (member == rank) {
+      break;
+    }
+    offset += static_cast<std::size_t>(partition.GetCount(member));
+  }
+  return offset;
+}
+
+void ppc::dist::detail::ScatterBetweenNodes(const NodeTopology &topology, const Partition &partition,
+                                            const void *global, MPI_Datatype type, std::size_t element_size,
+                                            SharedWindow &window, int root) {
+  const int rank = topology.GetRank();
+  const int root_node = topology.GetNodeOf(root);
+  std::vector<MPI_Request> requests;
+  std::vector<MPI_Datatype> node_types;
+
+  if (rank == root) {
+    const auto *source = static_cast<const std::byte *>(global);
+    for (int node = 0; node < topology.GetNumNodes(); node++) {
+      const auto &members = topology.GetNodeMembers(node);
+      std::vector<int> counts;
+      std::vector<int> displs;
+      for (const int member : members) {
+        counts.push_back(partition.GetCount(member));
+        displs.push_back(partition.GetDispl(member));
+      }
+      if (node == root_node) {
+        // The blocks of the root's own node are copied straight into the shared segment
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < members.size(); i++) {
+          const auto count = static_cast<std::size_t>(counts[i]);
+          if (count == 0) {
+            continue;
+          }
+          std::memcpy(window.GetData() + (offset * element_size),
+                      source + (static_cast<std::size_t>(displs[i]) * element_size), count * element_size);
+          offset += count;
+        }
+        continue;
+      }
+      MPI_Datatype node_type = MPI_DATATYPE_NULL;
+      MPI_Type_indexed(static_cast<int>(members.size()), counts.data(), displs.data(), type, &node_type);
+      MPI_Type_commit(&node_type);
+      node_types.push_back(node_type);
+      MPI_Isend(global, 1, node_type, members.front(), 0, topology.GetComm(), &requests.emplace_back());
+    }
+  }
+
+  const int node = topology.GetNodeOf(rank);
+  if (topology.IsLeader() && node != root_node) {
+    std::size_t node_count = 0;
+    for (const int member : topology.GetNodeMembers(node)) {
+      node_count += static_cast<std::size_t>(partition.GetCount(member));
+    }
+    MPI_Irecv(window.GetData(), ToMessageCount(node_count), type, root, 0, topology.GetComm(),
+              &requests.emplace_back());
+  }
+
+  MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+  for (auto &node_type : node_types) {
+    MPI_Type_free(&node_type);
+  }
+}
@@ -0,0 +1,182 @@
+#include "dist/include/partition.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dist/include/block_range.hpp"
+
+namespace {
+
+void CheckNumParts(int num_parts) {
+  if (num_parts <= 0) {
+    throw std::invalid_argument("Partition needs at least one part, got " + std::to_string(num_parts));
+  }
+}
+
+// Counts and displacements of MPI's v-collectives are int
+int ToCount(std::size_t value) {
+  if (value > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+    throw std::overflow_error("Partition of " + std::to_string(value) + " elements exceeds the range of int");
+  }
+  return static_cast<int>(value);
+}
+
+}  // namespace
+
+ppc::dist::Partition::Partition(std::vector<int> counts) : counts_(std::move(counts)), displs_(counts_.size()) {
+  int offset = 0;
+  for (std::size_t part = 0; part < counts_.size(); part++) {
+    if (counts_[part] < 0) {
+      throw std::invalid_argument("Partition counts must not be negative");
+    }
+    displs_[part] = offset;
+    offset = ToCount(static_cast<std::size_t>(offset) + static_cast<std::size_t>(counts_[part]));
+  }
+  total_ = static_cast<std::size_t>(offset);
+}
+
+ppc::dist::Partition::Partition(std::vector<int> counts, std::vector<int> displs)
+    : counts_(std::move(counts)), displs_(std::move(displs)) {
+  if (counts_.size() != displs_.size()) {
+    throw std::invalid_argument("Partition needs one displacement per count");
+  }
+  for (std::size_t part = 0; part < counts_.size(); part++) {
+    if (counts_[part] < 0 || displs_[part] < 0) {
+      throw std::invalid_argument("Partition counts and displacements must not be negative");
+    }
+    const auto end = static_cast<std::size_t>(displs_[part]) + static_cast<std::size_t>(counts_[part]);
+    total_ = std::max(total_, end);
+    if (part + 1 < counts_.size() && end > static_cast<std::size_t>(displs_[part + 1])) {
+      ascending_ = false;
+    }
+  }
+}
+
+ppc::dist::Partition ppc::dist::Partition::Block(std::size_t total, int num_parts) {
+  return BlockRows(total, 1, num_parts);
+}
+
+ppc::dist::Partition ppc::dist::Partition::BlockRows(std::size_t rows, std::size_t row_size, int num_parts) {
+  CheckNumParts(num_parts);
+  if (row_size != 0 && rows > std::numeric_limits<std::size_t>::max() / row_size) {
+    throw std::overflow_error("Partition of " + std::to_string(rows) + " rows exceeds the range of std::size_t");
+  }
+  ToCount(rows * row_size);
+  std::vector<int> counts(static_cast<std::size_t>(num_parts));
+  for (int part = 0; part < num_parts; part++) {
+    counts[static_cast<std::size_t>(part)] =
+        static_cast<int>(ppc::dist::GetBlockRange(rows, num_parts, part).count * row_size);
+  }
+  return Partition(std::move(counts));
+}
+
+ppc::dist::Partition ppc::dist::Partition::Halo(std::size_t total, int num_parts, std::size_t halo) {
+  const auto owned = Block(total, num_parts);
+  std::vector<int> counts(owned.GetCounts().size());
+  std::vector<int> displs(owned.GetDispls().size());
+  for (int part = 0; part < num_parts; part++) {
+    const auto range = owned.GetRange(part);
+    const auto index = static_cast<std::size_t>(part);
+    displs[index] = static_cast<int>(range.begin);
+    // A part without elements computes nothing and needs no halo
+    if (range.count == 0) {
+      continue;
+    }
+    const std::size_t begin = range.begin - std::min(range.begin, halo);
+    const std::size_t end = std::min(total, range.begin + range.count + halo);
+    displs[index] = static_cast<int>(begin);
+    counts[index] = static_cast<int>(end - begin);
+  }
+  return {std::move(counts), std::move(displs)};
+}
+
+int ppc::dist::Partition::GetOwner(std::size_t index) const {
+  const auto holds = [&](std::size_t part) {
+    const auto begin = static_cast<std::size_t>(displs_[part]);
+    return index >= begin && index - begin < static_cast<std::size_t>(counts_[part]);
+  };
+  if (!ascending_) {
+    for (std::size_t part = 0; part < counts_.size(); part++) {
+      if (holds(part)) {
+        return static_cast<int>(part);
+      }
+    }
+    return -1;
+  }
+  // The last part starting at or before `index`; empty parts in front of it are skipped
+  const auto next =
+      std::ranges::upper_bound(displs_, index, {}, [](int displ) { return static_cast<std::size_t>(displ); });
+  if (next == displs_.begin()) {
+    return -1;
+  }
+  const auto part = static_cast<std::size_t>(next - displs_.begin() - 1);
+  return holds(part) ? static_cast<int>(part) : -1;
+}
+
+ppc::dist::HaloPartition::HaloPartition(std::size_t total, int num_parts, std::size_t halo)
+    : owned_(Partition::Block(total, num_parts)), extended_(Partition::Halo(total, num_parts, halo)), halo_(halo) {}
+
+ppc::dist::BlockCyclicPartition::BlockCyclicPartition(std::size_t total, int num_parts, std::size_t block_size)
+    : num_parts_(num_parts), block_size_(block_size) {
+  CheckNumParts(num_parts);
+  if (block_size == 0) {
+    throw std::invalid_argument("BlockCyclicPartition needs a positive block size");
+  }
+  ToCount(total);
+  const std::size_t num_blocks = (total + block_size - 1) / block_size;
+  std::vector<int> counts(static_cast<std::size_t>(num_parts));
+  segments_.reserve(num_blocks);
+  for (std::size_t part = 0; part < counts.size(); part++) {
+    for (std::size_t block = part; block < num_blocks; block += counts.size()) {
+      const std::size_t begin = block * block_size;
+      const std::size_t count = std::min(block_size, total - begin);
+      segments_.push_back({.begin = begin, .count = count});
+      counts[part] += static_cast<int>(count);
+    }
+  }
+  packed_ = Partition(std::move(counts));
+}
+
+ppc::dist::GridPartition::GridPartition(std::size_t rows, std::size_t cols, int num_parts)
+    : GridPartition(rows, cols, GetGridShape(num_parts).first, GetGridShape(num_parts).second) {}
+
+ppc::dist::GridPartition::GridPartition(std::size_t rows, std::size_t cols, int grid_rows, int grid_cols)
+    : rows_(rows), cols_(cols), grid_rows_(grid_rows), grid_cols_(grid_cols) {
+  if (grid_rows <= 0 || grid_cols <= 0) {
+    throw std::invalid_argument("GridPartition needs a positive grid shape");
+  }
+  if (cols != 0 && rows > std::numeric_limits<std::size_t>::max() / cols) {
+    throw std::overflow_error("GridPartition of " + std::to_string(rows) + " rows exceeds the range of std::size_t");
+  }
+  ToCount(rows * cols);
+  const int num_parts = grid_rows * grid_cols;
+  std::vector<int> counts(static_cast<std::size_t>(num_parts));
+  for (int part = 0; part < num_parts; part++) {
+    const auto row_range = GetRowRange(part);
+    const auto col_range = GetColRange(part);
+    if (col_range.count == 0) {
+      continue;
+    }
+    for (std::size_t row = row_range.begin; row < row_range.begin + row_range.count; row++) {
+      segments_.push_back({.begin = (row * cols) + col_range.begin, .count = col_range.count});
+    }
+    counts[static_cast<std::size_t>(part)] = static_cast<int>(row_range.count * col_range.count);
+  }
+  packed_ = Partition(std::move(counts));
+}
+
+std::pair<int, int> ppc::dist::GetGridShape(int num_parts) {
+  CheckNumParts(num_parts);
+  int cols = 1;
+  for (int candidate = 1; candidate * candidate <= num_parts; candidate++) {
+    if (num_parts % candidate == 0) {
+      cols = candidate;
+    }
+  }
+  return {num_parts / cols, cols};
+}
@@ -0,0 +1,350 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "dist/include/allreduce.hpp"
+#include "dist/include/block_range.hpp"
+#include "dist/include/distribute.hpp"
+#include "dist/include/node_collectives.hpp"
+#include "dist/include/partition.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::dist {
+
+TEST(BlockRangeTest, CoversTheWholeRangeInOrder) {
+  std::size_t next = 0;
+  for (int part = 0; part < 4; part++) {
+    const auto range = ppc::dist::GetBlockRange(10, 4, part);
+    EXPECT_EQ(range.begin, next);
+    EXPECT_EQ(range.count, part < 2 ? 3U : 2U);
+    next += range.count;
+  }
+  EXPECT_EQ(next, 10U);
+  EXPECT_EQ(ppc::dist::GetBlockRange(2, 4, 3).count, 0U);
+}
+
+TEST(PartitionTest, BlockIsBalancedAndMatchesGetBlockRange) {
+  const auto partition = Partition::Block(10, 4);
+  EXPECT_EQ(partition.GetCounts(), (std::vector{3, 3, 2, 2}));
+  EXPECT_EQ(partition.GetDispls(), (std::vector{0, 3, 6, 8}));
+  EXPECT_EQ(partition.GetTotal(), 10U);
+  for (int part = 0; part < 4; part++) {
+    EXPECT_EQ(partition.GetRange(part).begin, ppc::dist::GetBlockRange(10, 4, part).begin);
+    EXPECT_EQ(partition.GetRange(part).count, ppc::dist::GetBlockRange(10, 4, part).count);
+  }
+  EXPECT_EQ(Partition::Block(2, 4).GetCounts(), (std::vector{1, 1, 0, 0}));
+  EXPECT_EQ(Partition::BlockRows(5, 3, 2).GetCounts(), (std::vector{9, 6}));
+  EXPECT_EQ(Partition::BlockRows(5, 3, 2).GetDispls(), (std::vector{0, 9}));
+}
+
+TEST(PartitionTest, GetOwnerSkipsEmptyParts) {
+  const Partition partition({2, 0, 3, 0});
+  EXPECT_EQ(partition.GetOwner(0), 0);
+  EXPECT_EQ(partition.GetOwner(1), 0);
+  EXPECT_EQ(partition.GetOwner(2), 2);
+  EXPECT_EQ(partition.GetOwner(4), 2);
+  EXPECT_EQ(partition.GetOwner(5), -1);
+
+  const Partition gaps({1, 1}, {1, 4});
+  EXPECT_EQ(gaps.GetOwner(0), -1);
+  EXPECT_EQ(gaps.GetOwner(1), 0);
+  EXPECT_EQ(gaps.GetOwner(2), -1);
+  EXPECT_EQ(gaps.GetOwner(4), 1);
+  EXPECT_EQ(gaps.GetTotal(), 5U);
+}
+
+TEST(PartitionTest, RejectsInvalidShapes) {
+  EXPECT_THROW(Partition::Block(10, 0), std::invalid_argument);
+  EXPECT_THROW(Partition({1, -1}), std::invalid_argument);
+  EXPECT_THROW(Partition({1, 1}, {0}), std::invalid_argument);
+  EXPECT_THROW(Partition::Block(static_cast<std::size_t>(std::numeric_limits<int>::max()) + 1, 2),
+               std::overflow_error);
+  EXPECT_THROW(BlockCyclicPartition(10, 2, 0), std::invalid_argument);
+  EXPECT_THROW(GridPartition(4, 4, 0, 2), std::invalid_argument);
+}
+
+TEST(PartitionTest, HaloPartsOverlapTheirNeighbours) {
+  const HaloPartition partition(10, 3, 2);
+  // Blocks [0, 4), [4, 7), [7, 10)
+  EXPECT_EQ(partition.GetOwned().GetCounts(), (std::vector{4, 3, 3}));
+  EXPECT_EQ(partition.GetExtended().GetDispls(), (std::vector{0, 2, 5}));
+  EXPECT_EQ(partition.GetExtended().GetCounts(), (std::vector{6, 7, 5}));
+  EXPECT_EQ(partition.GetOwnedOffset(0), 0U);
+  EXPECT_EQ(partition.GetOwnedOffset(1), 2U);
+  EXPECT_EQ(partition.GetOwnedOffset(2), 2U);
+  EXPECT_EQ(partition.GetExtended().GetOwner(3), 0);
+
+  // Parts without elements get no halo either
+  const HaloPartition sparse(2, 4, 1);
+  EXPECT_EQ(sparse.GetExtended().GetCounts(), (std::vector{2, 2, 0, 0}));
+}
+
+TEST(PartitionTest, BlockCyclicDealsBlocksInTurn) {
+  const BlockCyclicPartition partition(10, 2, 2);
+  // Blocks [0, 2) [2, 4) [4, 6) [6, 8) [8, 10) go to parts 0 1 0 1 0
+  EXPECT_EQ(partition.GetPacked().GetCounts(), (std::vector{6, 4}));
+  EXPECT_EQ(partition.GetOwner(5), 0);
+  EXPECT_EQ(partition.GetOwner(6), 1);
+
+  std::vector<int> global(10);
+  std::iota(global.begin(), global.end(), 0);
+  const auto packed = partition.Pack<int>(global);
+  EXPECT_EQ(packed, (std::vector{0, 1, 4, 5, 8, 9, 2, 3, 6, 7}));
+  for (int part = 0; part < 2; part++) {
+    const auto range = partition.GetPacked().GetRange(part);
+    for (std::size_t local = 0; local < range.count; local++) {
+      EXPECT_EQ(static_cast<std::size_t>(packed[range.begin + local]), partition.GetGlobalIndex(part, local));
+    }
+  }
+
+  std::vector<int> restored(10);
+  partition.Unpack<int>(packed, restored);
+  EXPECT_EQ(restored, global);
+}
+
+TEST(PartitionTest, GridSplitsRowsAndColumnsIntoBlocks) {
+  EXPECT_EQ(GetGridShape(6), (std::pair{3, 2}));
+  EXPECT_EQ(GetGridShape(7), (std::pair{7, 1}));
+  EXPECT_EQ(GetGridShape(16), (std::pair{4, 4}));
+
+  const GridPartition partition(3, 4, 4);
+  ASSERT_EQ(partition.GetGridRows(), 2);
+  ASSERT_EQ(partition.GetGridCols(), 2);
+  // Rows {0, 1} and {2}, columns {0, 1} and {2, 3}
+  EXPECT_EQ(partition.GetPacked().GetCounts(), (std::vector{4, 4, 2, 2}));
+  EXPECT_EQ(partition.GetRowRange(3).begin, 2U);
+  EXPECT_EQ(partition.GetColRange(3).begin, 2U);
+
+  std::vector<int> matrix(12);
+  std::iota(matrix.begin(), matrix.end(), 0);
+  const auto packed = partition.Pack<int>(matrix);
+  EXPECT_EQ(packed, (std::vector{0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 10, 11}));
+  std::vector<int> restored(12);
+  partition.Unpack<int>(packed, restored);
+  EXPECT_EQ(restored, matrix);
+}
+
+TEST(AllreduceTest, SelectsAlgorithmBySizeAndRanks) {
+  constexpr std::size_t kMiB = std::size_t{1} << 20;
+  // Short vectors and fewer elements than ranks: latency-bound
+  EXPECT_EQ(SelectAllreduceAlgorithm(1024, 256, 8), AllreduceAlgorithm::kRecursiveDoubling);
+  EXPECT_EQ(SelectAllreduceAlgorithm(kMiB, 4, 8), AllreduceAlgorithm::kRecursiveDoubling);
+  // Long vectors: bandwidth-bound
+  EXPECT_EQ(SelectAllreduceAlgorithm(kMiB, kMiB / 4, 8), AllreduceAlgorithm::kRabenseifner);
+  EXPECT_EQ(SelectAllreduceAlgorithm(64 * kMiB, 16 * kMiB, 8), AllreduceAlgorithm::kRabenseifner);
+  EXPECT_EQ(SelectAllreduceAlgorithm(kMiB / 2, kMiB / 8, 6), AllreduceAlgorithm::kRabenseifner);
+  EXPECT_EQ(SelectAllreduceAlgorithm(64 * kMiB, 16 * kMiB, 6), AllreduceAlgorithm::kRing);
+  EXPECT_EQ(GetAllreduceAlgorithmName(AllreduceAlgorithm::kRing), "ring");
+}
+
+namespace {
+
+int GetWorldRank() {
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  return rank;
+}
+
+int GetWorldSize() {
+  int size = 0;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  return size;
+}
+
+// Totals with an empty array, empty last ranks, an uneven split and a longer uneven split
+std::vector<std::size_t> GetTestTotals(int size) {
+  const auto ranks = static_cast<std::size_t>(size);
+  return {0, ranks - 1, (2 * ranks) + 1, (7 * ranks) + 3};
+}
+
+std::vector<int> MakeIota(std::size_t total) {
+  std::vector<int> values(total);
+  std::iota(values.begin(), values.end(), 1);
+  return values;
+}
+
+}  // namespace
+
+TEST(DistributeMpiTest, ScatterAndGatherRoundTripUnevenBlocks) {
+  if (!ppc::util::IsUnderMpirun()) {
+    GTEST_SKIP() << "Needs mpirun";
+  }
+  const int rank = GetWorldRank();
+  const int size = GetWorldSize();
+  for (const int root : {0, size - 1}) {
+    for (const std::size_t total : GetTestTotals(size)) {
+      const auto global = MakeIota(total);
+      const auto partition = Partition::Block(total, size);
+      const std::vector<int> empty;
+      const auto local = Scatter<int>(partition, rank == root ? global : empty, root);
+
+      const auto range = partition.GetRange(rank);
+      ASSERT_EQ(local.size(), range.count);
+      for (std::size_t i = 0; i < local.size(); i++) {
+        EXPECT_EQ(local[i], global[range.begin + i]) << "total " << total << ", index " << i;
+      }
+
+      std::vector<int> gathered(rank == root ? total : 0);
+      Gather<int>(partition, local, gathered, root);
+      if (rank == root) {
+        EXPECT_EQ(gathered, global) << "total " << total;
+      }
+    }
+  }
+}
+
+TEST(DistributeMpiTest, AllgatherCollectsEveryBlockOnEveryRank) {
+  if (!ppc::util::IsUnderMpirun()) {
+    GTEST_SKIP() << "Needs mpirun";
+  }
+  const int rank = GetWorldRank();
+  const int size = GetWorldSize();
+  for (const std::size_t total : GetTestTotals(size)) {
+    const auto global = MakeIota(total);
+    const auto partition = Partition::Block(total, size);
+    const auto range = partition.GetRange(rank);
+    const std::vector<int> local(global.begin() + static_cast<std::ptrdiff_t>(range.begin),
+                                 global.begin() + static_cast<std::ptrdiff_t>(range.begin + range.count));
+
+    std::vector<int> gathered(total);
+    Allgather<int>(partition, local, gathered);
+    EXPECT_EQ(gathered, global) << "total " << total;
+  }
+}
+
+TEST(DistributeMpiTest, ExchangeHalosFillsHalosFromTheOwningRanks) {
+  if (!ppc::util::IsUnderMpirun()) {
+    GTEST_SKIP() << "Needs mpirun";
+  }
+  const int rank = GetWorldRank();
+  const int size = GetWorldSize();
+  const auto ranks = static_cast<std::size_t>(size);
+  // A halo of 2 around blocks of one element is filled from the ranks further away
+  for (const auto &[total, halo] : std::vector<std::pair<std::size_t, std::size_t>>{
+           {(3 * ranks) + 1, 1}, {(3 * ranks) + 1, 2}, {ranks, 2}, {ranks - 1, 1}}) {
+    const auto global = MakeIota(total);
+    const HaloPartition partition(total, size, halo);
+    const auto extended = partition.GetExtended().GetRange(rank);
+    const auto owned = partition.GetOwned().GetRange(rank);
+    if (rank == 0) {
+      EXPECT_EQ(partition.GetOwnedOffset(rank), 0U);
+    }
+    if (rank == size - 1) {
+      EXPECT_EQ(extended.begin + extended.count, total);
+    }
+
+    // Only the block is known before the exchange; the halos hold a marker
+    std::vector<int> local(extended.count, -1);
+    const std::size_t offset = partition.GetOwnedOffset(rank);
+    for (std::size_t i = 0; i < owned.count; i++) {
+      local[offset + i] = global[owned.begin + i];
+    }
+    ExchangeHalos<int>(partition, local);
+
+    for (std::size_t i = 0; i < local.size(); i++) {
+      EXPECT_EQ(local[i], global[extended.begin + i]) << "total " << total << ", halo " << halo << ", index " << i;
+    }
+  }
+}
+
+TEST(DistributeMpiTest, RejectsLocalBuffersOfTheWrongSize) {
+  if (!ppc::util::IsUnderMpirun()) {
+    GTEST_SKIP() << "Needs mpirun";
+  }
+  const int size = GetWorldSize();
+  const auto global = MakeIota(static_cast<std::size_t>(size));
+  const auto partition = Partition::Block(global.size(), size);
+  std::vector<int> local(2);
+  EXPECT_THROW(Scatter<int>(partition, global, local), std::invalid_argument);
+}
+
+TEST(NodeCollectivesMpiTest, SharedCollectivesMatchPlainMpiOnEmulatedNodes) {
+  if (!ppc::util::IsUnderMpirun()) {
+    GTEST_SKIP() << "Needs mpirun";
+  }
+  const int rank = GetWorldRank();
+  const int size = GetWorldSize();
+  // Neighbouring ranks on one node, and interleaved nodes whose ranks are not contiguous
+  for (const bool interleaved : {false, true}) {
+    const NodeTopology topology(MPI_COMM_WORLD, interleaved ? rank % 2 : rank / 2);
+    EXPECT_EQ(topology.GetNumNodes(), interleaved ? std::min(size, 2) : (size + 1) / 2);
+    for (const int root : {0, size - 1}) {
+      for (const std::size_t total : GetTestTotals(size)) {
+        const auto global = MakeIota(total);
+        std::vector<int> expected = rank == root ? global : std::vector<int>(total);
+        MPI_Bcast(expected.data(), static_cast<int>(total), MPI_INT, root, MPI_COMM_WORLD);
+
+        const std::vector<int> empty;
+        const auto shared = BcastShared<int>(rank == root ? global : empty, root, topology);
+        const auto view = shared.Get();
+        EXPECT_EQ(std::vector<int>(view.begin(), view.end()), expected) << "total " << total << ", root " << root;
+
+        const auto partition = Partition::Block(total, size);
+        const auto block = Scatter<int>(partition, rank == root ? global : empty, root);
+        const auto shared_block = ScatterShared<int>(partition, rank == root ? global : empty, root, topology);
+        const auto block_view = shared_block.Get();
+        EXPECT_EQ(std::vector<int>(block_view.begin(), block_view.end()), block)
+            << "total " << total << ", root " << root;
+      }
+    }
+  }
+}
+
+TEST(AllreduceMpiTest, EveryAlgorithmMatchesMpiAllreduce) {
+  if (!ppc::util::IsUnderMpirun()) {
+    GTEST_SKIP() << "Needs mpirun";
+  }
+  const int world_rank = GetWorldRank();
+  const int world_size = GetWorldSize();
+  // All ranks, and all but the last one, so that a power-of-two run also covers the folding of extra ranks
+  MPI_Comm fewer = MPI_COMM_NULL;
+  MPI_Comm_split(MPI_COMM_WORLD, world_rank < world_size - 1 || world_size == 1 ? 0 : MPI_UNDEFINED, world_rank,
+                 &fewer);
+  for (MPI_Comm comm : {MPI_COMM_WORLD, fewer}) {
+    if (comm == MPI_COMM_NULL) {
+      continue;
+    }
+    int rank = 0;
+    int size = 0;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    const auto ranks = static_cast<std::size_t>(size);
+    for (const auto algorithm : {AllreduceAlgorithm::kRecursiveDoubling, AllreduceAlgorithm::kRing,
+                                 AllreduceAlgorithm::kRabenseifner, AllreduceAlgorithm::kAuto}) {
+      // Fewer elements than ranks, odd counts and counts that do not split evenly over the ranks
+      for (const std::size_t count : {std::size_t{1}, std::size_t{3}, ranks + 1, (5 * ranks) + 3, std::size_t{1001}}) {
+        std::vector<int> data(count);
+        for (std::size_t i = 0; i < count; i++) {
+          data[i] = static_cast<int>(((i + 1) * 31) + (static_cast<std::size_t>(rank) * 7)) % 97;
+        }
+        std::vector<int> expected_sum(count);
+        std::vector<int> expected_max(count);
+        MPI_Allreduce(data.data(), expected_sum.data(), static_cast<int>(count), MPI_INT, MPI_SUM, comm);
+        MPI_Allreduce(data.data(), expected_max.data(), static_cast<int>(count), MPI_INT, MPI_MAX, comm);
+
+        auto sum = data;
+        Allreduce<int>(sum, std::plus<>{}, comm, algorithm);
+        EXPECT_EQ(sum, expected_sum) << GetAllreduceAlgorithmName(algorithm) << ", " << size << " ranks, count "
+                                     << count;
+        auto max = data;
+        Allreduce<int>(max, [](int a, int b) { return std::max(a, b); }, comm, algorithm);
+        EXPECT_EQ(max, expected_max) << GetAllreduceAlgorithmName(algorithm) << ", " << size << " ranks, count "
+                                     << count;
+      }
+    }
+  }
+  if (fewer != MPI_COMM_NULL) {
+    MPI_Comm_free(&fewer);
+  }
+}
+
+}  // namespace ppc::dist
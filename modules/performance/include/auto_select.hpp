@@ -0,0 +1,233 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "performance/include/perf_results_writer.hpp"
+#include "performance/include/performance.hpp"
+#include "task/include/task.hpp"
+#include "task/include/task_registry.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::performance {
+
+/// @brief Implementation that is the fastest from a given input size on.
+struct SelectionThreshold {
+  /// Smallest input size the implementation is selected for
+  std::size_t min_input_size = 0;
+  /// Selected implementation
+  ppc::task::TypeOfTask type_of_task = ppc::task::TypeOfTask::kUnknown;
+};
+
+/// @brief Crossover points between the implementations of one task for one host and worker count.
+struct SelectionTable {
+  /// Thresholds by ascending min_input_size; the first one starts at 0
+  std::vector<SelectionThreshold> thresholds;
+
+  /// @brief Returns the implementation for an input of `input_size` elements, kUnknown if the table is empty.
+  [[nodiscard]] ppc::task::TypeOfTask Select(std::size_t input_size) const;
+};
+
+/// @brief Pipeline time of one implementation on one input size, taken on the slowest rank.
+struct ImplementationTiming {
+  /// Number of input elements
+  std::size_t input_size = 0;
+  /// Implementation that was timed
+  ppc::task::TypeOfTask type_of_task = ppc::task::TypeOfTask::kUnknown;
+  /// Fastest pipeline time in seconds
+  double time_sec = 0.0;
+};
+
+/// @brief Derives crossover thresholds from benchmark timings.
+/// @details The fastest implementation at a benchmarked size is selected from that size up to the next
+/// benchmarked size; neighbouring sizes with the same winner share one threshold. Below the smallest benchmarked
+/// size its winner is used.
+SelectionTable BuildSelectionTable(const std::vector<ImplementationTiming> &timings);
+
+/// @brief Serializes a selection table.
+nlohmann::json SelectionTableToJson(const SelectionTable &table);
+
+/// @brief Parses a selection table written by SelectionTableToJson().
+/// @throws std::exception If the JSON does not describe a table.
+SelectionTable SelectionTableFromJson(const nlohmann::json &json);
+
+/// @brief Returns the cache key of a task: "<namespace>/np<ranks>/t<PPC_NUM_THREADS>".
+/// @details Crossovers depend on the number of workers, so every combination is benchmarked separately.
+std::string GetSelectionKey(const std::string &task_namespace);
+
+/// @brief Returns the selection cache file of a host: "<PPC_CALIBRATION_DIR>/<host>.selection.json".
+std::string GetSelectionCachePath(const std::string &host);
+
+/// @brief Reads the cached table of a task on this host for the current worker count.
+/// @details Collective when MPI is initialized: rank 0 reads its host's cache and broadcasts the table, so that
+/// every rank routes inputs identically.
+/// @return Cached table, or an empty optional if there is none or the cache is unreadable.
+std::optional<SelectionTable> LoadSelectionTable(const std::string &task_namespace);
+
+/// @brief Waits until every rank has arrived, so that benchmark timers start together; no-op without MPI.
+void SynchronizeBenchmarkRanks();
+
+/// @brief Returns true if `done` holds on every rank; collective when MPI is initialized.
+bool AllRanksDone(bool done);
+
+/// @brief Stores the table of a task in the cache of this host, keeping the entries of other tasks.
+/// @details Only rank 0 writes; collective over MPI_COMM_WORLD when MPI is initialized.
+/// @throws std::runtime_error On every rank if rank 0 cannot write the cache file.
+void SaveSelectionTable(const std::string &task_namespace, const SelectionTable &table);
+
+template <typename InType, typename OutType>
+/// @brief Routes every input to the implementation that is the fastest for its size on this host.
+/// @details The implementations are benchmarked once per host and worker count over a set of input sizes, and
+/// the crossover thresholds are cached (see LoadSelectionTable()). Inputs must have the same size on every rank,
+/// as they do for tasks created by the test framework; otherwise ranks could pick different implementations.
+/// @tparam InType Input data type.
+/// @tparam OutType Output data type.
+class AutoSelector {
+ public:
+  using TaskFactory = std::function<ppc::task::TaskPtr<InType, OutType>(InType)>;
+
+  /// @brief One implementation to choose from.
+  struct Implementation {
+    /// Technology of the implementation
+    ppc::task::TypeOfTask type_of_task = ppc::task::TypeOfTask::kUnknown;
+    /// Creates a task of the implementation
+    TaskFactory make_task;
+  };
+
+  /// @param task_namespace Namespace of the task, used as its cache key.
+  /// @param implementations Candidates; the first one is used while no table is available.
+  AutoSelector(std::string task_namespace, std::vector<Implementation> implementations)
+      : task_namespace_(std::move(task_namespace)), implementations_(std::move(implementations)) {
+    if (implementations_.empty()) {
+      throw std::invalid_argument("AutoSelector needs at least one implementation");
+    }
+  }
+
+  /// @brief Loads the cached thresholds of this host, or benchmarks the implementations and caches them.
+  /// @details Collective when MPI is initialized.
+  /// @param make_input Returns an input of the given size; every implementation must accept it.
+  /// @param sizes Input sizes to benchmark.
+  /// @param repetitions Pipelines per implementation and size; the fastest one counts.
+  void Calibrate(const std::function<InType(std::size_t)> &make_input, const std::vector<std::size_t> &sizes,
+                 int repetitions = 3) {
+    if (auto cached = LoadSelectionTable(task_namespace_)) {
+      table_ = std::move(*cached);
+      return;
+    }
+    table_ = BuildSelectionTable(Benchmark(make_input, sizes, repetitions));
+    SaveSelectionTable(task_namespace_, table_);
+  }
+
+  /// @brief Times the full pipeline of every implementation on inputs of every size; collective under MPI.
+  /// @details Ranks start every timed pipeline together and agree on its outcome, so that all of them throw when
+  /// one rank fails. A failed task is aborted before the exception leaves.
+  /// @throws std::runtime_error If an implementation rejects an input on any rank; the exception of a stage is
+  /// rethrown on the rank that raised it.
+  std::vector<ImplementationTiming> Benchmark(const std::function<InType(std::size_t)> &make_input,
+                                              const std::vector<std::size_t> &sizes, int repetitions) const {
+    std::vector<ImplementationTiming> timings;
+    for (const auto size : sizes) {
+      const InType input = make_input(size);
+      for (const auto &implementation : implementations_) {
+        double best_sec = std::numeric_limits<double>::max();
+        for (int repetition = 0; repetition < std::max(repetitions, 1); repetition++) {
+          auto task = implementation.make_task(input);
+          task->GetStateOfTesting() = ppc::task::StateOfTesting::kPerf;
+          bool done = false;
+          std::exception_ptr error;
+          SynchronizeBenchmarkRanks();
+          const auto start = std::chrono::steady_clock::now();
+          try {
+            done = ppc::task::RunPipeline(*task);
+          } catch (...) {
+            error = std::current_exception();
+          }
+          const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+          best_sec = std::min(best_sec, elapsed.count());
+          if (!AllRanksDone(done)) {
+            if (error) {
+              std::rethrow_exception(error);
+            }
+            throw std::runtime_error("AutoSelector: " + ppc::task::TypeOfTaskToString(implementation.type_of_task) +
+                                     " implementation of " + task_namespace_ + " rejected an input of size " +
+                                     std::to_string(size));
+          }
+        }
+        timings.push_back({.input_size = GetInputSize(input),
+                           .type_of_task = implementation.type_of_task,
+                           .time_sec = GatherRankStatistics(best_sec).max_sec});
+      }
+    }
+    return timings;
+  }
+
+  /// @brief Returns the thresholds in use.
+  [[nodiscard]] const SelectionTable &GetTable() const {
+    return table_;
+  }
+
+  /// @brief Replaces the thresholds, e.g. with a table benchmarked elsewhere.
+  void SetTable(SelectionTable table) {
+    table_ = std::move(table);
+  }
+
+  /// @brief Returns the implementation `in` is routed to.
+  [[nodiscard]] ppc::task::TypeOfTask Select(const InType &in) const {
+    return FindImplementation(table_.Select(GetInputSize(in))).type_of_task;
+  }
+
+  /// @brief Creates the task of the fastest implementation for the size of `in`.
+  ppc::task::TaskPtr<InType, OutType> MakeTask(InType in) const {
+    const auto &implementation = FindImplementation(table_.Select(GetInputSize(in)));
+    return implementation.make_task(std::move(in));
+  }
+
+ private:
+  // Implementations missing from the table, e.g. after it was benchmarked with others, fall back to the first one
+  const Implementation &FindImplementation(ppc::task::TypeOfTask type_of_task) const {
+    const auto it = std::ranges::find(implementations_, type_of_task, &Implementation::type_of_task);
+    return it != implementations_.end() ? *it : implementations_.front();
+  }
+
+  std::string task_namespace_;
+  std::vector<Implementation> implementations_;
+  SelectionTable table_;
+};
+
+/// @brief Creates an AutoSelector over the given implementations of one task.
+/// @tparam InType Input data type.
+/// @tparam TaskTypes Implementations, e.g. `<InType, NsTaskMPI, NsTaskSEQ>`; the first one is the fallback.
+template <typename InType, typename... TaskTypes>
+auto MakeAutoSelector() {
+  using FirstTask = std::tuple_element_t<0, std::tuple<TaskTypes...>>;
+  using OutType = ppc::task::TaskOutputType<FirstTask>;
+  using Selector = AutoSelector<InType, OutType>;
+  return Selector(ppc::util::GetNamespace<FirstTask>(),
+                  {typename Selector::Implementation{.type_of_task = TaskTypes::GetStaticTypeOfTask(),
+                                                     .make_task = ppc::task::TaskGetter<TaskTypes, InType>}...});
+}
+
+/// @brief Creates an AutoSelector over every implementation of a task in the TaskRegistry.
+/// @details Candidates come in TypeOfTask order, so the first registered one is the fallback.
+/// @throws std::invalid_argument If the task has no registered implementation or other data types.
+template <typename InType, typename OutType>
+AutoSelector<InType, OutType> MakeRegisteredAutoSelector(const std::string &task_namespace) {
+  using Selector = AutoSelector<InType, OutType>;
+  std::vector<typename Selector::Implementation> implementations;
+  for (auto &registered : ppc::task::TaskRegistry::Instance().GetImplementations<InType, OutType>(task_namespace)) {
+    implementations.push_back({.type_of_task = registered.type_of_task, .make_task = std::move(registered.make_task)});
+  }
+  return Selector(task_namespace, std::move(implementations));
+}
+
+}  // namespace ppc::performance
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dist/include/allreduce.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::performance {
+
+/// @brief Achievable hardware throughput of one host, measured by RunCalibration().
+struct CalibrationResults {
+  /// @brief Host the measurements were taken on.
+  std::string host;
+  /// @brief Threads used by the STREAM triad (PPC_NUM_THREADS).
+  int num_threads = 1;
+  /// @brief Physical cores of the host; SMT siblings count once (hardware threads where the topology is unknown).
+  int num_cores = 1;
+  /// @brief Number of MPI ranks taking part in the network measurements.
+  int num_ranks = 1;
+  /// @brief Best STREAM triad bandwidth over the OpenMP and TBB variants, bytes per second.
+  double stream_triad_bytes_per_sec = 0.0;
+  /// @brief STREAM triad bandwidth with OpenMP, bytes per second.
+  double stream_triad_omp_bytes_per_sec = 0.0;
+  /// @brief STREAM triad bandwidth with TBB, bytes per second.
+  double stream_triad_tbb_bytes_per_sec = 0.0;
+  /// @brief Floating-point rate of one core, FLOP per second.
+  double peak_flops_per_core = 0.0;
+  /// @brief Half round-trip time of a small ping-pong message between ranks 0 and 1 (0 with one rank).
+  double mpi_latency_sec = 0.0;
+  /// @brief Ping-pong bandwidth of a large message between ranks 0 and 1 (0 with one rank).
+  double mpi_bandwidth_bytes_per_sec = 0.0;
+  /// @brief MPI_Allreduce (MPI_SUM of doubles) time on MPI_COMM_WORLD per message size in bytes.
+  std::vector<std::pair<std::size_t, double>> allreduce_sec;
+  /// @brief The same sweep with ppc::dist::Allreduce, per algorithm name (see GetAllreduceAlgorithmName()).
+  std::map<std::string, std::vector<std::pair<std::size_t, double>>> dist_allreduce_sec;
+
+  /// @brief Node floating-point ceiling: per-core rate times the number of physical cores.
+  [[nodiscard]] double PeakFlops() const {
+    return peak_flops_per_core * static_cast<double>(num_cores);
+  }
+};
+
+/// @brief Result of a ping-pong measurement.
+struct PingPongResult {
+  /// @brief Mean half round-trip time in seconds.
+  double half_round_trip_sec = 0.0;
+  /// @brief Message size divided by the half round-trip time, bytes per second.
+  double bandwidth_bytes_per_sec = 0.0;
+};
+
+/// @brief Measures the STREAM triad a = b + s * c with OpenMP.
+/// @param num_elements Length of each of the three arrays; should exceed the last-level cache several times.
+/// @param repetitions Number of timed triads; the fastest one is reported.
+/// @return Bandwidth in bytes per second (three arrays of doubles per triad).
+double MeasureStreamTriadOmp(std::size_t num_elements, int repetitions);
+
+/// @brief Measures the STREAM triad with TBB; see MeasureStreamTriadOmp().
+double MeasureStreamTriadTbb(std::size_t num_elements, int repetitions);
+
+/// @brief Counts the physical cores of the host from the Linux CPU topology, SMT siblings once.
+/// @return Number of cores; the hardware thread count where the topology is not exposed.
+int CountPhysicalCores();
+
+/// @brief Measures the floating-point rate of the calling thread with independent multiply-add chains.
+/// @param iterations Number of iterations of the kernel.
+/// @return FLOP per second.
+double MeasurePeakFlopsPerCore(std::uint64_t iterations);
+
+/// @brief Ping-pong between ranks 0 and 1 of MPI_COMM_WORLD; collective, other ranks only wait.
+/// @details All ranks receive the result. Returns zeros when MPI is not initialized or has a single rank.
+PingPongResult MeasurePingPong(std::size_t message_bytes, int iterations);
+
+/// @brief Times MPI_Allreduce on MPI_COMM_WORLD for each message size; collective.
+/// @return (message bytes, slowest rank's mean time in seconds) per size.
+std::vector<std::pair<std::size_t, double>> MeasureAllreduceSweep(const std::vector<std::size_t> &message_bytes,
+                                                                  int iterations);
+
+/// @brief Times ppc::dist::Allreduce with `algorithm` like MeasureAllreduceSweep(), to compare it with the
+/// MPI library's MPI_Allreduce; collective.
+std::vector<std::pair<std::size_t, double>> MeasureDistAllreduceSweep(const std::vector<std::size_t> &message_bytes,
+                                                                      int iterations,
+                                                                      ppc::dist::AllreduceAlgorithm algorithm);
+
+/// @brief Runs the full calibration suite; collective over MPI_COMM_WORLD when MPI is initialized.
+CalibrationResults RunCalibration();
+
+/// @brief Serializes calibration results.
+nlohmann::json CalibrationToJson(const CalibrationResults &results);
+
+/// @brief Parses calibration results written by CalibrationToJson().
+CalibrationResults CalibrationFromJson(const nlohmann::json &json);
+
+/// @brief Returns the cache file of a host: "<PPC_CALIBRATION_DIR>/<host>.json".
+std::string GetCalibrationPath(const std::string &host);
+
+/// @brief Writes results to the cache file of their host.
+/// @throws std::runtime_error If the file cannot be written.
+void SaveCalibration(const CalibrationResults &results);
+
+/// @brief Reads the cached calibration of a host.
+/// @return Cached results, or an empty optional if the host has not been calibrated or the file is unreadable.
+std::optional<CalibrationResults> LoadCalibration(const std::string &host);
+
+}  // namespace ppc::performance
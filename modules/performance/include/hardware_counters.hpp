@@ -0,0 +1,118 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace ppc::performance {
+
+/// @brief Hardware and software events recorded around timed perf iterations.
+enum class CounterEvent : uint8_t {
+  /// CPU cycles
+  kCycles,
+  /// Retired instructions
+  kInstructions,
+  /// Last-level cache misses
+  kLlcMisses,
+  /// Mispredicted branches
+  kBranchMisses,
+  /// CPU time of the task in nanoseconds
+  kTaskClock,
+  /// Number of events (not an event)
+  kCount
+};
+
+inline constexpr std::array<std::string_view, static_cast<std::size_t>(CounterEvent::kCount)> kCounterEventNames = {
+    "cycles", "instructions", "llc_misses", "branch_misses", "task_clock_ns"};
+
+/// @brief Count of every event, indexed by CounterEvent; an empty optional means the event could not be measured.
+using CounterArray = std::array<std::optional<double>, static_cast<std::size_t>(CounterEvent::kCount)>;
+
+/// @brief Per-iteration counter values of one run.
+struct CounterValues {
+  /// @brief True if counters were requested for the run.
+  bool collected = false;
+  /// @brief Number of MPI ranks in rank_values.
+  int num_ranks = 1;
+  /// @brief Mean count per timed iteration, summed over rank_values once gathered.
+  CounterArray values{};
+  /// @brief Mean count per timed iteration of every rank, filled by GatherCountersAcrossRanks().
+  std::vector<CounterArray> rank_values;
+  /// @brief Input elements per iteration that the derived per-element metrics divide by (0 if unknown).
+  std::size_t input_elements = 0;
+
+  /// @brief Returns the value of an event, if measured.
+  [[nodiscard]] std::optional<double> Get(CounterEvent event) const {
+    return values.at(static_cast<std::size_t>(event));
+  }
+
+  /// @brief True if at least one event was measured.
+  [[nodiscard]] bool IsAvailable() const {
+    for (const auto &value : values) {
+      if (value.has_value()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// @brief Instructions per cycle, if both events were measured.
+  [[nodiscard]] std::optional<double> Ipc() const {
+    const auto cycles = Get(CounterEvent::kCycles);
+    const auto instructions = Get(CounterEvent::kInstructions);
+    if (!cycles || !instructions || *cycles <= 0.0) {
+      return std::nullopt;
+    }
+    return *instructions / *cycles;
+  }
+
+  /// @brief Last-level cache misses per input element, if the event was measured and the input size is known.
+  [[nodiscard]] std::optional<double> LlcMissesPerElement() const {
+    const auto llc_misses = Get(CounterEvent::kLlcMisses);
+    if (!llc_misses || input_elements == 0) {
+      return std::nullopt;
+    }
+    return *llc_misses / static_cast<double>(input_elements);
+  }
+};
+
+/// @brief perf_event_open counters for all threads of the calling process.
+/// @details Opens one event group on every thread that exists at construction, so worker pools that OpenMP or
+/// TBB created earlier are counted, and threads spawned later inherit the group of their creator. Events that
+/// the kernel refuses (perf_event_paranoid, missing PMU in VMs, non-Linux platforms) are silently reported as
+/// unavailable, so runs never fail because of counters.
+class HardwareCounters {
+ public:
+  /// @brief Opens the events on every thread of the process; counting starts with Start().
+  HardwareCounters();
+  ~HardwareCounters();
+  HardwareCounters(const HardwareCounters &) = delete;
+  HardwareCounters &operator=(const HardwareCounters &) = delete;
+  HardwareCounters(HardwareCounters &&) = delete;
+  HardwareCounters &operator=(HardwareCounters &&) = delete;
+
+  /// @brief True if at least one event could be opened.
+  [[nodiscard]] bool IsAvailable() const;
+
+  /// @brief Resets and enables all opened events.
+  void Start();
+
+  /// @brief Disables all events and returns their totals over all threads divided by iterations.
+  /// @param iterations Number of iterations executed between Start() and Stop().
+  CounterValues Stop(uint64_t iterations);
+
+ private:
+  // File descriptors of one event group per thread, -1 for events the kernel refused; the first open one leads
+  std::vector<std::array<int, static_cast<std::size_t>(CounterEvent::kCount)>> groups_;
+};
+
+/// @brief Collects the counter values of every rank of MPI_COMM_WORLD.
+/// @details Fills rank_values with the values of each rank and sets values to their sum; an event in the sum
+/// stays available only if every rank measured it. Collective when MPI is initialized; otherwise describes the
+/// calling rank only.
+CounterValues GatherCountersAcrossRanks(const CounterValues &local);
+
+}  // namespace ppc::performance
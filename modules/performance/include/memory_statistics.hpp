@@ -0,0 +1,40 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "task/include/memory_tracker.hpp"
+
+namespace ppc::performance {
+
+/// @brief Per-rank memory peaks of a run across MPI_COMM_WORLD.
+struct MemoryStatistics {
+  /// @brief Number of ranks that contributed a sample.
+  int num_ranks = 1;
+  /// @brief True if heap counters were collected.
+  bool heap_tracked = false;
+  /// @brief Peak RSS of each rank in bytes, indexed by rank.
+  std::vector<std::uint64_t> peak_rss_bytes;
+  /// @brief Heap peak of each rank in bytes, indexed by rank (zeros without heap tracking).
+  std::vector<std::uint64_t> heap_peak_bytes;
+  /// @brief Heap allocations of each rank, indexed by rank (zeros without heap tracking).
+  std::vector<std::uint64_t> heap_allocations;
+
+  [[nodiscard]] std::uint64_t MaxPeakRssBytes() const {
+    return peak_rss_bytes.empty() ? 0 : std::ranges::max(peak_rss_bytes);
+  }
+  [[nodiscard]] std::uint64_t MaxHeapPeakBytes() const {
+    return heap_peak_bytes.empty() ? 0 : std::ranges::max(heap_peak_bytes);
+  }
+  /// @brief Largest footprint (see ppc::task::MemorySample::Footprint()) over ranks.
+  [[nodiscard]] std::uint64_t MaxFootprint() const {
+    return heap_tracked ? MaxHeapPeakBytes() : MaxPeakRssBytes();
+  }
+};
+
+/// @brief Gathers the rank-local samples to every rank.
+/// @details Collective over MPI_COMM_WORLD when MPI is initialized; otherwise describes the local sample only.
+MemoryStatistics GatherMemoryStatistics(const ppc::task::MemorySample &local);
+
+}  // namespace ppc::performance
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <ranges>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "performance/include/performance.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::performance {
+
+/// @brief Self-contained description of one performance test result.
+/// @details Serialized as a single JSON object per line (JSON Lines) by AppendPerfRecord().
+struct PerfRecord {
+  /// @brief Full test identifier, e.g. "<namespace>_mpi_enabled".
+  std::string test_id;
+  /// @brief C++ namespace of the task implementation.
+  std::string task_namespace;
+  /// @brief Implementation technology ("seq", "mpi", "omp", ...).
+  std::string type_of_task;
+  /// @brief Perf mode ("pipeline" or "task_run").
+  std::string type_of_running;
+  /// @brief Value of PPC_NUM_PROC during the run.
+  int num_proc = 1;
+  /// @brief Value of PPC_NUM_THREADS during the run.
+  int num_threads = 1;
+  /// @brief Value of PPC_PERF_SIZE_SCALE during the run (weak scaling factor).
+  int size_scale = 1;
+  /// @brief Input size requested by a size-parameterised test (already scaled), 0 for a fixed input.
+  std::size_t requested_size = 0;
+  /// @brief Number of input elements, 0 if it cannot be derived from the input type.
+  std::size_t input_size = 0;
+  /// @brief True if every rank generated only its own block of a ppc::task::DistributedInput.
+  bool distributed_input = false;
+  /// @brief Timing statistics of the run.
+  PerfResults results;
+};
+
+template <typename T>
+/// @brief Returns the number of elements in a task input.
+/// @details Sized ranges report their size, tuple-like inputs report the sum over their members,
+/// shared buffers (ppc::task::SharedInput) report the size of the buffer, distributed inputs
+/// (ppc::task::DistributedInput) report the size of the global array, anything else is reported as 0 (unknown).
+std::size_t GetInputSize(const T &in) {
+  if constexpr (requires { in.GlobalSize(); }) {
+    return static_cast<std::size_t>(in.GlobalSize());
+  } else if constexpr (std::ranges::sized_range<const T>) {
+    return static_cast<std::size_t>(std::ranges::size(in));
+  } else if constexpr (requires { in.get(); *in; }) {
+    return in ? GetInputSize(*in) : 0;
+  } else if constexpr (requires { std::tuple_size<T>::value; }) {
+    return std::apply([](const auto &...members) { return (std::size_t{0} + ... + GetInputSize(members)); }, in);
+  } else {
+    return 0;
+  }
+}
+
+/// @brief Extracts the task namespace from a perf test id of the form "<namespace>_<type>_<status>".
+/// @param test_id Perf test identifier.
+/// @param type_of_task Implementation technology string contained in the id.
+/// @return Namespace part of the id, or the whole id if it does not contain the type.
+std::string GetTaskNamespaceFromTestId(const std::string &test_id, const std::string &type_of_task);
+
+/// @brief Returns the host name of the current machine, or "unknown".
+std::string GetHostName();
+
+/// @brief Returns the commit the binaries were built from.
+/// @details Reads PPC_GIT_SHA, then GITHUB_SHA; returns "unknown" if neither is set.
+std::string GetGitSha();
+
+/// @brief Serializes a performance record, adding host and commit information.
+nlohmann::json PerfRecordToJson(const PerfRecord &record);
+
+/// @brief Appends a record as one JSON line to the given file.
+/// @throws std::runtime_error If the file cannot be opened.
+void AppendPerfRecord(const PerfRecord &record, const std::string &output_path);
+
+/// @brief Appends a record to the file named by PPC_PERF_OUTPUT; does nothing if the variable is unset.
+void AppendPerfRecord(const PerfRecord &record);
+
+}  // namespace ppc::performance
@@ -1,14 +1,21 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
+#include "performance/include/hardware_counters.hpp"
+#include "performance/include/memory_statistics.hpp"
 #include "task/include/task.hpp"
 #include "util/include/util.hpp"
 
@@ -18,23 +25,175 @@ inline double DefaultTimer() {
   return -1.0;
 }
 
+/// @brief Amount of work done by one execution of the measured code (one iteration).
+/// @details Declared by perf tests via BaseRunPerfTests::GetWork(); zero means "not declared".
+struct PerfWork {
+  /// @brief Number of processed elements.
+  double elements = 0.0;
+  /// @brief Bytes moved to and from memory.
+  double bytes = 0.0;
+  /// @brief Floating-point operations.
+  double flops = 0.0;
+
+  /// @brief True if any work unit was declared.
+  [[nodiscard]] bool IsDeclared() const {
+    return elements > 0.0 || bytes > 0.0 || flops > 0.0;
+  }
+};
+
+/// @brief Hardware ceilings of the roofline model; zero means unknown.
+struct RooflineCeiling {
+  /// @brief Attainable memory bandwidth in bytes per second.
+  double bytes_per_sec = 0.0;
+  /// @brief Attainable floating-point rate in FLOP per second.
+  double flops_per_sec = 0.0;
+};
+
+/// @brief Achieved rates derived from PerfWork and the measured time.
+struct Throughput {
+  double elements_per_sec = 0.0;
+  double bytes_per_sec = 0.0;
+  double gflops = 0.0;
+  /// @brief Achieved fraction of the roofline bound min(peak FLOP/s, intensity * bandwidth), if the
+  /// ceilings needed for the declared work are known.
+  std::optional<double> roofline_fraction;
+};
+
+/// @brief Returns the roofline ceilings from PPC_PERF_PEAK_BANDWIDTH and PPC_PERF_PEAK_GFLOPS.
+/// @details Ceilings not set there are taken from the cached calibration of the host (see RunCalibration()).
+RooflineCeiling GetRooflineCeiling();
+
+/// @brief Converts per-iteration work into achieved rates.
+/// @param work Work done by one iteration.
+/// @param time_sec Duration of one iteration in seconds.
+/// @param ceiling Hardware ceilings used for the roofline fraction.
+Throughput ComputeThroughput(const PerfWork &work, double time_sec, const RooflineCeiling &ceiling);
+
 struct PerfAttr {
   /// @brief Number of times the task is run for performance evaluation.
   uint64_t num_running = 5;
+  /// @brief Number of untimed runs executed before measurement starts.
+  uint64_t num_warmup = 1;
+  /// @brief Record hardware counters (perf_event_open) around the timed iterations.
+  bool collect_counters = false;
+  /// @brief Work done by one iteration; enables throughput metrics when declared.
+  PerfWork work;
+  /// @brief Input elements of one iteration (the requested size of a sized perf test); normalizes the counters.
+  std::size_t input_size = 0;
   /// @brief Timer function returning current time in seconds.
   /// @cond
   std::function<double()> current_timer = DefaultTimer;
   /// @endcond
 };
 
+/// @brief Distribution of a per-rank duration across MPI_COMM_WORLD.
+struct RankStatistics {
+  /// @brief Number of ranks that contributed a value.
+  int num_ranks = 1;
+  /// @brief Fastest rank in seconds.
+  double min_sec = 0.0;
+  /// @brief Mean over ranks in seconds.
+  double mean_sec = 0.0;
+  /// @brief Slowest rank in seconds; this is the time the parallel run actually costs.
+  double max_sec = 0.0;
+  /// @brief Load imbalance ratio max/mean; 1.0 means perfectly balanced.
+  double imbalance = 1.0;
+  /// @brief True if imbalance exceeds ppc::util::GetPerfImbalanceThreshold().
+  bool imbalanced = false;
+};
+
+/// @brief Reduces a rank-local duration over MPI_COMM_WORLD.
+/// @details Collective over MPI_COMM_WORLD when MPI is initialized; otherwise describes the local value only.
+/// @param local_sec Duration measured on the calling rank.
+RankStatistics GatherRankStatistics(double local_sec);
+
+/// @brief Sets the imbalance ratio of `stats` from its max and mean and flags it if the ratio exceeds
+/// ppc::util::GetPerfImbalanceThreshold().
+void ClassifyImbalance(RankStatistics &stats);
+
 struct PerfResults {
-  /// @brief Measured execution time in seconds.
+  /// @brief Measured execution time in seconds (mean over timed iterations).
   double time_sec = 0.0;
-  enum class TypeOfRunning : uint8_t { kPipeline, kTaskRun, kNone };
+  /// @brief Fastest timed iteration in seconds.
+  double min_sec = 0.0;
+  /// @brief Median of timed iterations in seconds.
+  double median_sec = 0.0;
+  /// @brief 90th percentile of timed iterations in seconds.
+  double p90_sec = 0.0;
+  /// @brief 99th percentile of timed iterations in seconds.
+  double p99_sec = 0.0;
+  /// @brief Slowest timed iteration in seconds.
+  double max_sec = 0.0;
+  /// @brief Sample standard deviation of timed iterations in seconds.
+  double stddev_sec = 0.0;
+  /// @brief Raw per-iteration durations in seconds, in execution order (warm-up runs excluded).
+  std::vector<double> samples_sec;
+  /// @brief Mean per-stage durations over timed iterations (filled in pipeline mode only).
+  ppc::task::StageTimings stage_timings;
+  /// @brief Mean Run() duration aggregated across MPI ranks.
+  RankStatistics rank_stats;
+  /// @brief Hardware counters per timed iteration of every MPI rank and their sum (if requested via PerfAttr).
+  CounterValues counters;
+  /// @brief Work done by one iteration, as declared in PerfAttr.
+  PerfWork work;
+  /// @brief Achieved rates for the mean iteration time.
+  Throughput throughput;
+  /// @brief Per-rank memory peaks over warm-up and timed iterations.
+  MemoryStatistics memory;
+  /// @brief Per-stage memory of the last iteration on the calling rank (filled in pipeline mode only).
+  ppc::task::StageMemory stage_memory;
+  /// @brief Size of the task's scratch arena after the run on the calling rank, in bytes.
+  std::size_t scratch_bytes = 0;
+  /// @brief Heap allocations per timed iteration on the calling rank (warm mode with the heap hook linked only).
+  std::optional<double> allocations_per_iteration;
+  /// @brief kWarm repeats the whole pipeline like kPipeline, but times it only once the task's buffers are sized.
+  enum class TypeOfRunning : uint8_t { kPipeline, kTaskRun, kNone, kWarm };
   TypeOfRunning type_of_running = TypeOfRunning::kNone;
   constexpr static double kMaxTime = 10.0;
 };
 
+/// @brief Returns the q-quantile (0 <= q <= 1) of sorted samples using linear interpolation.
+inline double Percentile(const std::vector<double> &sorted_samples, double q) {
+  if (sorted_samples.empty()) {
+    return 0.0;
+  }
+  const double pos = q * static_cast<double>(sorted_samples.size() - 1);
+  const auto lower = static_cast<std::size_t>(std::floor(pos));
+  const auto upper = std::min(lower + 1, sorted_samples.size() - 1);
+  const double frac = pos - static_cast<double>(lower);
+  return sorted_samples[lower] + ((sorted_samples[upper] - sorted_samples[lower]) * frac);
+}
+
+/// @brief Fills summary statistics of PerfResults from its raw samples.
+inline void ComputeStatistics(PerfResults &perf_results) {
+  const auto &samples = perf_results.samples_sec;
+  if (samples.empty()) {
+    return;
+  }
+  std::vector<double> sorted(samples);
+  std::ranges::sort(sorted);
+
+  double sum = 0.0;
+  for (double sample : sorted) {
+    sum += sample;
+  }
+  const auto count = static_cast<double>(sorted.size());
+  const double mean = sum / count;
+
+  double sq_sum = 0.0;
+  for (double sample : sorted) {
+    sq_sum += (sample - mean) * (sample - mean);
+  }
+
+  perf_results.time_sec = mean;
+  perf_results.min_sec = sorted.front();
+  perf_results.median_sec = Percentile(sorted, 0.5);
+  perf_results.p90_sec = Percentile(sorted, 0.9);
+  perf_results.p99_sec = Percentile(sorted, 0.99);
+  perf_results.max_sec = sorted.back();
+  perf_results.stddev_sec = sorted.size() > 1 ? std::sqrt(sq_sum / (count - 1.0)) : 0.0;
+}
+
 template <typename InType, typename OutType>
 class Perf {
  public:
@@ -46,22 +205,50 @@ class Perf {
   // Validation() -> Run() -> PostProcessing()
   void PipelineRun(const PerfAttr &perf_attr) {
     perf_results_.type_of_running = PerfResults::TypeOfRunning::kPipeline;
-
-    CommonRun(perf_attr, [&] {
+    perf_results_.allocations_per_iteration.reset();
+    MeasurePipeline(perf_attr);
+  }
+  // Check steady-state performance of the full pipeline: untimed pipelines run until the task's scratch arena
+  // stops growing (at least num_warmup of them), as in a long-running service that reuses its buffers
+  void WarmRun(const PerfAttr &perf_attr) {
+    perf_results_.type_of_running = PerfResults::TypeOfRunning::kWarm;
+    uint64_t warmup = 0;
+    bool grew = true;
+    while (warmup < perf_attr.num_warmup || (grew && warmup < kMaxWarmRuns)) {
+      const auto capacity = task_->GetScratchArena().GetCapacity();
       task_->Validation();
       task_->PreProcessing();
       task_->Run();
       task_->PostProcessing();
-    }, perf_results_);
+      grew = task_->GetScratchArena().GetCapacity() != capacity;
+      warmup++;
+    }
+
+    PerfAttr timed_attr = perf_attr;
+    timed_attr.num_warmup = 0;
+    const auto run_memory = MeasurePipeline(timed_attr);
+    perf_results_.allocations_per_iteration.reset();
+    if (run_memory.heap_tracked) {
+      perf_results_.allocations_per_iteration = static_cast<double>(run_memory.heap_allocations) /
+                                                static_cast<double>(std::max<uint64_t>(perf_attr.num_running, 1));
+    }
   }
   // Check performance of task's Run() function
   void TaskRun(const PerfAttr &perf_attr) {
     perf_results_.type_of_running = PerfResults::TypeOfRunning::kTaskRun;
+    perf_results_.stage_timings = {};
+
+    perf_results_.stage_memory = {};
+    perf_results_.allocations_per_iteration.reset();
 
     task_->Validation();
     task_->PreProcessing();
-    CommonRun(perf_attr, [&] { task_->Run(); }, perf_results_);
+    ppc::task::MemorySample run_memory;
+    CommonRun(perf_attr, run_memory, [&] { task_->Run(); }, perf_results_);
     task_->PostProcessing();
+    AggregateRanks(perf_results_.time_sec, run_memory);
+    SetThroughput(perf_attr.work);
+    perf_results_.scratch_bytes = task_->GetScratchArena().GetCapacity();
 
     task_->Validation();
     task_->PreProcessing();
@@ -75,6 +262,8 @@ class Perf {
       type_test_name = "task_run";
     } else if (perf_results_.type_of_running == PerfResults::TypeOfRunning::kPipeline) {
       type_test_name = "pipeline";
+    } else if (perf_results_.type_of_running == PerfResults::TypeOfRunning::kWarm) {
+      type_test_name = "warm";
     } else {
       std::stringstream err_msg;
       err_msg << '\n' << "The type of performance check for the task was not selected.\n";
@@ -87,6 +276,7 @@ class Perf {
     if (time_secs < max_time) {
       perf_res_str << std::fixed << std::setprecision(10) << time_secs;
       std::cout << test_id << ":" << type_test_name << ":" << perf_res_str.str() << '\n';
+      PrintDetailedStatistic(test_id, type_test_name);
     } else {
       std::stringstream err_msg;
       err_msg << '\n' << "Task execute time need to be: ";
@@ -94,6 +284,7 @@ class Perf {
       err_msg << "Original time in secs: " << time_secs << '\n';
       perf_res_str << std::fixed << std::setprecision(10) << -1.0;
       std::cout << test_id << ":" << type_test_name << ":" << perf_res_str.str() << '\n';
+      PrintDetailedStatistic(test_id, type_test_name);
       throw std::runtime_error(err_msg.str().c_str());
     }
   }
@@ -104,15 +295,192 @@ class Perf {
   }
 
  private:
+  // Upper bound of untimed pipelines in WarmRun() for tasks whose scratch arena keeps growing
+  static constexpr uint64_t kMaxWarmRuns = 10;
+
   PerfResults perf_results_;
   std::shared_ptr<ppc::task::Task<InType, OutType>> task_;
-  static void CommonRun(const PerfAttr &perf_attr, const std::function<void()> &pipeline, PerfResults &perf_results) {
-    auto begin = perf_attr.current_timer();
+  // Timed pipelines shared by PipelineRun() and WarmRun(); returns the memory sample of the measured loop
+  ppc::task::MemorySample MeasurePipeline(const PerfAttr &perf_attr) {
+    ppc::task::StageTimings stage_sum;
+    uint64_t iteration = 0;
+    ppc::task::MemorySample run_memory;
+    CommonRun(perf_attr, run_memory, [&] {
+      task_->Validation();
+      task_->PreProcessing();
+      task_->Run();
+      task_->PostProcessing();
+      if (iteration++ >= perf_attr.num_warmup) {
+        const auto &stages = task_->GetStageTimings();
+        stage_sum.validation_sec += stages.validation_sec;
+        stage_sum.pre_processing_sec += stages.pre_processing_sec;
+        stage_sum.run_sec += stages.run_sec;
+        stage_sum.post_processing_sec += stages.post_processing_sec;
+      }
+    }, perf_results_);
+
+    const auto count = static_cast<double>(std::max<uint64_t>(perf_attr.num_running, 1));
+    perf_results_.stage_timings = {.validation_sec = stage_sum.validation_sec / count,
+                                   .pre_processing_sec = stage_sum.pre_processing_sec / count,
+                                   .run_sec = stage_sum.run_sec / count,
+                                   .post_processing_sec = stage_sum.post_processing_sec / count};
+    perf_results_.stage_memory = task_->GetStageMemory();
+    AggregateRanks(perf_results_.stage_timings.run_sec, run_memory);
+    SetThroughput(perf_attr.work);
+    perf_results_.scratch_bytes = task_->GetScratchArena().GetCapacity();
+    return run_memory;
+  }
+  // Detail lines are kept separate from the "id:type:time" line so existing log parsers stay unaffected
+  void PrintDetailedStatistic(const std::string &test_id, const std::string &type_test_name) const {
+    std::stringstream stat_str;
+    stat_str << std::fixed << std::setprecision(10);
+    stat_str << "min=" << perf_results_.min_sec << " median=" << perf_results_.median_sec
+             << " p90=" << perf_results_.p90_sec << " p99=" << perf_results_.p99_sec
+             << " max=" << perf_results_.max_sec << " stddev=" << perf_results_.stddev_sec
+             << " samples=" << perf_results_.samples_sec.size();
+    std::cout << test_id << ":" << type_test_name << ":stats " << stat_str.str() << '\n';
+
+    if (perf_results_.type_of_running == PerfResults::TypeOfRunning::kPipeline ||
+        perf_results_.type_of_running == PerfResults::TypeOfRunning::kWarm) {
+      const auto &stages = perf_results_.stage_timings;
+      std::stringstream stage_str;
+      stage_str << std::fixed << std::setprecision(10);
+      stage_str << "validation=" << stages.validation_sec << " pre_processing=" << stages.pre_processing_sec
+                << " run=" << stages.run_sec << " post_processing=" << stages.post_processing_sec;
+      std::cout << test_id << ":" << type_test_name << ":stages " << stage_str.str() << '\n';
+    }
+
+    const auto &ranks = perf_results_.rank_stats;
+    std::stringstream rank_str;
+    rank_str << std::fixed << std::setprecision(10);
+    rank_str << "n=" << ranks.num_ranks << " min=" << ranks.min_sec << " mean=" << ranks.mean_sec
+             << " max=" << ranks.max_sec << " imbalance=" << ranks.imbalance;
+    std::cout << test_id << ":" << type_test_name << ":ranks " << rank_str.str() << '\n';
+    if (perf_results_.work.IsDeclared()) {
+      std::cout << test_id << ":" << type_test_name << ":throughput " << FormatThroughput(perf_results_.throughput)
+                << '\n';
+    }
+    std::cout << test_id << ":" << type_test_name << ":memory " << FormatMemory(perf_results_.memory) << '\n';
+    if (perf_results_.type_of_running == PerfResults::TypeOfRunning::kWarm) {
+      std::stringstream warm_str;
+      warm_str << "scratch_kb=" << perf_results_.scratch_bytes / 1024 << " allocations_per_iteration=";
+      if (perf_results_.allocations_per_iteration) {
+        warm_str << std::fixed << std::setprecision(2) << *perf_results_.allocations_per_iteration;
+      } else {
+        warm_str << "n/a";
+      }
+      std::cout << test_id << ":" << type_test_name << ":warm " << warm_str.str() << '\n';
+    }
+    if (perf_results_.counters.collected) {
+      std::cout << test_id << ":" << type_test_name << ":counters " << FormatCounters(perf_results_.counters)
+                << '\n';
+    }
+    if (ranks.imbalanced) {
+      std::cerr << "[  WARNING ] " << test_id << ":" << type_test_name << ": load imbalance " << ranks.imbalance
+                << " exceeds threshold " << ppc::util::GetPerfImbalanceThreshold() << '\n';
+    }
+  }
+  // Collective over all ranks: every rank runs the same perf test
+  void AggregateRanks(double local_run_sec, const ppc::task::MemorySample &local_memory) {
+    perf_results_.rank_stats = GatherRankStatistics(local_run_sec);
+    perf_results_.counters = GatherCountersAcrossRanks(perf_results_.counters);
+    perf_results_.memory = GatherMemoryStatistics(local_memory);
+  }
+  void SetThroughput(const PerfWork &work) {
+    perf_results_.work = work;
+    perf_results_.throughput = work.IsDeclared()
+                                   ? ComputeThroughput(work, perf_results_.time_sec, GetRooflineCeiling())
+                                   : Throughput{};
+  }
+  static std::string FormatThroughput(const Throughput &throughput) {
+    std::stringstream throughput_str;
+    throughput_str << std::scientific << std::setprecision(4);
+    throughput_str << "elements_per_sec=" << throughput.elements_per_sec
+                   << " bytes_per_sec=" << throughput.bytes_per_sec << std::fixed
+                   << " gflops=" << throughput.gflops << " roofline=";
+    if (throughput.roofline_fraction) {
+      throughput_str << std::setprecision(2) << *throughput.roofline_fraction * 100.0 << "%";
+    } else {
+      throughput_str << "n/a";
+    }
+    return throughput_str.str();
+  }
+  static std::string FormatMemory(const MemoryStatistics &memory) {
+    auto format_mb = [](const std::vector<std::uint64_t> &values) {
+      std::stringstream mb_str;
+      mb_str << std::fixed << std::setprecision(1) << "[";
+      for (std::size_t i = 0; i < values.size(); i++) {
+        mb_str << (i > 0 ? "," : "") << static_cast<double>(values[i]) / (1024.0 * 1024.0);
+      }
+      mb_str << "]";
+      return mb_str.str();
+    };
+    std::stringstream memory_str;
+    memory_str << "peak_rss_mb=" << format_mb(memory.peak_rss_bytes);
+    if (memory.heap_tracked) {
+      memory_str << " heap_peak_mb=" << format_mb(memory.heap_peak_bytes) << " allocations=[";
+      for (std::size_t i = 0; i < memory.heap_allocations.size(); i++) {
+        memory_str << (i > 0 ? "," : "") << memory.heap_allocations[i];
+      }
+      memory_str << "]";
+    }
+    return memory_str.str();
+  }
+  static std::string FormatCounters(const CounterValues &counters) {
+    if (!counters.IsAvailable()) {
+      return "unavailable";
+    }
+    std::stringstream counter_str;
+    counter_str << std::fixed << std::setprecision(2);
+    for (std::size_t i = 0; i < kCounterEventNames.size(); i++) {
+      counter_str << kCounterEventNames.at(i) << "=";
+      if (counters.values.at(i).has_value()) {
+        counter_str << *counters.values.at(i);
+      } else {
+        counter_str << "n/a";
+      }
+      counter_str << " ";
+    }
+    counter_str << "ipc=";
+    if (const auto ipc = counters.Ipc()) {
+      counter_str << std::setprecision(4) << *ipc;
+    } else {
+      counter_str << "n/a";
+    }
+    counter_str << " llc_misses_per_element=";
+    if (const auto misses = counters.LlcMissesPerElement()) {
+      counter_str << std::setprecision(4) << *misses;
+    } else {
+      counter_str << "n/a";
+    }
+    return counter_str.str();
+  }
+  static void CommonRun(const PerfAttr &perf_attr, ppc::task::MemorySample &memory,
+                        const std::function<void()> &pipeline, PerfResults &perf_results) {
+    const ppc::task::MemoryScope memory_scope(memory);
+    // Opened before the warm-up, so that worker pools it creates inherit the counters; pools that already
+    // exist get their own
+    std::optional<HardwareCounters> counters;
+    if (perf_attr.collect_counters) {
+      counters.emplace();
+    }
+    for (uint64_t i = 0; i < perf_attr.num_warmup; i++) {
+      pipeline();
+    }
+    perf_results.samples_sec.clear();
+    perf_results.samples_sec.reserve(perf_attr.num_running);
+    if (counters) {
+      counters->Start();
+    }
     for (uint64_t i = 0; i < perf_attr.num_running; i++) {
+      auto begin = perf_attr.current_timer();
       pipeline();
+      auto end = perf_attr.current_timer();
+      perf_results.samples_sec.push_back(end - begin);
     }
-    auto end = perf_attr.current_timer();
-    perf_results.time_sec = (end - begin) / static_cast<double>(perf_attr.num_running);
+    perf_results.counters = counters ? counters->Stop(perf_attr.num_running) : CounterValues{};
+    perf_results.counters.input_elements = perf_attr.input_size;
+    ComputeStatistics(perf_results);
   }
 };
 
@@ -123,6 +491,9 @@ inline std::string GetStringParamName(PerfResults::TypeOfRunning type_of_running
   if (type_of_running == PerfResults::TypeOfRunning::kPipeline) {
     return "pipeline";
   }
+  if (type_of_running == PerfResults::TypeOfRunning::kWarm) {
+    return "warm";
+  }
   return "none";
 }
 
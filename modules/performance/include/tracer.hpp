@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "task/include/stage_observer.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::performance {
+
+/// @brief Kind of a traced interval.
+enum class TraceCategory : uint8_t {
+  /// Pipeline stage of a Task (Validation, PreProcessing, Run, PostProcessing)
+  kStage,
+  /// MPI call captured by the PMPI interposition layer
+  kMpi,
+};
+
+/// @brief One complete ("ph": "X") event of the Chrome trace format.
+struct TraceEvent {
+  /// @brief Event name; must point to a string with static storage duration.
+  const char *name = "";
+  TraceCategory category = TraceCategory::kStage;
+  /// @brief Wall-clock begin time in microseconds since the epoch.
+  double begin_us = 0.0;
+  /// @brief Duration in microseconds.
+  double duration_us = 0.0;
+  /// @brief Small per-process thread index.
+  int thread_index = 0;
+};
+
+/// @brief Returns the wall-clock time in microseconds used for trace timestamps.
+/// @details The system clock is used so that events of ranks on different nodes share a time base.
+double TraceNowUs();
+
+/// @brief Process-wide collector of timeline events, exported in the Chrome trace format (chrome://tracing, Perfetto).
+/// @details Tracing is opt-in: it is enabled when PPC_TRACE_OUTPUT names an output file. While enabled, the tracer
+/// is the ppc::task::StageObserver of the process and records every pipeline stage. MPI calls are only recorded
+/// while a pipeline stage of a Task is executing on the calling thread.
+class Tracer : public ppc::task::StageObserver {
+ public:
+  /// @brief Returns the process-wide tracer, configured from PPC_TRACE_OUTPUT on first use.
+  /// @details The test runners call it at start-up, so that stages are traced from the first test on.
+  static Tracer &Instance();
+
+  Tracer(const Tracer &) = delete;
+  Tracer &operator=(const Tracer &) = delete;
+  Tracer(Tracer &&) = delete;
+  Tracer &operator=(Tracer &&) = delete;
+  ~Tracer() override;
+
+  [[nodiscard]] bool IsEnabled() const {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Starts recording and installs the tracer as stage observer; the merged trace will be written to
+  /// output_path.
+  void Enable(const std::string &output_path);
+
+  /// @brief Stops recording and removes the stage observer; already recorded events are kept.
+  void Disable();
+
+  void OnStageBegin(const char *stage_name) override;
+  void OnStageEnd(const char *stage_name) override;
+
+  /// @brief Adds a complete event. Thread-safe.
+  void Record(const char *name, TraceCategory category, double begin_us, double end_us);
+
+  /// @brief Returns a copy of the recorded events.
+  [[nodiscard]] std::vector<TraceEvent> GetEvents() const;
+
+  /// @brief Drops all recorded events.
+  void Clear();
+
+  /// @brief Serializes the recorded events of this process as a Chrome trace object for the given rank.
+  [[nodiscard]] nlohmann::json ToJson(int rank) const;
+
+  /// @brief Writes this rank's events to "<output>.rank<N>.json" and merges all ranks into "<output>".
+  /// @details Collective over MPI_COMM_WORLD when MPI is initialized; rank 0 writes the merged file if every rank
+  /// wrote its own. Does nothing when tracing is disabled.
+  /// @throws std::runtime_error After the collective, on the rank whose file could not be written, and on rank 0
+  /// if the merge fails.
+  void Finalize();
+
+  /// @brief Number of pipeline stages currently executing on the calling thread.
+  static int &StageDepth();
+
+ private:
+  Tracer();
+
+  std::atomic<bool> enabled_{false};
+  std::string output_path_;
+  mutable std::mutex mutex_;
+  std::vector<TraceEvent> events_;
+};
+
+/// @brief Records the lifetime of the object as one trace event when tracing is enabled.
+class TraceScope {
+ public:
+  TraceScope(const char *name, TraceCategory category)
+      : name_(name), category_(category), active_(IsRecorded(category)) {
+    if (active_) {
+      begin_us_ = TraceNowUs();
+      if (category_ == TraceCategory::kStage) {
+        Tracer::StageDepth()++;
+      }
+    }
+  }
+
+  ~TraceScope() {
+    if (active_) {
+      if (category_ == TraceCategory::kStage) {
+        Tracer::StageDepth()--;
+      }
+      Tracer::Instance().Record(name_, category_, begin_us_, TraceNowUs());
+    }
+  }
+
+  TraceScope(const TraceScope &) = delete;
+  TraceScope &operator=(const TraceScope &) = delete;
+  TraceScope(TraceScope &&) = delete;
+  TraceScope &operator=(TraceScope &&) = delete;
+
+ private:
+  static bool IsRecorded(TraceCategory category) {
+    if (!Tracer::Instance().IsEnabled()) {
+      return false;
+    }
+    return category != TraceCategory::kMpi || Tracer::StageDepth() > 0;
+  }
+
+  const char *name_;
+  TraceCategory category_;
+  bool active_;
+  double begin_us_ = 0.0;
+};
+
+/// @brief Merges per-rank Chrome trace files into one file.
+/// @throws std::runtime_error If an input cannot be read or the output cannot be written.
+void MergeTraceFiles(const std::vector<std::string> &input_paths, const std::string &output_path);
+
+/// @brief Returns the name of the per-rank trace file: "<output>.rank<N>.json".
+std::string GetRankTracePath(const std::string &output_path, int rank);
+
+}  // namespace ppc::performance
@@ -0,0 +1,192 @@
+#include "performance/include/auto_select.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "performance/include/perf_results_writer.hpp"
+#include "task/include/task.hpp"
+#include "util/include/util.hpp"
+
+namespace {
+
+bool IsMpiActive() {
+  int initialized = 0;
+  int finalized = 0;
+  MPI_Initialized(&initialized);
+  MPI_Finalized(&finalized);
+  return initialized != 0 && finalized == 0;
+}
+
+int GetRank() {
+  int rank = 0;
+  if (IsMpiActive()) {
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  }
+  return rank;
+}
+
+ppc::task::TypeOfTask TypeOfTaskFromString(const std::string &name) {
+  for (const auto &[type, type_name] : ppc::task::kTaskTypeMappings) {
+    if (type_name == name) {
+      return type;
+    }
+  }
+  throw std::invalid_argument("Unknown task type: " + name);
+}
+
+nlohmann::json ReadSelectionCache(const std::string &path) {
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    return nlohmann::json::object();
+  }
+  try {
+    auto cache = nlohmann::json::parse(file);
+    return cache.is_object() ? cache : nlohmann::json::object();
+  } catch (const std::exception &) {
+    return nlohmann::json::object();
+  }
+}
+
+}  // namespace
+
+ppc::task::TypeOfTask ppc::performance::SelectionTable::Select(std::size_t input_size) const {
+  if (thresholds.empty()) {
+    return ppc::task::TypeOfTask::kUnknown;
+  }
+  auto selected = thresholds.front().type_of_task;
+  for (const auto &threshold : thresholds) {
+    if (threshold.min_input_size > input_size) {
+      break;
+    }
+    selected = threshold.type_of_task;
+  }
+  return selected;
+}
+
+ppc::performance::SelectionTable ppc::performance::BuildSelectionTable(
+    const std::vector<ImplementationTiming> &timings) {
+  // Fastest implementation per benchmarked size, by ascending size
+  std::map<std::size_t, ImplementationTiming> fastest;
+  for (const auto &timing : timings) {
+    auto [it, inserted] = fastest.try_emplace(timing.input_size, timing);
+    if (!inserted && timing.time_sec < it->second.time_sec) {
+      it->second = timing;
+    }
+  }
+
+  SelectionTable table;
+  for (const auto &[input_size, timing] : fastest) {
+    if (!table.thresholds.empty() && table.thresholds.back().type_of_task == timing.type_of_task) {
+      continue;
+    }
+    table.thresholds.push_back(
+        {.min_input_size = table.thresholds.empty() ? 0 : input_size, .type_of_task = timing.type_of_task});
+  }
+  return table;
+}
+
+nlohmann::json ppc::performance::SelectionTableToJson(const SelectionTable &table) {
+  auto json = nlohmann::json::array();
+  for (const auto &threshold : table.thresholds) {
+    json.push_back({{"min_input_size", threshold.min_input_size},
+                    {"type_of_task", ppc::task::TypeOfTaskToString(threshold.type_of_task)}});
+  }
+  return json;
+}
+
+ppc::performance::SelectionTable ppc::performance::SelectionTableFromJson(const nlohmann::json &json) {
+  SelectionTable table;
+  for (const auto &entry : json) {
+    table.thresholds.push_back({.min_input_size = entry.at("min_input_size").get<std::size_t>(),
+                                .type_of_task = TypeOfTaskFromString(entry.at("type_of_task").get<std::string>())});
+  }
+  std::ranges::sort(table.thresholds, {}, &SelectionThreshold::min_input_size);
+  return table;
+}
+
+std::string ppc::performance::GetSelectionKey(const std::string &task_namespace) {
+  int num_ranks = 1;
+  if (IsMpiActive()) {
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+  }
+  return task_namespace + "/np" + std::to_string(num_ranks) + "/t" + std::to_string(ppc::util::GetNumThreads());
+}
+
+std::string ppc::performance::GetSelectionCachePath(const std::string &host) {
+  return (std::filesystem::path(ppc::util::GetCalibrationDir()) / (host + ".selection.json")).string();
+}
+
+std::optional<ppc::performance::SelectionTable> ppc::performance::LoadSelectionTable(
+    const std::string &task_namespace) {
+  // Rank 0 decides for everyone: ranks on other hosts would otherwise read other caches
+  std::string serialized;
+  if (GetRank() == 0) {
+    const auto cache = ReadSelectionCache(GetSelectionCachePath(GetHostName()));
+    const auto key = GetSelectionKey(task_namespace);
+    if (cache.contains(key)) {
+      serialized = cache[key].dump();
+    }
+  }
+  if (IsMpiActive()) {
+    int length = static_cast<int>(serialized.size());
+    MPI_Bcast(&length, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    serialized.resize(static_cast<std::size_t>(length));
+    MPI_Bcast(serialized.data(), length, MPI_CHAR, 0, MPI_COMM_WORLD);
+  }
+  if (serialized.empty()) {
+    return std::nullopt;
+  }
+  try {
+    auto table = SelectionTableFromJson(nlohmann::json::parse(serialized));
+    if (table.thresholds.empty()) {
+      return std::nullopt;
+    }
+    return table;
+  } catch (const std::exception &) {
+    // A corrupt entry is benchmarked again
+    return std::nullopt;
+  }
+}
+
+void ppc::performance::SynchronizeBenchmarkRanks() {
+  if (IsMpiActive()) {
+    MPI_Barrier(MPI_COMM_WORLD);
+  }
+}
+
+bool ppc::performance::AllRanksDone(bool done) {
+  int all_done = done ? 1 : 0;
+  if (IsMpiActive()) {
+    MPI_Allreduce(MPI_IN_PLACE, &all_done, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD);
+  }
+  return all_done != 0;
+}
+
+void ppc::performance::SaveSelectionTable(const std::string &task_namespace, const SelectionTable &table) {
+  // Only rank 0 writes; its outcome is shared so that a failure throws on every rank, not just on rank 0
+  bool saved = true;
+  if (GetRank() == 0) {
+    const auto path = GetSelectionCachePath(GetHostName());
+    auto cache = ReadSelectionCache(path);
+    cache[GetSelectionKey(task_namespace)] = SelectionTableToJson(table);
+
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+    std::ofstream file(path);
+    saved = file.is_open() && static_cast<bool>(file << cache.dump(2) << '\n');
+  }
+  if (!AllRanksDone(saved)) {
+    throw std::runtime_error("Failed to write the selection cache " + GetSelectionCachePath(GetHostName()));
+  }
+}
@@ -0,0 +1,378 @@
+#include "performance/include/calibration.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "dist/include/allreduce.hpp"
+#include "oneapi/tbb/blocked_range.h"
+#include "oneapi/tbb/parallel_for.h"
+#include "oneapi/tbb/task_arena.h"
+#include "performance/include/perf_results_writer.hpp"
+#include "util/include/util.hpp"
+
+namespace {
+
+constexpr double kTriadScalar = 3.0;
+constexpr int kPingPongTag = 0;
+
+bool IsMpiActive() {
+  int initialized = 0;
+  int finalized = 0;
+  MPI_Initialized(&initialized);
+  MPI_Finalized(&finalized);
+  return initialized != 0 && finalized == 0;
+}
+
+// Times `allreduce` on vectors of doubles of each size; returns (bytes, slowest rank's mean time) per size
+template <typename Allreduce>
+std::vector<std::pair<std::size_t, double>> TimeAllreduceSweep(const std::vector<std::size_t> &message_bytes,
+                                                               int iterations, const Allreduce &allreduce) {
+  std::vector<std::pair<std::size_t, double>> result;
+  if (!IsMpiActive()) {
+    return result;
+  }
+  iterations = std::max(iterations, 1);
+  for (const auto bytes : message_bytes) {
+    const std::size_t count = std::max<std::size_t>(bytes / sizeof(double), 1);
+    std::vector<double> send(count, 1.0);
+    std::vector<double> recv(count);
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    const double start = MPI_Wtime();
+    for (int i = 0; i < iterations; i++) {
+      allreduce(send, recv);
+    }
+    const double local_sec = (MPI_Wtime() - start) / static_cast<double>(iterations);
+    double slowest_sec = 0.0;
+    MPI_Allreduce(&local_sec, &slowest_sec, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    result.emplace_back(count * sizeof(double), slowest_sec);
+  }
+  return result;
+}
+
+double Now() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Runs the triad `repetitions` times and converts the fastest run to bytes per second
+template <typename Triad>
+double BestTriadBandwidth(std::size_t num_elements, int repetitions, const Triad &triad) {
+  double best_sec = std::numeric_limits<double>::max();
+  for (int i = 0; i < std::max(repetitions, 1); i++) {
+    const double start = Now();
+    triad();
+    best_sec = std::min(best_sec, Now() - start);
+  }
+  const double bytes = 3.0 * static_cast<double>(num_elements) * sizeof(double);
+  return best_sec > 0.0 ? bytes / best_sec : 0.0;
+}
+
+}  // namespace
+
+double ppc::performance::MeasureStreamTriadOmp(std::size_t num_elements, int repetitions) {
+  std::vector<double> a(num_elements);
+  std::vector<double> b(num_elements);
+  std::vector<double> c(num_elements);
+  const auto n = static_cast<std::int64_t>(num_elements);
+  const int num_threads = ppc::util::GetNumThreads();
+
+  // First touch by the worker threads places pages on their NUMA nodes
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+  for (std::int64_t i = 0; i < n; i++) {
+    a[i] = 0.0;
+    b[i] = 1.0;
+    c[i] = 2.0;
+  }
+
+  return BestTriadBandwidth(num_elements, repetitions, [&] {
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+    for (std::int64_t i = 0; i < n; i++) {
+      a[i] = b[i] + (kTriadScalar * c[i]);
+    }
+  });
+}
+
+double ppc::performance::MeasureStreamTriadTbb(std::size_t num_elements, int repetitions) {
+  std::vector<double> a(num_elements);
+  std::vector<double> b(num_elements);
+  std::vector<double> c(num_elements);
+  oneapi::tbb::task_arena arena(ppc::util::GetNumThreads());
+
+  const auto for_each_block = [&](const auto &body) {
+    arena.execute([&] {
+      oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<std::size_t>(0, num_elements),
+                                [&](const oneapi::tbb::blocked_range<std::size_t> &range) {
+        for (std::size_t i = range.begin(); i < range.end(); i++) {
+          body(i);
+        }
+      });
+    });
+  };
+
+  for_each_block([&](std::size_t i) {
+    a[i] = 0.0;
+    b[i] = 1.0;
+    c[i] = 2.0;
+  });
+
+  return BestTriadBandwidth(num_elements, repetitions, [&] {
+    for_each_block([&](std::size_t i) { a[i] = b[i] + (kTriadScalar * c[i]); });
+  });
+}
+
+int ppc::performance::CountPhysicalCores() {
+  // SMT siblings share (physical_package_id, core_id) in the sysfs topology
+  const std::filesystem::path cpu_root = "/sys/devices/system/cpu";
+  std::set<std::pair<std::string, std::string>> cores;
+  std::error_code ec;
+  for (const auto &entry : std::filesystem::directory_iterator(cpu_root, ec)) {
+    const std::string name = entry.path().filename().string();
+    if (!name.starts_with("cpu") || name.size() == 3 ||
+        !std::ranges::all_of(name.substr(3), [](char c) { return c >= '0' && c <= '9'; })) {
+      continue;
+    }
+    std::ifstream package_file(entry.path() / "topology" / "physical_package_id");
+    std::ifstream core_file(entry.path() / "topology" / "core_id");
+    std::string package;
+    std::string core;
+    if (package_file >> package && core_file >> core) {
+      cores.emplace(package, core);
+    }
+  }
+  if (!cores.empty()) {
+    return static_cast<int>(cores.size());
+  }
+  return static_cast<int>(std::max(std::thread::hardware_concurrency(), 1U));
+}
+
+double ppc::performance::MeasurePeakFlopsPerCore(std::uint64_t iterations) {
+  // Independent chains hide the latency of the floating-point pipeline
+  constexpr std::size_t kChains = 16;
+  std::array<double, kChains> acc{};
+  for (std::size_t c = 0; c < kChains; c++) {
+    acc.at(c) = 1.0 + (static_cast<double>(c) * 1e-3);
+  }
+  const double mul = 0.9999999;
+  const double add = 1e-7;
+
+  const double start = Now();
+  for (std::uint64_t i = 0; i < iterations; i++) {
+    for (auto &value : acc) {
+      value = (value * mul) + add;
+    }
+  }
+  const double elapsed = Now() - start;
+
+  // Keep the result observable so the loop is not optimized away
+  volatile double sink = 0.0;
+  for (double value : acc) {
+    sink = sink + value;
+  }
+
+  const double flops = 2.0 * static_cast<double>(kChains) * static_cast<double>(iterations);
+  return elapsed > 0.0 ? flops / elapsed : 0.0;
+}
+
+ppc::performance::PingPongResult ppc::performance::MeasurePingPong(std::size_t message_bytes, int iterations) {
+  PingPongResult result;
+  if (!IsMpiActive()) {
+    return result;
+  }
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  if (size < 2) {
+    return result;
+  }
+
+  std::vector<char> buffer(std::max<std::size_t>(message_bytes, 1));
+  const auto count = static_cast<int>(buffer.size());
+  iterations = std::max(iterations, 1);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  const double start = MPI_Wtime();
+  for (int i = 0; i < iterations; i++) {
+    if (rank == 0) {
+      MPI_Send(buffer.data(), count, MPI_CHAR, 1, kPingPongTag, MPI_COMM_WORLD);
+      MPI_Recv(buffer.data(), count, MPI_CHAR, 1, kPingPongTag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    } else if (rank == 1) {
+      MPI_Recv(buffer.data(), count, MPI_CHAR, 0, kPingPongTag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+      MPI_Send(buffer.data(), count, MPI_CHAR, 0, kPingPongTag, MPI_COMM_WORLD);
+    }
+  }
+  const double elapsed = MPI_Wtime() - start;
+
+  std::array<double, 2> values = {elapsed / (2.0 * static_cast<double>(iterations)), 0.0};
+  values[1] = values[0] > 0.0 ? static_cast<double>(message_bytes) / values[0] : 0.0;
+  MPI_Bcast(values.data(), 2, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+  result.half_round_trip_sec = values[0];
+  result.bandwidth_bytes_per_sec = values[1];
+  return result;
+}
+
+std::vector<std::pair<std::size_t, double>> ppc::performance::MeasureAllreduceSweep(
+    const std::vector<std::size_t> &message_bytes, int iterations) {
+  const auto allreduce = [](std::vector<double> &send, std::vector<double> &recv) {
+    MPI_Allreduce(send.data(), recv.data(), static_cast<int>(send.size()), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  };
+  return TimeAllreduceSweep(message_bytes, iterations, allreduce);
+}
+
+std::vector<std::pair<std::size_t, double>> ppc::performance::MeasureDistAllreduceSweep(
+    const std::vector<std::size_t> &message_bytes, int iterations, ppc::dist::AllreduceAlgorithm algorithm) {
+  const auto allreduce = [algorithm](std::vector<double> &send, std::vector<double> & /*recv*/) {
+    ppc::dist::Allreduce<double>(send, std::plus<>{}, MPI_COMM_WORLD, algorithm);
+  };
+  return TimeAllreduceSweep(message_bytes, iterations, allreduce);
+}
+
+ppc::performance::CalibrationResults ppc::performance::RunCalibration() {
+  // 3 x 128 MiB arrays: well beyond the last-level cache of current CPUs, as STREAM requires
+  constexpr std::size_t kStreamElements = std::size_t{1} << 24;
+  constexpr int kStreamRepetitions = 10;
+  constexpr std::uint64_t kFlopsIterations = 100'000'000;
+  constexpr std::size_t kLatencyBytes = 8;
+  constexpr std::size_t kBandwidthBytes = std::size_t{4} << 20;
+
+  CalibrationResults results;
+  results.host = GetHostName();
+  results.num_threads = ppc::util::GetNumThreads();
+  results.num_cores = CountPhysicalCores();
+  if (IsMpiActive()) {
+    MPI_Comm_size(MPI_COMM_WORLD, &results.num_ranks);
+  }
+
+  // Node-level measurements run on rank 0 only: concurrent ranks would compete for the same memory bus
+  int rank = 0;
+  if (IsMpiActive()) {
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  }
+  std::array<double, 3> node_values{};
+  if (rank == 0) {
+    node_values = {MeasureStreamTriadOmp(kStreamElements, kStreamRepetitions),
+                   MeasureStreamTriadTbb(kStreamElements, kStreamRepetitions),
+                   MeasurePeakFlopsPerCore(kFlopsIterations)};
+  }
+  if (IsMpiActive()) {
+    MPI_Bcast(node_values.data(), static_cast<int>(node_values.size()), MPI_DOUBLE, 0, MPI_COMM_WORLD);
+  }
+  results.stream_triad_omp_bytes_per_sec = node_values[0];
+  results.stream_triad_tbb_bytes_per_sec = node_values[1];
+  results.stream_triad_bytes_per_sec =
+      std::max(results.stream_triad_omp_bytes_per_sec, results.stream_triad_tbb_bytes_per_sec);
+  results.peak_flops_per_core = node_values[2];
+
+  results.mpi_latency_sec = MeasurePingPong(kLatencyBytes, 1000).half_round_trip_sec;
+  results.mpi_bandwidth_bytes_per_sec = MeasurePingPong(kBandwidthBytes, 50).bandwidth_bytes_per_sec;
+  const std::vector<std::size_t> allreduce_bytes = {8, 1 << 10, 64 << 10, 1 << 20, 16 << 20};
+  results.allreduce_sec = MeasureAllreduceSweep(allreduce_bytes, 20);
+  for (const auto algorithm : {ppc::dist::AllreduceAlgorithm::kRecursiveDoubling, ppc::dist::AllreduceAlgorithm::kRing,
+                               ppc::dist::AllreduceAlgorithm::kRabenseifner, ppc::dist::AllreduceAlgorithm::kAuto}) {
+    auto sweep = MeasureDistAllreduceSweep(allreduce_bytes, 20, algorithm);
+    if (!sweep.empty()) {
+      results.dist_allreduce_sec[ppc::dist::GetAllreduceAlgorithmName(algorithm)] = std::move(sweep);
+    }
+  }
+  return results;
+}
+
+nlohmann::json ppc::performance::CalibrationToJson(const CalibrationResults &results) {
+  nlohmann::json json;
+  json["host"] = results.host;
+  json["num_threads"] = results.num_threads;
+  json["num_cores"] = results.num_cores;
+  json["num_ranks"] = results.num_ranks;
+  json["stream_triad_bytes_per_sec"] = results.stream_triad_bytes_per_sec;
+  json["stream_triad_omp_bytes_per_sec"] = results.stream_triad_omp_bytes_per_sec;
+  json["stream_triad_tbb_bytes_per_sec"] = results.stream_triad_tbb_bytes_per_sec;
+  json["peak_flops_per_core"] = results.peak_flops_per_core;
+  json["mpi_latency_sec"] = results.mpi_latency_sec;
+  json["mpi_bandwidth_bytes_per_sec"] = results.mpi_bandwidth_bytes_per_sec;
+  json["allreduce_sec"] = nlohmann::json::array();
+  for (const auto &[bytes, sec] : results.allreduce_sec) {
+    json["allreduce_sec"].push_back({{"bytes", bytes}, {"sec", sec}});
+  }
+  json["dist_allreduce_sec"] = nlohmann::json::object();
+  for (const auto &[algorithm, sweep] : results.dist_allreduce_sec) {
+    auto &points = json["dist_allreduce_sec"][algorithm] = nlohmann::json::array();
+    for (const auto &[bytes, sec] : sweep) {
+      points.push_back({{"bytes", bytes}, {"sec", sec}});
+    }
+  }
+  return json;
+}
+
+ppc::performance::CalibrationResults ppc::performance::CalibrationFromJson(const nlohmann::json &json) {
+  CalibrationResults results;
+  results.host = json.value("host", std::string("unknown"));
+  results.num_threads = json.value("num_threads", 1);
+  results.num_cores = json.value("num_cores", 1);
+  results.num_ranks = json.value("num_ranks", 1);
+  results.stream_triad_bytes_per_sec = json.value("stream_triad_bytes_per_sec", 0.0);
+  results.stream_triad_omp_bytes_per_sec = json.value("stream_triad_omp_bytes_per_sec", 0.0);
+  results.stream_triad_tbb_bytes_per_sec = json.value("stream_triad_tbb_bytes_per_sec", 0.0);
+  results.peak_flops_per_core = json.value("peak_flops_per_core", 0.0);
+  results.mpi_latency_sec = json.value("mpi_latency_sec", 0.0);
+  results.mpi_bandwidth_bytes_per_sec = json.value("mpi_bandwidth_bytes_per_sec", 0.0);
+  if (json.contains("allreduce_sec")) {
+    for (const auto &point : json["allreduce_sec"]) {
+      results.allreduce_sec.emplace_back(point.at("bytes").get<std::size_t>(), point.at("sec").get<double>());
+    }
+  }
+  if (json.contains("dist_allreduce_sec")) {
+    for (const auto &[algorithm, points] : json["dist_allreduce_sec"].items()) {
+      auto &sweep = results.dist_allreduce_sec[algorithm];
+      for (const auto &point : points) {
+        sweep.emplace_back(point.at("bytes").get<std::size_t>(), point.at("sec").get<double>());
+      }
+    }
+  }
+  return results;
+}
+
+std::string ppc::performance::GetCalibrationPath(const std::string &host) {
+  return (std::filesystem::path(ppc::util::GetCalibrationDir()) / (host + ".json")).string();
+}
+
+void ppc::performance::SaveCalibration(const CalibrationResults &results) {
+  const auto path = GetCalibrationPath(results.host);
+  std::error_code ec;
+  std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+  std::ofstream file(path);
+  if (!file.is_open()) {
+    throw std::runtime_error("Failed to open " + path);
+  }
+  file << CalibrationToJson(results).dump(2) << '\n';
+}
+
+std::optional<ppc::performance::CalibrationResults> ppc::performance::LoadCalibration(const std::string &host) {
+  std::ifstream file(GetCalibrationPath(host));
+  if (!file.is_open()) {
+    return std::nullopt;
+  }
+  try {
+    return CalibrationFromJson(nlohmann::json::parse(file));
+  } catch (const std::exception &) {
+    // A corrupt cache must not break perf runs; the host is treated as uncalibrated
+    return std::nullopt;
+  }
+}
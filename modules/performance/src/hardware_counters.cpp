@@ -0,0 +1,209 @@
+#include "performance/include/hardware_counters.hpp"
+
+#include <mpi.h>
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <system_error>
+#include <vector>
+
+#ifdef __linux__
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+namespace {
+
+constexpr auto kNumEvents = static_cast<std::size_t>(ppc::performance::CounterEvent::kCount);
+
+#ifdef __linux__
+
+struct EventConfig {
+  uint32_t type;
+  uint64_t config;
+};
+
+constexpr std::array<EventConfig, kNumEvents> kEventConfigs = {{
+    {.type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_CPU_CYCLES},
+    {.type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_INSTRUCTIONS},
+    {.type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_CACHE_MISSES},
+    {.type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_BRANCH_MISSES},
+    {.type = PERF_TYPE_SOFTWARE, .config = PERF_COUNT_SW_TASK_CLOCK},
+}};
+
+int OpenEvent(const EventConfig &event, pid_t thread, int group_fd) {
+  perf_event_attr attr{};
+  attr.size = sizeof(attr);
+  attr.type = event.type;
+  attr.config = event.config;
+  attr.disabled = group_fd == -1 ? 1 : 0;
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, thread, -1, group_fd, 0));
+}
+
+// Thread ids of the calling process, listed before any event is opened: a thread spawned later by one of them
+// is counted through the inherited group of its creator and must not get a group of its own
+std::vector<pid_t> ListThreads() {
+  std::vector<pid_t> threads;
+  std::error_code error;
+  for (std::filesystem::directory_iterator it("/proc/self/task", error), end; !error && it != end;
+       it.increment(error)) {
+    const auto name = it->path().filename().string();
+    pid_t thread = 0;
+    if (std::from_chars(name.data(), name.data() + name.size(), thread).ec == std::errc{}) {
+      threads.push_back(thread);
+    }
+  }
+  if (threads.empty()) {
+    // Calling thread only
+    threads.push_back(0);
+  }
+  return threads;
+}
+
+#endif
+
+template <typename Group>
+int GetLeader(const Group &group) {
+  for (const int fd : group) {
+    if (fd != -1) {
+      return fd;
+    }
+  }
+  return -1;
+}
+
+}  // namespace
+
+ppc::performance::HardwareCounters::HardwareCounters() {
+#ifdef __linux__
+  for (const pid_t thread : ListThreads()) {
+    std::array<int, kNumEvents> group{};
+    group.fill(-1);
+    for (std::size_t i = 0; i < kNumEvents; i++) {
+      group.at(i) = OpenEvent(kEventConfigs.at(i), thread, GetLeader(group));
+    }
+    // A thread that exited in the meantime has nothing to count
+    if (GetLeader(group) != -1) {
+      groups_.push_back(group);
+    }
+  }
+#endif
+}
+
+ppc::performance::HardwareCounters::~HardwareCounters() {
+#ifdef __linux__
+  for (const auto &group : groups_) {
+    for (const int fd : group) {
+      if (fd != -1) {
+        close(fd);
+      }
+    }
+  }
+#endif
+}
+
+bool ppc::performance::HardwareCounters::IsAvailable() const {
+  return !groups_.empty();
+}
+
+void ppc::performance::HardwareCounters::Start() {
+#ifdef __linux__
+  for (const auto &group : groups_) {
+    ioctl(GetLeader(group), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  }
+  for (const auto &group : groups_) {
+    ioctl(GetLeader(group), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+#endif
+}
+
+ppc::performance::CounterValues ppc::performance::HardwareCounters::Stop(uint64_t iterations) {
+  CounterValues result;
+  result.collected = true;
+#ifdef __linux__
+  for (const auto &group : groups_) {
+    ioctl(GetLeader(group), PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  }
+  const double divisor = iterations > 0 ? static_cast<double>(iterations) : 1.0;
+  for (std::size_t i = 0; i < kNumEvents; i++) {
+    // An event counts only if it could be read on every thread; a partial sum would understate it
+    double total = 0.0;
+    bool complete = !groups_.empty();
+    for (const auto &group : groups_) {
+      // value, time_enabled, time_running
+      std::array<uint64_t, 3> data{};
+      if (group.at(i) == -1 ||
+          read(group.at(i), data.data(), sizeof(data)) != static_cast<ssize_t>(sizeof(data))) {
+        complete = false;
+        break;
+      }
+      if (data[2] == 0) {
+        // Enabled but never scheduled: the thread was idle
+        continue;
+      }
+      // Scale up if the kernel multiplexed the group with other events
+      const double scale = static_cast<double>(data[1]) / static_cast<double>(data[2]);
+      total += static_cast<double>(data[0]) * scale;
+    }
+    if (complete) {
+      result.values.at(i) = total / divisor;
+    }
+  }
+#else
+  (void)iterations;
+#endif
+  return result;
+}
+
+ppc::performance::CounterValues ppc::performance::GatherCountersAcrossRanks(const CounterValues &local) {
+  CounterValues result = local;
+  result.rank_values = {local.values};
+  int initialized = 0;
+  int finalized = 0;
+  MPI_Initialized(&initialized);
+  MPI_Finalized(&finalized);
+  if (initialized == 0 || finalized != 0 || !local.collected) {
+    return result;
+  }
+
+  std::array<double, kNumEvents> local_values{};
+  std::array<int, kNumEvents> local_present{};
+  for (std::size_t i = 0; i < kNumEvents; i++) {
+    local_values.at(i) = local.values.at(i).value_or(0.0);
+    local_present.at(i) = local.values.at(i).has_value() ? 1 : 0;
+  }
+  MPI_Comm_size(MPI_COMM_WORLD, &result.num_ranks);
+  const auto num_ranks = static_cast<std::size_t>(result.num_ranks);
+  std::vector<double> all_values(num_ranks * kNumEvents);
+  std::vector<int> all_present(num_ranks * kNumEvents);
+  MPI_Allgather(local_values.data(), static_cast<int>(kNumEvents), MPI_DOUBLE, all_values.data(),
+                static_cast<int>(kNumEvents), MPI_DOUBLE, MPI_COMM_WORLD);
+  MPI_Allgather(local_present.data(), static_cast<int>(kNumEvents), MPI_INT, all_present.data(),
+                static_cast<int>(kNumEvents), MPI_INT, MPI_COMM_WORLD);
+
+  result.rank_values.assign(num_ranks, CounterArray{});
+  for (std::size_t i = 0; i < kNumEvents; i++) {
+    double sum = 0.0;
+    bool present_everywhere = true;
+    for (std::size_t rank = 0; rank < num_ranks; rank++) {
+      if (all_present[(rank * kNumEvents) + i] == 0) {
+        present_everywhere = false;
+        continue;
+      }
+      result.rank_values[rank].at(i) = all_values[(rank * kNumEvents) + i];
+      sum += all_values[(rank * kNumEvents) + i];
+    }
+    result.values.at(i) = present_everywhere ? std::optional<double>(sum) : std::nullopt;
+  }
+  return result;
+}
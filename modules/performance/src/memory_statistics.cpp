@@ -0,0 +1,39 @@
+#include "performance/include/memory_statistics.hpp"
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "task/include/memory_tracker.hpp"
+
+namespace {
+
+std::vector<std::uint64_t> AllgatherValue(std::uint64_t value, int num_ranks) {
+  std::vector<std::uint64_t> values(static_cast<std::size_t>(num_ranks));
+  MPI_Allgather(&value, 1, MPI_UINT64_T, values.data(), 1, MPI_UINT64_T, MPI_COMM_WORLD);
+  return values;
+}
+
+}  // namespace
+
+ppc::performance::MemoryStatistics ppc::performance::GatherMemoryStatistics(const ppc::task::MemorySample &local) {
+  MemoryStatistics stats;
+  stats.heap_tracked = local.heap_tracked;
+  stats.peak_rss_bytes = {local.peak_rss_bytes};
+  stats.heap_peak_bytes = {local.heap_peak_bytes};
+  stats.heap_allocations = {local.heap_allocations};
+
+  int initialized = 0;
+  int finalized = 0;
+  MPI_Initialized(&initialized);
+  MPI_Finalized(&finalized);
+  if (initialized != 0 && finalized == 0) {
+    MPI_Comm_size(MPI_COMM_WORLD, &stats.num_ranks);
+    stats.peak_rss_bytes = AllgatherValue(local.peak_rss_bytes, stats.num_ranks);
+    stats.heap_peak_bytes = AllgatherValue(local.heap_peak_bytes, stats.num_ranks);
+    stats.heap_allocations = AllgatherValue(local.heap_allocations, stats.num_ranks);
+  }
+  return stats;
+}
@@ -0,0 +1,164 @@
+#include "performance/include/perf_results_writer.hpp"
+
+#include <array>
+#include <cstddef>
+#include <fstream>
+#include <ios>
+#include <libenvpp/detail/get.hpp>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "performance/include/hardware_counters.hpp"
+#include "performance/include/memory_statistics.hpp"
+#include "performance/include/performance.hpp"
+#include "util/include/util.hpp"
+
+#ifndef _WIN32
+#  include <unistd.h>
+#endif
+
+std::string ppc::performance::GetTaskNamespaceFromTestId(const std::string &test_id,
+                                                         const std::string &type_of_task) {
+  const auto pos = test_id.rfind("_" + type_of_task + "_");
+  if (pos == std::string::npos) {
+    return test_id;
+  }
+  return test_id.substr(0, pos);
+}
+
+std::string ppc::performance::GetHostName() {
+#ifdef _WIN32
+  const auto name = env::get<std::string>("COMPUTERNAME");
+  if (name.has_value()) {
+    return name.value();
+  }
+#else
+  std::array<char, 256> name{};
+  if (gethostname(name.data(), name.size() - 1) == 0) {
+    return {name.data()};
+  }
+#endif
+  return "unknown";
+}
+
+std::string ppc::performance::GetGitSha() {
+  for (std::string_view var : {"PPC_GIT_SHA", "GITHUB_SHA"}) {
+    const auto sha = env::get<std::string>(var);
+    if (sha.has_value() && !sha.value().empty()) {
+      return sha.value();
+    }
+  }
+  return "unknown";
+}
+
+nlohmann::json ppc::performance::PerfRecordToJson(const PerfRecord &record) {
+  const auto &res = record.results;
+  nlohmann::json json;
+  json["test_id"] = record.test_id;
+  json["task_namespace"] = record.task_namespace;
+  json["type_of_task"] = record.type_of_task;
+  json["type_of_running"] = record.type_of_running;
+  json["num_proc"] = record.num_proc;
+  json["num_threads"] = record.num_threads;
+  json["size_scale"] = record.size_scale;
+  json["requested_size"] = record.requested_size;
+  json["input_size"] = record.input_size;
+  json["distributed_input"] = record.distributed_input;
+  json["time_sec"] = res.time_sec;
+  json["min_sec"] = res.min_sec;
+  json["median_sec"] = res.median_sec;
+  json["p90_sec"] = res.p90_sec;
+  json["p99_sec"] = res.p99_sec;
+  json["max_sec"] = res.max_sec;
+  json["stddev_sec"] = res.stddev_sec;
+  json["samples_sec"] = res.samples_sec;
+  json["stage_timings"] = {{"validation_sec", res.stage_timings.validation_sec},
+                           {"pre_processing_sec", res.stage_timings.pre_processing_sec},
+                           {"run_sec", res.stage_timings.run_sec},
+                           {"post_processing_sec", res.stage_timings.post_processing_sec}};
+  json["ranks"] = {{"num_ranks", res.rank_stats.num_ranks},
+                   {"min_sec", res.rank_stats.min_sec},
+                   {"mean_sec", res.rank_stats.mean_sec},
+                   {"max_sec", res.rank_stats.max_sec},
+                   {"imbalance", res.rank_stats.imbalance},
+                   {"imbalanced", res.rank_stats.imbalanced}};
+  if (res.work.IsDeclared()) {
+    json["work"] = {{"elements", res.work.elements}, {"bytes", res.work.bytes}, {"flops", res.work.flops}};
+    const auto &throughput = res.throughput;
+    json["throughput"] = {{"elements_per_sec", throughput.elements_per_sec},
+                          {"bytes_per_sec", throughput.bytes_per_sec},
+                          {"gflops", throughput.gflops},
+                          {"roofline_fraction", throughput.roofline_fraction
+                                                    ? nlohmann::json(*throughput.roofline_fraction)
+                                                    : nlohmann::json(nullptr)}};
+  }
+  auto &memory = json["memory"];
+  memory["heap_tracked"] = res.memory.heap_tracked;
+  memory["peak_rss_bytes"] = res.memory.peak_rss_bytes;
+  memory["max_peak_rss_bytes"] = res.memory.MaxPeakRssBytes();
+  if (res.memory.heap_tracked) {
+    memory["heap_peak_bytes"] = res.memory.heap_peak_bytes;
+    memory["max_heap_peak_bytes"] = res.memory.MaxHeapPeakBytes();
+    memory["heap_allocations"] = res.memory.heap_allocations;
+  }
+  memory["scratch_bytes"] = res.scratch_bytes;
+  if (res.allocations_per_iteration) {
+    memory["allocations_per_iteration"] = *res.allocations_per_iteration;
+  }
+  if (res.type_of_running == PerfResults::TypeOfRunning::kPipeline ||
+      res.type_of_running == PerfResults::TypeOfRunning::kWarm) {
+    const auto stage_json = [](const ppc::task::MemorySample &sample) {
+      return nlohmann::json{{"peak_rss_bytes", sample.peak_rss_bytes},
+                            {"rss_delta_bytes", sample.rss_delta_bytes},
+                            {"heap_peak_bytes", sample.heap_peak_bytes},
+                            {"heap_allocations", sample.heap_allocations}};
+    };
+    memory["stages"] = {{"validation", stage_json(res.stage_memory.validation)},
+                        {"pre_processing", stage_json(res.stage_memory.pre_processing)},
+                        {"run", stage_json(res.stage_memory.run)},
+                        {"post_processing", stage_json(res.stage_memory.post_processing)}};
+  }
+  if (res.counters.collected) {
+    const auto events_json = [](const CounterArray &values) {
+      auto events = nlohmann::json::object();
+      for (std::size_t i = 0; i < kCounterEventNames.size(); i++) {
+        const auto &value = values.at(i);
+        events[std::string(kCounterEventNames.at(i))] = value ? nlohmann::json(*value) : nlohmann::json(nullptr);
+      }
+      return events;
+    };
+    auto &counters = json["counters"];
+    counters = events_json(res.counters.values);
+    counters["available"] = res.counters.IsAvailable();
+    counters["num_ranks"] = res.counters.num_ranks;
+    counters["ranks"] = nlohmann::json::array();
+    for (const auto &rank_values : res.counters.rank_values) {
+      counters["ranks"].push_back(events_json(rank_values));
+    }
+    const auto ipc = res.counters.Ipc();
+    counters["ipc"] = ipc ? nlohmann::json(*ipc) : nlohmann::json(nullptr);
+    const auto misses_per_element = res.counters.LlcMissesPerElement();
+    counters["llc_misses_per_element"] =
+        misses_per_element ? nlohmann::json(*misses_per_element) : nlohmann::json(nullptr);
+  }
+  json["host"] = GetHostName();
+  json["git_sha"] = GetGitSha();
+  return json;
+}
+
+void ppc::performance::AppendPerfRecord(const PerfRecord &record, const std::string &output_path) {
+  std::ofstream file(output_path, std::ios::app);
+  if (!file.is_open()) {
+    throw std::runtime_error("Failed to open " + output_path);
+  }
+  file << PerfRecordToJson(record).dump() << '\n';
+}
+
+void ppc::performance::AppendPerfRecord(const PerfRecord &record) {
+  const auto output_path = ppc::util::GetPerfOutputPath();
+  if (output_path.empty()) {
+    return;
+  }
+  AppendPerfRecord(record, output_path);
+}
@@ -0,0 +1,90 @@
+#include "performance/include/performance.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+#include "performance/include/calibration.hpp"
+#include "performance/include/perf_results_writer.hpp"
+#include "util/include/util.hpp"
+
+ppc::performance::RankStatistics ppc::performance::GatherRankStatistics(double local_sec) {
+  RankStatistics stats;
+  stats.min_sec = local_sec;
+  stats.mean_sec = local_sec;
+  stats.max_sec = local_sec;
+
+  int initialized = 0;
+  int finalized = 0;
+  MPI_Initialized(&initialized);
+  MPI_Finalized(&finalized);
+  if (initialized != 0 && finalized == 0) {
+    MPI_Comm_size(MPI_COMM_WORLD, &stats.num_ranks);
+    // One collective gives min, max and mean: the durations of all ranks are a few doubles
+    std::vector<double> all_sec(static_cast<std::size_t>(stats.num_ranks));
+    MPI_Allgather(&local_sec, 1, MPI_DOUBLE, all_sec.data(), 1, MPI_DOUBLE, MPI_COMM_WORLD);
+    const auto [min_it, max_it] = std::ranges::minmax_element(all_sec);
+    stats.min_sec = *min_it;
+    stats.max_sec = *max_it;
+    stats.mean_sec = std::accumulate(all_sec.begin(), all_sec.end(), 0.0) / static_cast<double>(stats.num_ranks);
+  }
+
+  ClassifyImbalance(stats);
+  return stats;
+}
+
+void ppc::performance::ClassifyImbalance(RankStatistics &stats) {
+  stats.imbalance = stats.mean_sec > 0.0 ? stats.max_sec / stats.mean_sec : 1.0;
+  stats.imbalanced = stats.imbalance > ppc::util::GetPerfImbalanceThreshold();
+}
+
+ppc::performance::RooflineCeiling ppc::performance::GetRooflineCeiling() {
+  RooflineCeiling ceiling{.bytes_per_sec = ppc::util::GetPerfPeakBandwidth() * 1e9,
+                          .flops_per_sec = ppc::util::GetPerfPeakGflops() * 1e9};
+  if (ceiling.bytes_per_sec > 0.0 && ceiling.flops_per_sec > 0.0) {
+    return ceiling;
+  }
+  // Ceilings not given explicitly come from the host's cached calibration, if any
+  if (const auto calibration = LoadCalibration(GetHostName())) {
+    if (ceiling.bytes_per_sec <= 0.0) {
+      ceiling.bytes_per_sec = calibration->stream_triad_bytes_per_sec;
+    }
+    if (ceiling.flops_per_sec <= 0.0) {
+      ceiling.flops_per_sec = calibration->PeakFlops();
+    }
+  }
+  return ceiling;
+}
+
+ppc::performance::Throughput ppc::performance::ComputeThroughput(const PerfWork &work, double time_sec,
+                                                                 const RooflineCeiling &ceiling) {
+  Throughput throughput;
+  if (time_sec <= 0.0) {
+    return throughput;
+  }
+  throughput.elements_per_sec = work.elements / time_sec;
+  throughput.bytes_per_sec = work.bytes / time_sec;
+  const double flops_per_sec = work.flops / time_sec;
+  throughput.gflops = flops_per_sec * 1e-9;
+
+  // Roofline: attainable FLOP/s = min(peak FLOP/s, arithmetic intensity * bandwidth)
+  std::optional<double> attainable_flops;
+  if (work.flops > 0.0 && ceiling.flops_per_sec > 0.0) {
+    attainable_flops = ceiling.flops_per_sec;
+  }
+  if (work.flops > 0.0 && work.bytes > 0.0 && ceiling.bytes_per_sec > 0.0) {
+    const double memory_bound = (work.flops / work.bytes) * ceiling.bytes_per_sec;
+    attainable_flops = attainable_flops ? std::min(*attainable_flops, memory_bound) : memory_bound;
+  }
+  if (attainable_flops) {
+    throughput.roofline_fraction = flops_per_sec / *attainable_flops;
+  } else if (work.flops <= 0.0 && work.bytes > 0.0 && ceiling.bytes_per_sec > 0.0) {
+    // Pure data movement: compare against the bandwidth ceiling
+    throughput.roofline_fraction = throughput.bytes_per_sec / ceiling.bytes_per_sec;
+  }
+  return throughput;
+}
@@ -0,0 +1,218 @@
+#include "performance/include/tracer.hpp"
+
+#include <mpi.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "util/include/util.hpp"
+
+namespace {
+
+const char *CategoryName(ppc::performance::TraceCategory category) {
+  return category == ppc::performance::TraceCategory::kMpi ? "mpi" : "stage";
+}
+
+int CurrentThreadIndex() {
+  static std::atomic<int> next_index{0};
+  thread_local const int kIndex = next_index++;
+  return kIndex;
+}
+
+// Begin times of the stages executing on the calling thread, innermost last
+std::vector<double> &StageBeginTimes() {
+  thread_local std::vector<double> begin_times;
+  return begin_times;
+}
+
+}  // namespace
+
+double ppc::performance::TraceNowUs() {
+  return std::chrono::duration<double, std::micro>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+ppc::performance::Tracer::Tracer() {
+  const auto output_path = ppc::util::GetTraceOutputPath();
+  if (!output_path.empty()) {
+    Enable(output_path);
+  }
+}
+
+ppc::performance::Tracer::~Tracer() {
+  if (ppc::task::GetStageObserver() == this) {
+    ppc::task::SetStageObserver(nullptr);
+  }
+}
+
+ppc::performance::Tracer &ppc::performance::Tracer::Instance() {
+  static Tracer tracer;
+  return tracer;
+}
+
+int &ppc::performance::Tracer::StageDepth() {
+  thread_local int depth = 0;
+  return depth;
+}
+
+void ppc::performance::Tracer::Enable(const std::string &output_path) {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    output_path_ = output_path;
+  }
+  enabled_.store(true, std::memory_order_relaxed);
+  ppc::task::SetStageObserver(this);
+}
+
+void ppc::performance::Tracer::Disable() {
+  enabled_.store(false, std::memory_order_relaxed);
+  if (ppc::task::GetStageObserver() == this) {
+    ppc::task::SetStageObserver(nullptr);
+  }
+}
+
+void ppc::performance::Tracer::OnStageBegin(const char * /*stage_name*/) {
+  StageDepth()++;
+  StageBeginTimes().push_back(TraceNowUs());
+}
+
+void ppc::performance::Tracer::OnStageEnd(const char *stage_name) {
+  // The stage ends here even if tracing was disabled while it ran
+  auto &begin_times = StageBeginTimes();
+  if (begin_times.empty()) {
+    return;
+  }
+  const double begin_us = begin_times.back();
+  begin_times.pop_back();
+  StageDepth()--;
+  if (IsEnabled()) {
+    Record(stage_name, TraceCategory::kStage, begin_us, TraceNowUs());
+  }
+}
+
+void ppc::performance::Tracer::Record(const char *name, TraceCategory category, double begin_us, double end_us) {
+  const TraceEvent event{.name = name,
+                         .category = category,
+                         .begin_us = begin_us,
+                         .duration_us = end_us - begin_us,
+                         .thread_index = CurrentThreadIndex()};
+  const std::lock_guard<std::mutex> lock(mutex_);
+  events_.push_back(event);
+}
+
+std::vector<ppc::performance::TraceEvent> ppc::performance::Tracer::GetEvents() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return events_;
+}
+
+void ppc::performance::Tracer::Clear() {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  events_.clear();
+}
+
+nlohmann::json ppc::performance::Tracer::ToJson(int rank) const {
+  nlohmann::json trace_events = nlohmann::json::array();
+  // Metadata so that viewers label each process row with its rank
+  trace_events.push_back({{"name", "process_name"},
+                          {"ph", "M"},
+                          {"pid", rank},
+                          {"args", {{"name", "rank " + std::to_string(rank)}}}});
+  trace_events.push_back(
+      {{"name", "process_sort_index"}, {"ph", "M"}, {"pid", rank}, {"args", {{"sort_index", rank}}}});
+
+  const std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto &event : events_) {
+    trace_events.push_back({{"name", event.name},
+                            {"cat", CategoryName(event.category)},
+                            {"ph", "X"},
+                            {"ts", event.begin_us},
+                            {"dur", event.duration_us},
+                            {"pid", rank},
+                            {"tid", event.thread_index}});
+  }
+  return {{"traceEvents", trace_events}, {"displayTimeUnit", "ms"}};
+}
+
+std::string ppc::performance::GetRankTracePath(const std::string &output_path, int rank) {
+  return output_path + ".rank" + std::to_string(rank) + ".json";
+}
+
+void ppc::performance::MergeTraceFiles(const std::vector<std::string> &input_paths, const std::string &output_path) {
+  nlohmann::json merged_events = nlohmann::json::array();
+  for (const auto &path : input_paths) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+      throw std::runtime_error("Failed to open " + path);
+    }
+    const auto trace = nlohmann::json::parse(file);
+    for (const auto &event : trace.at("traceEvents")) {
+      merged_events.push_back(event);
+    }
+  }
+
+  std::ofstream file(output_path);
+  if (!file.is_open()) {
+    throw std::runtime_error("Failed to open " + output_path);
+  }
+  file << nlohmann::json{{"traceEvents", merged_events}, {"displayTimeUnit", "ms"}}.dump() << '\n';
+}
+
+void ppc::performance::Tracer::Finalize() {
+  if (!IsEnabled()) {
+    return;
+  }
+  Disable();
+
+  int rank = 0;
+  int size = 1;
+  int initialized = 0;
+  int finalized = 0;
+  MPI_Initialized(&initialized);
+  MPI_Finalized(&finalized);
+  const bool use_mpi = initialized != 0 && finalized == 0;
+  if (use_mpi) {
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+  }
+
+  std::string output_path;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    output_path = output_path_;
+  }
+  const auto rank_path = GetRankTracePath(output_path, rank);
+  bool written = false;
+  {
+    std::ofstream file(rank_path);
+    if (file.is_open()) {
+      file << ToJson(rank).dump() << '\n';
+      written = file.good();
+    }
+  }
+
+  // Every rank takes part in the collective before any of them reports an error, so that none is left waiting
+  int all_written = written ? 1 : 0;
+  if (use_mpi) {
+    MPI_Allreduce(MPI_IN_PLACE, &all_written, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD);
+  }
+  if (!written) {
+    throw std::runtime_error("Failed to write " + rank_path);
+  }
+  if (all_written == 0) {
+    // The rank that failed reports it
+    return;
+  }
+  if (rank == 0) {
+    std::vector<std::string> rank_paths;
+    rank_paths.reserve(static_cast<std::size_t>(size));
+    for (int i = 0; i < size; i++) {
+      rank_paths.push_back(GetRankTracePath(output_path, i));
+    }
+    MergeTraceFiles(rank_paths, output_path);
+  }
+}
@@ -1,19 +1,37 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <libenvpp/detail/environment.hpp>
+#include <libenvpp/detail/get.hpp>
+#include <limits>
 #include <memory>
 #include <ostream>
+#include <span>
 #include <stdexcept>
+#include <string>
 #include <string_view>
 #include <thread>
+#include <tuple>
+#include <utility>
 #include <vector>
 
+#include "dist/include/allreduce.hpp"
+#include "performance/include/auto_select.hpp"
+#include "performance/include/calibration.hpp"
+#include "performance/include/hardware_counters.hpp"
+#include "performance/include/perf_results_writer.hpp"
 #include "performance/include/performance.hpp"
+#include "performance/include/tracer.hpp"
+#include "task/include/stage_observer.hpp"
 #include "task/include/task.hpp"
+#include "util/include/perf_test_util.hpp"
 #include "util/include/util.hpp"
 
 using ppc::task::StatusOfTask;
@@ -61,6 +79,16 @@ class FakePerfTask : public TestPerfTask<InType, OutType> {
   }
 };
 
+template <typename InType, typename OutType>
+class SizedPerfTask : public TestPerfTask<InType, OutType> {
+ public:
+  explicit SizedPerfTask(const InType &in) : TestPerfTask<InType, OutType>(in) {}
+
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return ppc::task::TypeOfTask::kSEQ;
+  }
+};
+
 }  // namespace ppc::test
 
 namespace ppc::performance {
@@ -102,6 +130,7 @@ TEST(PerfTests, SlowPerfRespectsEnvOverride) {
   Perf<std::vector<uint8_t>, uint8_t> perf_analyzer(test_task);
   PerfAttr perf_attr;
   perf_attr.num_running = 1;
+  perf_attr.num_warmup = 0;
   const auto t0 = std::chrono::high_resolution_clock::now();
   perf_attr.current_timer = [&] {
     auto current_time_point = std::chrono::high_resolution_clock::now();
@@ -158,7 +187,8 @@ TEST_P(GetStringParamNameParamTest, ReturnsExpectedString) {
 INSTANTIATE_TEST_SUITE_P(ParamTests, GetStringParamNameParamTest,
                          ::testing::Values(ParamTestCase{PerfResults::TypeOfRunning::kTaskRun, "task_run"},
                                            ParamTestCase{PerfResults::TypeOfRunning::kPipeline, "pipeline"},
-                                           ParamTestCase{PerfResults::TypeOfRunning::kNone, "none"}),
+                                           ParamTestCase{PerfResults::TypeOfRunning::kNone, "none"},
+                                           ParamTestCase{PerfResults::TypeOfRunning::kWarm, "warm"}),
                          [](const ::testing::TestParamInfo<ParamTestCase> &info) {
                            return info.param.expected_output;
                          });
@@ -350,6 +380,741 @@ TEST(PerfTest, PipelineRunAndTaskRun) {
   EXPECT_GT(res_taskrun.time_sec, 0.0);
 }
 
+TEST(PerfTest, CollectsSamplesPerIterationExcludingWarmup) {
+  auto task_ptr = std::make_shared<DummyTask>();
+  Perf<int, int> perf(task_ptr);
+
+  PerfAttr attr;
+  attr.num_running = 5;
+  attr.num_warmup = 2;
+  // Timer readings chosen so that consecutive begin/end pairs yield samples 1, 2, 3, 4, 5
+  const std::vector<double> readings = {0.0, 1.0, 1.0, 3.0, 3.0, 6.0, 6.0, 10.0, 10.0, 15.0};
+  std::size_t calls = 0;
+  attr.current_timer = [&] { return readings.at(calls++); };
+
+  perf.PipelineRun(attr);
+  const auto res = perf.GetPerfResults();
+
+  EXPECT_EQ(calls, readings.size());
+  ASSERT_EQ(res.samples_sec.size(), 5U);
+  EXPECT_DOUBLE_EQ(res.time_sec, 3.0);
+  EXPECT_DOUBLE_EQ(res.min_sec, 1.0);
+  EXPECT_DOUBLE_EQ(res.median_sec, 3.0);
+  EXPECT_DOUBLE_EQ(res.p90_sec, 4.6);
+  EXPECT_DOUBLE_EQ(res.max_sec, 5.0);
+  EXPECT_NEAR(res.stddev_sec, std::sqrt(2.5), 1e-12);
+  EXPECT_LE(res.p90_sec, res.p99_sec);
+  EXPECT_LE(res.p99_sec, res.max_sec);
+}
+
+TEST(PerfTest, WarmRunTimesPipelinesOnceScratchStopsGrowing) {
+  // Needs more scratch in each of the first three pipelines, as buffers sized from data seen so far would
+  class GrowingScratchTask : public DummyTask {
+   public:
+    int runs = 0;
+    bool RunImpl() override {
+      runs++;
+      const auto size = static_cast<std::size_t>(std::min(runs, 3)) * 100000;
+      GetScratch<char>(size)[size - 1] = 1;
+      return true;
+    }
+  };
+  auto task_ptr = std::make_shared<GrowingScratchTask>();
+  Perf<int, int> perf(task_ptr);
+
+  PerfAttr attr;
+  attr.num_running = 4;
+  attr.num_warmup = 1;
+  perf.WarmRun(attr);
+
+  const auto res = perf.GetPerfResults();
+  EXPECT_EQ(res.type_of_running, PerfResults::TypeOfRunning::kWarm);
+  EXPECT_EQ(task_ptr->runs, 3 + 4);
+  EXPECT_EQ(res.samples_sec.size(), 4U);
+  EXPECT_EQ(res.scratch_bytes, task_ptr->GetScratchArena().GetCapacity());
+  EXPECT_GE(res.scratch_bytes, 300000U);
+  EXPECT_EQ(task_ptr->GetScratchArena().GetNumBlocks(), 1U);
+  EXPECT_NO_THROW(perf.PrintPerfStatistic("warm_scratch"));
+}
+
+TEST(PerfTest, PipelineRunReportsStageBreakdown) {
+  class SlowPreProcessingTask : public DummyTask {
+    bool PreProcessingImpl() override {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      return true;
+    }
+  };
+  auto task_ptr = std::make_shared<SlowPreProcessingTask>();
+  Perf<int, int> perf(task_ptr);
+
+  PerfAttr attr;
+  attr.num_running = 2;
+  attr.num_warmup = 0;
+  perf.PipelineRun(attr);
+
+  const auto stages = perf.GetPerfResults().stage_timings;
+  EXPECT_GE(stages.pre_processing_sec, 0.01);
+  EXPECT_LT(stages.run_sec, stages.pre_processing_sec);
+  EXPECT_NO_THROW(perf.PrintPerfStatistic("pipeline_stage_breakdown"));
+
+  perf.TaskRun(attr);
+  EXPECT_DOUBLE_EQ(perf.GetPerfResults().stage_timings.pre_processing_sec, 0.0);
+}
+
+TEST(PerfTest, GatherRankStatisticsWithoutMpiDescribesLocalRank) {
+  const auto stats = GatherRankStatistics(0.5);
+  EXPECT_EQ(stats.num_ranks, 1);
+  EXPECT_DOUBLE_EQ(stats.min_sec, 0.5);
+  EXPECT_DOUBLE_EQ(stats.mean_sec, 0.5);
+  EXPECT_DOUBLE_EQ(stats.max_sec, 0.5);
+  EXPECT_DOUBLE_EQ(stats.imbalance, 1.0);
+}
+
+TEST(PerfTest, FlagsImbalanceAboveThreshold) {
+  env::detail::set_scoped_environment_variable scoped("PPC_PERF_IMBALANCE_THRESHOLD", "0.5");
+  auto task_ptr = std::make_shared<ppc::test::TestPerfTask<std::vector<uint32_t>, uint32_t>>(
+      std::vector<uint32_t>(100, 1));
+  Perf<std::vector<uint32_t>, uint32_t> perf(task_ptr);
+  PerfAttr attr;
+  double time = 0.0;
+  attr.current_timer = [&time] { return time += 1.0; };
+  perf.TaskRun(attr);
+
+  const auto stats = perf.GetPerfResults().rank_stats;
+  EXPECT_DOUBLE_EQ(stats.max_sec, perf.GetPerfResults().time_sec);
+  EXPECT_TRUE(stats.imbalanced);
+}
+
+TEST(PerfTest, ClassifiesImbalanceOnBothSidesOfThreshold) {
+  const auto classify = [](double max_sec) {
+    RankStatistics stats{.num_ranks = 4, .min_sec = 0.5, .mean_sec = 1.0, .max_sec = max_sec};
+    ClassifyImbalance(stats);
+    return stats;
+  };
+  // Default threshold 1.25
+  EXPECT_DOUBLE_EQ(classify(1.2).imbalance, 1.2);
+  EXPECT_FALSE(classify(1.2).imbalanced);
+  EXPECT_FALSE(classify(1.25).imbalanced);
+  EXPECT_TRUE(classify(1.3).imbalanced);
+
+  env::detail::set_scoped_environment_variable scoped("PPC_PERF_IMBALANCE_THRESHOLD", "2.0");
+  EXPECT_FALSE(classify(1.3).imbalanced);
+  EXPECT_FALSE(classify(2.0).imbalanced);
+  EXPECT_TRUE(classify(2.1).imbalanced);
+
+  RankStatistics idle{.num_ranks = 2};
+  ClassifyImbalance(idle);
+  EXPECT_DOUBLE_EQ(idle.imbalance, 1.0);
+  EXPECT_FALSE(idle.imbalanced);
+}
+
+TEST(PerfTest, CollectsCountersOrReportsThemUnavailable) {
+  auto task_ptr = std::make_shared<ppc::test::TestPerfTask<std::vector<uint32_t>, uint32_t>>(
+      std::vector<uint32_t>(100000, 1));
+  Perf<std::vector<uint32_t>, uint32_t> perf(task_ptr);
+  PerfAttr attr;
+  attr.collect_counters = true;
+  EXPECT_NO_THROW(perf.PipelineRun(attr));
+
+  const auto counters = perf.GetPerfResults().counters;
+  EXPECT_TRUE(counters.collected);
+  if (const auto task_clock = counters.Get(CounterEvent::kTaskClock)) {
+    EXPECT_GT(*task_clock, 0.0);
+  }
+  EXPECT_NO_THROW(perf.PrintPerfStatistic("collects_counters"));
+}
+
+TEST(PerfTest, CountersCoverThreadsThatExistedBeforeOpening) {
+  std::atomic<bool> go = false;
+  std::thread worker([&go] {
+    while (!go.load()) {
+      std::this_thread::yield();
+    }
+    // Busy for about 50 ms of CPU time while the main thread sleeps
+    const auto begin = std::chrono::steady_clock::now();
+    volatile std::uint64_t sink = 0;
+    while (std::chrono::steady_clock::now() - begin < std::chrono::milliseconds(50)) {
+      sink = sink + 1;
+    }
+  });
+
+  HardwareCounters counters;
+  counters.Start();
+  go = true;
+  worker.join();
+  const auto values = counters.Stop(1);
+  if (const auto task_clock = values.Get(CounterEvent::kTaskClock)) {
+    EXPECT_GT(*task_clock, 2e7);
+  }
+}
+
+TEST(PerfTest, GatherCountersWithoutMpiDescribesLocalRank) {
+  CounterValues local;
+  local.collected = true;
+  local.values.at(static_cast<std::size_t>(CounterEvent::kCycles)) = 100.0;
+  const auto gathered = GatherCountersAcrossRanks(local);
+  EXPECT_EQ(gathered.num_ranks, 1);
+  ASSERT_EQ(gathered.rank_values.size(), 1U);
+  EXPECT_EQ(gathered.rank_values[0].at(static_cast<std::size_t>(CounterEvent::kCycles)), 100.0);
+  EXPECT_EQ(gathered.Get(CounterEvent::kCycles), 100.0);
+  EXPECT_FALSE(gathered.Get(CounterEvent::kInstructions).has_value());
+}
+
+TEST(PerfTest, CountersAreSkippedByDefault) {
+  auto task_ptr = std::make_shared<DummyTask>();
+  Perf<int, int> perf(task_ptr);
+  perf.PipelineRun(PerfAttr{});
+  EXPECT_FALSE(perf.GetPerfResults().counters.collected);
+  EXPECT_FALSE(perf.GetPerfResults().counters.IsAvailable());
+}
+
+TEST(PerfTest, CounterValuesDeriveIpc) {
+  CounterValues counters;
+  EXPECT_FALSE(counters.Ipc().has_value());
+  counters.values.at(static_cast<std::size_t>(CounterEvent::kCycles)) = 200.0;
+  counters.values.at(static_cast<std::size_t>(CounterEvent::kInstructions)) = 300.0;
+  ASSERT_TRUE(counters.Ipc().has_value());
+  EXPECT_DOUBLE_EQ(*counters.Ipc(), 1.5);
+  EXPECT_TRUE(counters.IsAvailable());
+}
+
+TEST(PerfTest, CounterValuesDeriveLlcMissesPerElement) {
+  CounterValues counters;
+  counters.values.at(static_cast<std::size_t>(CounterEvent::kLlcMisses)) = 500.0;
+  EXPECT_FALSE(counters.LlcMissesPerElement().has_value());
+  counters.input_elements = 1000;
+  ASSERT_TRUE(counters.LlcMissesPerElement().has_value());
+  EXPECT_DOUBLE_EQ(*counters.LlcMissesPerElement(), 0.5);
+}
+
+TEST(PerfTest, CountersAreNormalizedByTheDeclaredInputSize) {
+  auto task_ptr = std::make_shared<DummyTask>();
+  Perf<int, int> perf(task_ptr);
+  PerfAttr attr;
+  attr.input_size = 4096;
+  perf.PipelineRun(attr);
+  EXPECT_EQ(perf.GetPerfResults().counters.input_elements, 4096U);
+}
+
+TEST(PerfTest, ComputeStatisticsHandlesSingleSample) {
+  PerfResults res;
+  res.samples_sec = {0.25};
+  ComputeStatistics(res);
+  EXPECT_DOUBLE_EQ(res.time_sec, 0.25);
+  EXPECT_DOUBLE_EQ(res.min_sec, 0.25);
+  EXPECT_DOUBLE_EQ(res.p99_sec, 0.25);
+  EXPECT_DOUBLE_EQ(res.stddev_sec, 0.0);
+}
+
+TEST(PerfResultsWriterTest, AppendsOneJsonLinePerRecord) {
+  const auto path = (std::filesystem::temp_directory_path() / "ppc_perf_records_test.jsonl").string();
+  std::filesystem::remove(path);
+
+  PerfRecord record;
+  record.test_id = "my_ns_seq_enabled";
+  record.type_of_task = "seq";
+  record.task_namespace = GetTaskNamespaceFromTestId(record.test_id, record.type_of_task);
+  record.type_of_running = "task_run";
+  record.num_proc = 4;
+  record.num_threads = 2;
+  record.input_size = 1000;
+  record.results.samples_sec = {0.1, 0.3};
+  ComputeStatistics(record.results);
+
+  {
+    env::detail::set_scoped_environment_variable scoped_out("PPC_PERF_OUTPUT", path);
+    env::detail::set_scoped_environment_variable scoped_sha("PPC_GIT_SHA", "abc123");
+    AppendPerfRecord(record);
+    AppendPerfRecord(record);
+  }
+
+  std::ifstream file(path);
+  std::string line;
+  int lines = 0;
+  while (std::getline(file, line)) {
+    const auto json = nlohmann::json::parse(line);
+    EXPECT_EQ(json["task_namespace"], "my_ns");
+    EXPECT_EQ(json["type_of_task"], "seq");
+    EXPECT_EQ(json["type_of_running"], "task_run");
+    EXPECT_EQ(json["num_proc"], 4);
+    EXPECT_EQ(json["num_threads"], 2);
+    EXPECT_EQ(json["input_size"], 1000);
+    EXPECT_FALSE(json["distributed_input"].get<bool>());
+    EXPECT_EQ(json["git_sha"], "abc123");
+    EXPECT_DOUBLE_EQ(json["time_sec"].get<double>(), 0.2);
+    EXPECT_EQ(json["samples_sec"].size(), 2U);
+    EXPECT_FALSE(json["host"].get<std::string>().empty());
+    lines++;
+  }
+  EXPECT_EQ(lines, 2);
+  file.close();
+  std::filesystem::remove(path);
+}
+
+TEST(PerfResultsWriterTest, SkipsWhenOutputIsUnset) {
+  const auto old = env::get<std::string>("PPC_PERF_OUTPUT");
+  if (old.has_value()) {
+    env::detail::delete_environment_variable("PPC_PERF_OUTPUT");
+  }
+  EXPECT_NO_THROW(AppendPerfRecord(PerfRecord{}));
+  if (old.has_value()) {
+    env::detail::set_environment_variable("PPC_PERF_OUTPUT", *old);
+  }
+}
+
+TEST(PerfThroughputTest, ComputesRatesFromDeclaredWork) {
+  const auto throughput = ComputeThroughput({.elements = 1e6, .bytes = 8e6, .flops = 2e9}, 0.5, {});
+  EXPECT_DOUBLE_EQ(throughput.elements_per_sec, 2e6);
+  EXPECT_DOUBLE_EQ(throughput.bytes_per_sec, 16e6);
+  EXPECT_DOUBLE_EQ(throughput.gflops, 4.0);
+  EXPECT_FALSE(throughput.roofline_fraction.has_value());
+}
+
+TEST(PerfThroughputTest, RooflineUsesMemoryBoundForLowIntensity) {
+  // Intensity 0.25 FLOP/byte at 10 GB/s caps the kernel at 2.5 GFLOP/s, below the 100 GFLOP/s peak
+  const RooflineCeiling ceiling{.bytes_per_sec = 10e9, .flops_per_sec = 100e9};
+  const auto throughput = ComputeThroughput({.bytes = 4e9, .flops = 1e9}, 1.0, ceiling);
+  ASSERT_TRUE(throughput.roofline_fraction.has_value());
+  EXPECT_NEAR(*throughput.roofline_fraction, 0.4, 1e-12);
+}
+
+TEST(PerfThroughputTest, RooflineUsesComputePeakForHighIntensity) {
+  const RooflineCeiling ceiling{.bytes_per_sec = 10e9, .flops_per_sec = 100e9};
+  const auto throughput = ComputeThroughput({.bytes = 1e6, .flops = 50e9}, 1.0, ceiling);
+  ASSERT_TRUE(throughput.roofline_fraction.has_value());
+  EXPECT_NEAR(*throughput.roofline_fraction, 0.5, 1e-12);
+}
+
+TEST(PerfThroughputTest, RooflineUsesBandwidthForDataMovement) {
+  const auto throughput = ComputeThroughput({.bytes = 5e9}, 1.0, {.bytes_per_sec = 10e9});
+  ASSERT_TRUE(throughput.roofline_fraction.has_value());
+  EXPECT_NEAR(*throughput.roofline_fraction, 0.5, 1e-12);
+}
+
+TEST(PerfThroughputTest, PerfRunFillsThroughputForDeclaredWork) {
+  auto task_ptr = std::make_shared<DummyTask>();
+  Perf<int, int> perf(task_ptr);
+  PerfAttr attr;
+  attr.work = {.elements = 256, .bytes = 1024, .flops = 256};
+  // Every begin/end pair is 0.5 s apart
+  double now = 0.0;
+  attr.current_timer = [&now] { return now += 0.5; };
+  perf.TaskRun(attr);
+
+  const auto results = perf.GetPerfResults();
+  EXPECT_DOUBLE_EQ(results.work.bytes, 1024.0);
+  EXPECT_DOUBLE_EQ(results.throughput.elements_per_sec, 512.0);
+  EXPECT_DOUBLE_EQ(results.throughput.bytes_per_sec, 2048.0);
+}
+
+TEST(CalibrationTest, MicroBenchmarksReportPositiveRates) {
+  EXPECT_GT(MeasureStreamTriadOmp(1 << 16, 2), 0.0);
+  EXPECT_GT(MeasureStreamTriadTbb(1 << 16, 2), 0.0);
+  EXPECT_GT(MeasurePeakFlopsPerCore(100000), 0.0);
+}
+
+TEST(CalibrationTest, PhysicalCoresDoNotExceedHardwareThreads) {
+  const int cores = CountPhysicalCores();
+  EXPECT_GE(cores, 1);
+  EXPECT_LE(cores, static_cast<int>(std::max(std::thread::hardware_concurrency(), 1U)));
+}
+
+TEST(CalibrationTest, NetworkBenchmarksAreEmptyWithoutMpi) {
+  const auto ping_pong = MeasurePingPong(8, 10);
+  EXPECT_DOUBLE_EQ(ping_pong.half_round_trip_sec, 0.0);
+  EXPECT_DOUBLE_EQ(ping_pong.bandwidth_bytes_per_sec, 0.0);
+  EXPECT_TRUE(MeasureAllreduceSweep({8, 1024}, 10).empty());
+  EXPECT_TRUE(MeasureDistAllreduceSweep({8, 1024}, 10, ppc::dist::AllreduceAlgorithm::kRing).empty());
+}
+
+TEST(CalibrationTest, CacheRoundTripsPerHost) {
+  const auto dir = std::filesystem::temp_directory_path() / "ppc_calibration_test";
+  env::detail::set_scoped_environment_variable scoped_dir("PPC_CALIBRATION_DIR", dir.string());
+
+  CalibrationResults results;
+  results.host = "test-host";
+  results.num_cores = 4;
+  results.stream_triad_bytes_per_sec = 20e9;
+  results.peak_flops_per_core = 8e9;
+  results.mpi_latency_sec = 1e-6;
+  results.allreduce_sec = {{8, 2e-6}, {1024, 5e-6}};
+  results.dist_allreduce_sec["ring"] = {{8, 4e-6}, {1024, 6e-6}};
+  SaveCalibration(results);
+
+  EXPECT_EQ(GetCalibrationPath("test-host"), (dir / "test-host.json").string());
+  const auto loaded = LoadCalibration("test-host");
+  ASSERT_TRUE(loaded.has_value());
+  EXPECT_EQ(loaded->num_cores, 4);
+  EXPECT_DOUBLE_EQ(loaded->stream_triad_bytes_per_sec, 20e9);
+  EXPECT_DOUBLE_EQ(loaded->PeakFlops(), 32e9);
+  EXPECT_DOUBLE_EQ(loaded->mpi_latency_sec, 1e-6);
+  EXPECT_EQ(loaded->allreduce_sec, results.allreduce_sec);
+  EXPECT_EQ(loaded->dist_allreduce_sec, results.dist_allreduce_sec);
+  EXPECT_FALSE(LoadCalibration("other-host").has_value());
+
+  std::filesystem::remove_all(dir);
+}
+
+TEST(CalibrationTest, RooflineCeilingFallsBackToCachedCalibration) {
+  const auto dir = std::filesystem::temp_directory_path() / "ppc_calibration_ceiling_test";
+  env::detail::set_scoped_environment_variable scoped_dir("PPC_CALIBRATION_DIR", dir.string());
+  env::detail::set_scoped_environment_variable scoped_gflops("PPC_PERF_PEAK_GFLOPS", "50");
+
+  CalibrationResults results;
+  results.host = GetHostName();
+  results.num_cores = 2;
+  results.stream_triad_bytes_per_sec = 12e9;
+  results.peak_flops_per_core = 10e9;
+  SaveCalibration(results);
+
+  // Explicit settings win over the cache
+  const auto ceiling = GetRooflineCeiling();
+  EXPECT_DOUBLE_EQ(ceiling.bytes_per_sec, 12e9);
+  EXPECT_DOUBLE_EQ(ceiling.flops_per_sec, 50e9);
+
+  std::filesystem::remove_all(dir);
+}
+
+TEST(AutoSelectTest, SelectionTableSwitchesAtCrossover) {
+  using enum TypeOfTask;
+  const auto table = BuildSelectionTable({{.input_size = 10, .type_of_task = kSEQ, .time_sec = 1.0},
+                                          {.input_size = 10, .type_of_task = kMPI, .time_sec = 5.0},
+                                          {.input_size = 100, .type_of_task = kSEQ, .time_sec = 2.0},
+                                          {.input_size = 100, .type_of_task = kMPI, .time_sec = 3.0},
+                                          {.input_size = 1000, .type_of_task = kSEQ, .time_sec = 20.0},
+                                          {.input_size = 1000, .type_of_task = kMPI, .time_sec = 4.0},
+                                          {.input_size = 10000, .type_of_task = kMPI, .time_sec = 10.0},
+                                          {.input_size = 10000, .type_of_task = kSEQ, .time_sec = 200.0}});
+  ASSERT_EQ(table.thresholds.size(), 2U);
+  EXPECT_EQ(table.thresholds[0].min_input_size, 0U);
+  EXPECT_EQ(table.thresholds[1].min_input_size, 1000U);
+  EXPECT_EQ(table.Select(1), kSEQ);
+  EXPECT_EQ(table.Select(999), kSEQ);
+  EXPECT_EQ(table.Select(1000), kMPI);
+  EXPECT_EQ(table.Select(1000000), kMPI);
+  EXPECT_EQ(SelectionTable{}.Select(5), kUnknown);
+
+  const auto parsed = SelectionTableFromJson(SelectionTableToJson(table));
+  ASSERT_EQ(parsed.thresholds.size(), 2U);
+  EXPECT_EQ(parsed.thresholds[1].min_input_size, 1000U);
+  EXPECT_EQ(parsed.thresholds[1].type_of_task, kMPI);
+}
+
+TEST(AutoSelectTest, SaveSelectionTableThrowsWhenCacheIsUnwritable) {
+  // A regular file in place of the cache directory: neither root nor anyone else can create files below it
+  const auto blocker = std::filesystem::temp_directory_path() / "ppc_selection_blocker";
+  std::ofstream(blocker) << "not a directory";
+  env::detail::set_scoped_environment_variable scoped_dir("PPC_CALIBRATION_DIR", (blocker / "cache").string());
+
+  const auto table = BuildSelectionTable({{.input_size = 10, .type_of_task = TypeOfTask::kSEQ, .time_sec = 1.0}});
+  EXPECT_THROW(SaveSelectionTable("unwritable_task", table), std::runtime_error);
+  std::filesystem::remove(blocker);
+}
+
+namespace {
+
+// Pipelines that take a fixed time or a time proportional to the input, so the crossover is known
+template <TypeOfTask kType>
+class SleepTask : public ppc::task::Task<std::vector<int>, int> {
+ public:
+  explicit SleepTask(const std::vector<int> &in) {
+    GetInput() = in;
+    SetTypeOfTask(kType);
+    created++;
+  }
+
+  static constexpr TypeOfTask GetStaticTypeOfTask() {
+    return kType;
+  }
+
+  static inline int created = 0;
+
+ protected:
+  bool ValidationImpl() override {
+    return true;
+  }
+
+  bool PreProcessingImpl() override {
+    return true;
+  }
+
+  bool RunImpl() override {
+    const auto duration = kType == TypeOfTask::kSEQ ? std::chrono::microseconds(10 * GetInput().size())
+                                                    : std::chrono::microseconds(2000);
+    std::this_thread::sleep_for(duration);
+    GetOutput() = static_cast<int>(GetInput().size());
+    return true;
+  }
+
+  bool PostProcessingImpl() override {
+    return true;
+  }
+};
+
+using LinearTask = SleepTask<TypeOfTask::kSEQ>;
+using ConstantTask = SleepTask<TypeOfTask::kOMP>;
+
+// Rejects every input, or throws from Run() if kThrows is set
+template <bool kThrows>
+class FailingTask : public ppc::task::Task<std::vector<int>, int> {
+ public:
+  explicit FailingTask(const std::vector<int> &in) {
+    GetInput() = in;
+    SetTypeOfTask(TypeOfTask::kSTL);
+  }
+
+  static constexpr TypeOfTask GetStaticTypeOfTask() {
+    return TypeOfTask::kSTL;
+  }
+
+ protected:
+  bool ValidationImpl() override {
+    return kThrows;
+  }
+
+  bool PreProcessingImpl() override {
+    return true;
+  }
+
+  bool RunImpl() override {
+    throw std::runtime_error("Run failed");
+  }
+
+  bool PostProcessingImpl() override {
+    return true;
+  }
+};
+
+}  // namespace
+
+TEST(AutoSelectTest, AutoSelectorBenchmarksOnceAndRoutesBySize) {
+  const auto dir = std::filesystem::temp_directory_path() / "ppc_auto_select_test";
+  std::filesystem::remove_all(dir);
+  env::detail::set_scoped_environment_variable scoped_dir("PPC_CALIBRATION_DIR", dir.string());
+  const auto make_input = [](std::size_t size) { return std::vector<int>(size, 1); };
+
+  auto selector = MakeAutoSelector<std::vector<int>, LinearTask, ConstantTask>();
+  selector.Calibrate(make_input, {10, 1000}, 2);
+  EXPECT_TRUE(std::filesystem::exists(GetSelectionCachePath(GetHostName())));
+  EXPECT_EQ(selector.Select(std::vector<int>(5)), TypeOfTask::kSEQ);
+  EXPECT_EQ(selector.Select(std::vector<int>(5000)), TypeOfTask::kOMP);
+  auto task = selector.MakeTask(std::vector<int>(5000, 1));
+  EXPECT_EQ(task->GetDynamicTypeOfTask(), TypeOfTask::kOMP);
+
+  // A second selector for the same task reads the cache instead of benchmarking
+  LinearTask::created = 0;
+  auto cached = MakeAutoSelector<std::vector<int>, LinearTask, ConstantTask>();
+  cached.Calibrate(make_input, {10, 1000}, 2);
+  EXPECT_EQ(LinearTask::created, 0);
+  EXPECT_EQ(cached.Select(std::vector<int>(5)), TypeOfTask::kSEQ);
+  EXPECT_EQ(cached.Select(std::vector<int>(5000)), TypeOfTask::kOMP);
+
+  // A task destroyed before the end of its pipeline is reported as a failure
+  ASSERT_TRUE(task->Validation());
+  task->PreProcessing();
+  task->Run();
+  task->PostProcessing();
+  std::filesystem::remove_all(dir);
+}
+
+TEST(AutoSelectTest, BenchmarkAbortsFailedTasksBeforeThrowing) {
+  const auto make_input = [](std::size_t size) { return std::vector<int>(size, 1); };
+  auto rejecting = MakeAutoSelector<std::vector<int>, LinearTask, FailingTask<false>>();
+  EXPECT_THROW((void)rejecting.Benchmark(make_input, {10}, 1), std::runtime_error);
+  auto throwing = MakeAutoSelector<std::vector<int>, LinearTask, FailingTask<true>>();
+  EXPECT_THROW((void)throwing.Benchmark(make_input, {10}, 1), std::runtime_error);
+  EXPECT_FALSE(ppc::util::DestructorFailureFlag::Get());
+}
+
+class TracerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    output_path_ = (std::filesystem::temp_directory_path() / "ppc_tracer_test.json").string();
+    Tracer::Instance().Clear();
+    Tracer::Instance().Enable(output_path_);
+  }
+
+  void TearDown() override {
+    Tracer::Instance().Disable();
+    Tracer::Instance().Clear();
+    std::filesystem::remove(output_path_);
+    std::filesystem::remove(GetRankTracePath(output_path_, 0));
+  }
+
+  std::string output_path_;
+};
+
+TEST_F(TracerTest, RecordsEachPipelineStage) {
+  DummyTask task;
+  task.Validation();
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  const auto events = Tracer::Instance().GetEvents();
+  ASSERT_EQ(events.size(), 4U);
+  const std::vector<std::string> expected = {"Validation", "PreProcessing", "Run", "PostProcessing"};
+  for (std::size_t i = 0; i < events.size(); i++) {
+    EXPECT_EQ(events[i].name, expected[i]);
+    EXPECT_EQ(events[i].category, TraceCategory::kStage);
+    EXPECT_GE(events[i].duration_us, 0.0);
+  }
+}
+
+TEST_F(TracerTest, RecordsMpiEventsOnlyInsideStages) {
+  { const TraceScope outside("MPI_Barrier", TraceCategory::kMpi); }
+  EXPECT_TRUE(Tracer::Instance().GetEvents().empty());
+
+  {
+    const TraceScope stage("Run", TraceCategory::kStage);
+    const TraceScope inside("MPI_Barrier", TraceCategory::kMpi);
+  }
+  const auto events = Tracer::Instance().GetEvents();
+  ASSERT_EQ(events.size(), 2U);
+  EXPECT_EQ(std::string(events[0].name), "MPI_Barrier");
+  EXPECT_EQ(events[0].category, TraceCategory::kMpi);
+  EXPECT_EQ(std::string(events[1].name), "Run");
+  EXPECT_EQ(Tracer::StageDepth(), 0);
+}
+
+TEST_F(TracerTest, FinalizeWritesRankFileAndMergedTrace) {
+  { const TraceScope stage("Run", TraceCategory::kStage); }
+  Tracer::Instance().Finalize();
+  EXPECT_FALSE(Tracer::Instance().IsEnabled());
+
+  ASSERT_TRUE(std::filesystem::exists(GetRankTracePath(output_path_, 0)));
+  std::ifstream file(output_path_);
+  const auto trace = nlohmann::json::parse(file);
+  const auto &trace_events = trace.at("traceEvents");
+  // process_name + process_sort_index metadata, then the stage
+  ASSERT_EQ(trace_events.size(), 3U);
+  EXPECT_EQ(trace_events[0]["ph"], "M");
+  EXPECT_EQ(trace_events[2]["name"], "Run");
+  EXPECT_EQ(trace_events[2]["ph"], "X");
+  EXPECT_EQ(trace_events[2]["pid"], 0);
+}
+
+TEST_F(TracerTest, FinalizeReportsUnwritableRankFile) {
+  const auto missing_dir = std::filesystem::temp_directory_path() / "ppc_trace_missing_dir";
+  std::filesystem::remove_all(missing_dir);
+  Tracer::Instance().Enable((missing_dir / "trace.json").string());
+  { const TraceScope stage("Run", TraceCategory::kStage); }
+
+  EXPECT_THROW(Tracer::Instance().Finalize(), std::runtime_error);
+  EXPECT_FALSE(std::filesystem::exists(missing_dir));
+}
+
+TEST_F(TracerTest, DisableRemovesStageObserver) {
+  EXPECT_EQ(ppc::task::GetStageObserver(), &Tracer::Instance());
+  Tracer::Instance().Disable();
+  EXPECT_EQ(ppc::task::GetStageObserver(), nullptr);
+
+  DummyTask task;
+  task.Validation();
+  EXPECT_TRUE(Tracer::Instance().GetEvents().empty());
+}
+
+TEST(TracerMergeTest, MergesEventsOfAllRanks) {
+  const auto dir = std::filesystem::temp_directory_path();
+  const auto rank0 = (dir / "ppc_merge_rank0.json").string();
+  const auto rank1 = (dir / "ppc_merge_rank1.json").string();
+  const auto merged = (dir / "ppc_merge.json").string();
+  std::ofstream(rank0) << R"({"traceEvents": [{"name": "Run", "ph": "X", "pid": 0}]})";
+  std::ofstream(rank1) << R"({"traceEvents": [{"name": "MPI_Recv", "ph": "X", "pid": 1}]})";
+
+  MergeTraceFiles({rank0, rank1}, merged);
+  std::ifstream file(merged);
+  const auto trace = nlohmann::json::parse(file);
+  ASSERT_EQ(trace.at("traceEvents").size(), 2U);
+  EXPECT_EQ(trace["traceEvents"][1]["pid"], 1);
+  EXPECT_THROW(MergeTraceFiles({(dir / "ppc_missing_rank.json").string()}, merged), std::runtime_error);
+
+  std::filesystem::remove(rank0);
+  std::filesystem::remove(rank1);
+  std::filesystem::remove(merged);
+}
+
+TEST(MemoryTrackerTest, PerfRunReportsMemoryPerRankAndStage) {
+  auto task_ptr = std::make_shared<DummyTask>();
+  Perf<int, int> perf(task_ptr);
+  PerfAttr attr;
+  attr.num_running = 2;
+  perf.PipelineRun(attr);
+
+  const auto results = perf.GetPerfResults();
+  ASSERT_EQ(results.memory.peak_rss_bytes.size(), 1U);
+  EXPECT_EQ(results.memory.num_ranks, 1);
+  EXPECT_GT(results.memory.MaxPeakRssBytes(), 0U);
+  EXPECT_GT(results.stage_memory.run.peak_rss_bytes, 0U);
+  EXPECT_LE(task_ptr->GetStageMemory().Peak().peak_rss_bytes, ppc::task::GetPeakRssBytes());
+
+  PerfRecord record;
+  record.results = results;
+  const auto json = PerfRecordToJson(record);
+  EXPECT_EQ(json["memory"]["peak_rss_bytes"].size(), 1U);
+  EXPECT_TRUE(json["memory"]["stages"].contains("run"));
+  EXPECT_TRUE(json["memory"]["stages"]["run"].contains("rss_delta_bytes"));
+  EXPECT_NO_THROW(perf.PrintPerfStatistic("memory_report"));
+}
+
+TEST(PerfResultsWriterTest, GetInputSizeHandlesRangesTuplesAndScalars) {
+  EXPECT_EQ(GetInputSize(std::vector<int>(7)), 7U);
+  EXPECT_EQ(GetInputSize(std::string("abc")), 3U);
+  EXPECT_EQ(GetInputSize(std::make_tuple(std::vector<double>(4), std::string("ab"), 5)), 6U);
+  EXPECT_EQ(GetInputSize(42), 0U);
+  EXPECT_EQ(GetInputSize(std::make_shared<const std::vector<int>>(9)), 9U);
+  EXPECT_EQ(GetInputSize(std::shared_ptr<const std::vector<int>>{}), 0U);
+  EXPECT_EQ(GetInputSize(ppc::task::MakeDistributedInput<int>({6, 2}, 3, 1, [](std::span<int>, std::size_t) {})), 12U);
+}
+
+TEST(PerfResultsWriterTest, NamespaceFallsBackToTestId) {
+  EXPECT_EQ(GetTaskNamespaceFromTestId("a_b_mpi_enabled", "mpi"), "a_b");
+  EXPECT_EQ(GetTaskNamespaceFromTestId("a_b_mpi_enabled", "omp"), "a_b_mpi_enabled");
+}
+
+TEST(PerfTestUtilTest, MakeAllSizedPerfTasksCreatesCasePerModeAndSize) {
+  const auto path = (std::filesystem::temp_directory_path() / "sized_perf_settings.json").string();
+  std::ofstream(path) << R"({"tasks": {"seq": "enabled"}})";
+
+  using SizedTask = ppc::test::SizedPerfTask<std::vector<int>, int>;
+  const auto params = ppc::util::MakeAllSizedPerfTasks<std::vector<int>, SizedTask>(path, {10, 1000});
+  std::filesystem::remove(path);
+
+  ASSERT_EQ(params.size(), 4U);
+  const std::vector<std::pair<PerfResults::TypeOfRunning, std::size_t>> expected = {
+      {PerfResults::TypeOfRunning::kPipeline, 10},
+      {PerfResults::TypeOfRunning::kTaskRun, 10},
+      {PerfResults::TypeOfRunning::kPipeline, 1000},
+      {PerfResults::TypeOfRunning::kTaskRun, 1000}};
+  for (std::size_t i = 0; i < params.size(); i++) {
+    const auto &[getter, name, mode, size, distributed] = params[i];
+    EXPECT_EQ(mode, expected[i].first);
+    EXPECT_FALSE(distributed);
+    EXPECT_EQ(size, expected[i].second);
+    EXPECT_TRUE(name.ends_with("_seq_enabled_size" + std::to_string(size))) << name;
+    EXPECT_EQ(getter(std::vector<int>(size, 1))->GetInput().size(), size);
+  }
+}
+
+TEST(PerfTestUtilTest, RequestedInputSizeIsScaledAndChecked) {
+  using SizedTask = ppc::test::SizedPerfTask<std::vector<int>, int>;
+  // Exposes the protected check without a running test case
+  struct PerfTests : ppc::util::BaseRunPerfTests<std::vector<int>, int> {
+    using ppc::util::BaseRunPerfTests<std::vector<int>, int>::GetRequestedInputSize;
+  };
+  const auto path = (std::filesystem::temp_directory_path() / "requested_size_settings.json").string();
+  std::ofstream(path) << R"({"tasks": {"seq": "enabled"}})";
+  auto param = ppc::util::MakeAllSizedPerfTasks<std::vector<int>, SizedTask>(path, {10})[0];
+  std::filesystem::remove(path);
+
+  env::detail::set_scoped_environment_variable scoped("PPC_PERF_SIZE_SCALE", "4");
+  EXPECT_EQ(PerfTests::GetRequestedInputSize(param), 40U);
+
+  std::get<static_cast<std::size_t>(ppc::util::GTestParamIndex::kInputSize)>(param) =
+      std::numeric_limits<std::size_t>::max() / 2;
+  EXPECT_THROW((void)PerfTests::GetRequestedInputSize(param), std::overflow_error);
+}
+
 TEST(PerfTest, PrintPerfStatisticThrowsOnNone) {
   {
     auto task_ptr = std::make_shared<DummyTask>();
@@ -364,6 +1129,7 @@ TEST(PerfTest, GetStringParamNameTest) {
   EXPECT_EQ(GetStringParamName(PerfResults::TypeOfRunning::kTaskRun), "task_run");
   EXPECT_EQ(GetStringParamName(PerfResults::TypeOfRunning::kPipeline), "pipeline");
   EXPECT_EQ(GetStringParamName(PerfResults::TypeOfRunning::kNone), "none");
+  EXPECT_EQ(GetStringParamName(PerfResults::TypeOfRunning::kWarm), "warm");
 }
 
 TEST(TaskTest, DestructorInvalidPipelineOrderTerminatesPartialPipeline) {
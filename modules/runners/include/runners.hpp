@@ -49,4 +49,20 @@ int Init(int argc, char **argv);
 /// @return Exit code from RUN_ALL_TESTS.
 int SimpleInit(int argc, char **argv);
 
+/// @brief Runs the hardware calibration suite and caches the results for this host.
+/// @details Measures STREAM triad bandwidth, single-core FLOP rate and MPI latency/bandwidth; rank 0
+/// prints the results and writes them to ppc::performance::GetCalibrationPath().
+/// @param argc Argument count.
+/// @param argv Argument vector.
+/// @return EXIT_SUCCESS, or an MPI error code if initialization/finalization fails.
+int Calibrate(int argc, char **argv);
+
+/// @brief Converts a whitespace-separated text data file into the binary test data format.
+/// @details Usage: `<input> <dtype> <header dims> [output]`, e.g. `matrix.txt int32 2,0`. The output defaults to
+/// the binary variant of the input (see ppc::util::GetBinaryVariantPath()).
+/// @param argc Argument count.
+/// @param argv Argument vector.
+/// @return EXIT_SUCCESS, or EXIT_FAILURE on invalid arguments or conversion errors.
+int ConvertTestData(int argc, char **argv);
+
 }  // namespace ppc::runners
@@ -4,6 +4,7 @@
 #include <mpi.h>
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <exception>
@@ -11,11 +12,17 @@
 #include <iostream>
 #include <memory>
 #include <random>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "oneapi/tbb/global_control.h"
+#include "performance/include/calibration.hpp"
+#include "performance/include/tracer.hpp"
+#include "task/include/async_task.hpp"
+#include "util/include/binary_data.hpp"
 #include "util/include/util.hpp"
 
 namespace ppc::runners {
@@ -124,6 +131,20 @@ bool HasFlag(int argc, char **argv, std::string_view flag) {
   return false;
 }
 
+// Creates the tracer, which installs itself as stage observer of the tasks when PPC_TRACE_OUTPUT is set
+void StartTrace() {
+  static_cast<void>(ppc::performance::Tracer::Instance());
+}
+
+// Writes the timeline collected with PPC_TRACE_OUTPUT; collective when MPI is initialized
+void FinalizeTrace() {
+  try {
+    ppc::performance::Tracer::Instance().Finalize();
+  } catch (const std::exception &e) {
+    std::cerr << std::format("[  ERROR  ] Failed to write trace: {}", e.what()) << '\n';
+  }
+}
+
 int RunAllTestsSafely() {
   try {
     return RunAllTests();
@@ -140,9 +161,11 @@ int RunAllTestsSafely() {
 }  // namespace
 
 int Init(int argc, char **argv) {
-  const int init_res = MPI_Init(&argc, &argv);
+  // Serialized calls from other threads let ppc::task::RunPipelineAsync() run process tasks on a progress thread
+  int provided = MPI_THREAD_SINGLE;
+  const int init_res = MPI_Init_thread(&argc, &argv, MPI_THREAD_SERIALIZED, &provided);
   if (init_res != MPI_SUCCESS) {
-    std::cerr << std::format("[  ERROR  ] MPI_Init failed with code {}", init_res) << '\n';
+    std::cerr << std::format("[  ERROR  ] MPI_Init_thread failed with code {}", init_res) << '\n';
     MPI_Abort(MPI_COMM_WORLD, init_res);
     return init_res;
   }
@@ -166,7 +189,11 @@ int Init(int argc, char **argv) {
   }
   listeners.Append(new UnreadMessagesDetector());
 
+  StartTrace();
   const int status = RunAllTestsSafely();
+  // The progress thread of asynchronous process tasks makes MPI calls, so it has to end before MPI_Finalize()
+  ppc::task::ShutdownProgressThread();
+  FinalizeTrace();
 
   const int finalize_res = MPI_Finalize();
   if (finalize_res != MPI_SUCCESS) {
@@ -177,12 +204,70 @@ int Init(int argc, char **argv) {
   return status;
 }
 
+int Calibrate(int argc, char **argv) {
+  const int init_res = MPI_Init(&argc, &argv);
+  if (init_res != MPI_SUCCESS) {
+    std::cerr << std::format("[  ERROR  ] MPI_Init failed with code {}", init_res) << '\n';
+    MPI_Abort(MPI_COMM_WORLD, init_res);
+    return init_res;
+  }
+
+  int status = EXIT_SUCCESS;
+  const auto results = ppc::performance::RunCalibration();
+  int rank = -1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  if (rank == 0) {
+    std::cout << ppc::performance::CalibrationToJson(results).dump(2) << '\n';
+    try {
+      ppc::performance::SaveCalibration(results);
+      std::cout << "Calibration saved to " << ppc::performance::GetCalibrationPath(results.host) << '\n';
+    } catch (const std::exception &e) {
+      std::cerr << std::format("[  ERROR  ] {}", e.what()) << '\n';
+      status = EXIT_FAILURE;
+    }
+  }
+
+  const int finalize_res = MPI_Finalize();
+  if (finalize_res != MPI_SUCCESS) {
+    std::cerr << std::format("[  ERROR  ] MPI_Finalize failed with code {}", finalize_res) << '\n';
+    MPI_Abort(MPI_COMM_WORLD, finalize_res);
+    return finalize_res;
+  }
+  return status;
+}
+
+int ConvertTestData(int argc, char **argv) {
+  const std::vector<std::string> args(argv, argv + argc);
+  if (args.size() < 4 || args.size() > 5) {
+    std::cerr << std::format("Usage: {} <input> <dtype> <header dims, e.g. 2,0> [output]", args.at(0)) << '\n';
+    return EXIT_FAILURE;
+  }
+
+  try {
+    std::vector<std::size_t> header_dims;
+    std::stringstream dims_stream(args[3]);
+    for (std::string dims; std::getline(dims_stream, dims, ',');) {
+      header_dims.push_back(std::stoul(dims));
+    }
+    const auto output = args.size() == 5 ? args[4] : ppc::util::GetBinaryVariantPath(args[1]);
+    ppc::util::ConvertTextToBinary(args[1], output, ppc::util::ParseDType(args[2]), header_dims);
+    std::cout << std::format("Converted {} to {}", args[1], output) << '\n';
+  } catch (const std::exception &e) {
+    std::cerr << std::format("[  ERROR  ] {}", e.what()) << '\n';
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
 int SimpleInit(int argc, char **argv) {
   // Limit the number of threads in TBB
   tbb::global_control control(tbb::global_control::max_allowed_parallelism, ppc::util::GetNumThreads());
 
   testing::InitGoogleTest(&argc, argv);
-  return RunAllTests();
+  StartTrace();
+  const int status = RunAllTests();
+  FinalizeTrace();
+  return status;
 }
 
 }  // namespace ppc::runners
@@ -0,0 +1,171 @@
+// Replaceable global operator new/delete that feed ppc::task::HeapTracker. Linked into the test runners
+// only (see tasks/CMakeLists.txt); sizes are taken from the allocator's usable size so that unsized delete
+// is accounted exactly. Platforms without such a query keep the default operators.
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "task/include/memory_tracker.hpp"
+
+#if defined(__linux__) || defined(__APPLE__)
+
+#  ifdef __APPLE__
+#    include <malloc/malloc.h>
+#  else
+#    include <malloc.h>
+#  endif
+
+using ppc::task::HeapTracker;
+
+namespace {
+
+std::size_t UsableSize(void *ptr) {
+#  ifdef __APPLE__
+  return malloc_size(ptr);
+#  else
+  return malloc_usable_size(ptr);
+#  endif
+}
+
+void *Allocate(std::size_t size) noexcept {
+  void *ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr != nullptr) {
+    HeapTracker::RecordAllocation(UsableSize(ptr));
+  }
+  return ptr;
+}
+
+void *AllocateAligned(std::size_t size, std::align_val_t alignment) noexcept {
+  void *ptr = nullptr;
+  if (posix_memalign(&ptr, static_cast<std::size_t>(alignment), size == 0 ? 1 : size) != 0) {
+    return nullptr;
+  }
+  HeapTracker::RecordAllocation(UsableSize(ptr));
+  return ptr;
+}
+
+void *AllocateOrThrow(std::size_t size) {
+  while (true) {
+    if (void *ptr = Allocate(size)) {
+      return ptr;
+    }
+    auto handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void *AllocateAlignedOrThrow(std::size_t size, std::align_val_t alignment) {
+  while (true) {
+    if (void *ptr = AllocateAligned(size, alignment)) {
+      return ptr;
+    }
+    auto handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void Deallocate(void *ptr) noexcept {
+  if (ptr != nullptr) {
+    HeapTracker::RecordDeallocation(UsableSize(ptr));
+    std::free(ptr);
+  }
+}
+
+// Runs before main(); allocations made earlier are still counted, only IsInstalled() is delayed
+[[maybe_unused]] const bool kInstalled = [] {
+  HeapTracker::Install();
+  return true;
+}();
+
+}  // namespace
+
+// NOLINTBEGIN(misc-new-delete-overloads, cert-dcl54-cpp)
+void *operator new(std::size_t size) {
+  return AllocateOrThrow(size);
+}
+
+void *operator new[](std::size_t size) {
+  return AllocateOrThrow(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t & /*unused*/) noexcept {
+  return Allocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t & /*unused*/) noexcept {
+  return Allocate(size);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+  return AllocateAlignedOrThrow(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+  return AllocateAlignedOrThrow(size, alignment);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t & /*unused*/) noexcept {
+  return AllocateAligned(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t & /*unused*/) noexcept {
+  return AllocateAligned(size, alignment);
+}
+
+void operator delete(void *ptr) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete(void *ptr, std::size_t /*size*/) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t /*size*/) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t & /*unused*/) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t & /*unused*/) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t /*alignment*/) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t /*alignment*/) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete(void *ptr, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t /*alignment*/, const std::nothrow_t & /*unused*/) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t /*alignment*/, const std::nothrow_t & /*unused*/) noexcept {
+  Deallocate(ptr);
+}
+// NOLINTEND(misc-new-delete-overloads, cert-dcl54-cpp)
+
+#endif
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "task/include/task.hpp"
+
+namespace ppc::task {
+
+namespace detail {
+
+/// @brief Runs submitted jobs one at a time, in submission order, on a thread of its own.
+/// @details The destructor runs the jobs that are still queued before joining the thread.
+class SerialExecutor {
+ public:
+  SerialExecutor();
+  ~SerialExecutor();
+
+  SerialExecutor(const SerialExecutor &) = delete;
+  SerialExecutor &operator=(const SerialExecutor &) = delete;
+  SerialExecutor(SerialExecutor &&) = delete;
+  SerialExecutor &operator=(SerialExecutor &&) = delete;
+
+  /// @brief Queues `job` behind all jobs submitted before it.
+  void Submit(std::function<void()> job);
+
+ private:
+  void Loop();
+
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::deque<std::function<void()>> jobs_;
+  bool stopping_ = false;
+  std::thread thread_;
+};
+
+/// @brief Returns true for task types whose stages communicate across ranks (kMPI, kALL).
+bool IsProcessTask(TypeOfTask type_of_task);
+
+/// @brief Runs `job` on the progress thread that makes the MPI calls of all asynchronous process tasks.
+/// @details Jobs run one after another in submission order, so collectives keep the same order on every rank.
+/// If MPI was initialized with less than MPI_THREAD_SERIALIZED, `job` runs on the calling thread instead.
+void SubmitProcessJob(std::function<void()> job);
+
+/// @brief Runs `job` in the TBB task arena shared by asynchronous thread tasks.
+void EnqueueThreadJob(std::function<void()> job);
+
+}  // namespace detail
+
+/// @brief Runs the process pipelines that are still queued and joins the progress thread.
+/// @details The test runners call it before MPI_Finalize(); process tasks started afterwards get a new thread.
+void ShutdownProgressThread();
+
+/// @brief Handle of a pipeline started by RunPipelineAsync(); holds false if a stage returned false.
+/// @details Exceptions thrown by a stage are rethrown by get().
+using PipelineFuture = std::future<bool>;
+
+/// @brief Runs Validation(), PreProcessing(), Run() and PostProcessing() of `task` without blocking the caller.
+/// @details Thread tasks run in a TBB task arena. Process tasks (kMPI, kALL) run on a single progress thread, one
+/// pipeline after another; every rank has to start the same pipelines in the same order, and the caller must not
+/// make MPI calls of its own until their futures are ready. The stages stop at the first one that returns false or
+/// throws, and the task is then aborted (see Task::AbortPipeline()).
+/// @param task Task to run; kept alive until its pipeline has finished.
+/// @return Future that becomes ready when the pipeline has finished.
+template <typename InType, typename OutType>
+PipelineFuture RunPipelineAsync(TaskPtr<InType, OutType> task) {
+  const bool process_task = detail::IsProcessTask(task->GetDynamicTypeOfTask());
+  auto pipeline = std::make_shared<std::packaged_task<bool()>>(
+      [task = std::move(task)] { return RunPipeline(*task); });
+  auto future = pipeline->get_future();
+  auto job = [pipeline] { (*pipeline)(); };
+  if (process_task) {
+    detail::SubmitProcessJob(std::move(job));
+  } else {
+    detail::EnqueueThreadJob(std::move(job));
+  }
+  return future;
+}
+
+template <typename TaskType>
+/// @brief Runs the pipelines of a stream of inputs, one TaskType per input, overlapping consecutive inputs.
+/// @details Thread tasks pass three stages, each on a thread of its own: Validation() and PreProcessing(), then
+/// Run(), then PostProcessing(). While input i runs, input i + 1 is preprocessed and input i - 1 postprocessed.
+/// Process tasks run their whole pipeline on the progress thread, in input order: stages of different inputs
+/// issuing collectives at the same time could be matched in a different order on another rank. They overlap
+/// only with the caller.
+/// @tparam TaskType Task class of one input.
+class PipelineStream {
+ public:
+  using InType = TaskInputType<TaskType>;
+  using OutType = TaskOutputType<TaskType>;
+
+  PipelineStream() : process_task_(detail::IsProcessTask(TaskType::GetStaticTypeOfTask())) {
+    if (!process_task_) {
+      for (auto &lane : lanes_) {
+        lane = std::make_unique<detail::SerialExecutor>();
+      }
+    }
+  }
+
+  /// @brief Waits for every pushed input.
+  ~PipelineStream() {
+    Wait();
+  }
+
+  PipelineStream(const PipelineStream &) = delete;
+  PipelineStream &operator=(const PipelineStream &) = delete;
+  PipelineStream(PipelineStream &&) = delete;
+  PipelineStream &operator=(PipelineStream &&) = delete;
+
+  /// @brief Starts the pipeline of `input` behind the inputs pushed before it.
+  /// @return Future holding the output of the task. It rethrows exceptions of the stages and throws
+  /// std::runtime_error if a stage returned false.
+  std::future<OutType> Push(InType input) {
+    auto item = std::make_shared<Item>();
+    item->input = std::move(input);
+    auto output = item->output.get_future();
+    if (process_task_) {
+      detail::SubmitProcessJob([item] {
+        Prepare(*item);
+        Execute(*item);
+        Finish(*item);
+      });
+    } else {
+      lanes_[0]->Submit([this, item] {
+        Prepare(*item);
+        lanes_[1]->Submit([this, item] {
+          Execute(*item);
+          lanes_[2]->Submit([item] { Finish(*item); });
+        });
+      });
+    }
+    return output;
+  }
+
+  /// @brief Blocks until every input pushed so far has finished.
+  void Wait() {
+    std::promise<void> done;
+    auto drained = done.get_future();
+    if (process_task_) {
+      detail::SubmitProcessJob([&done] { done.set_value(); });
+    } else {
+      // Follows the path of an input through all lanes, so it arrives after every input pushed before
+      lanes_[0]->Submit([this, &done] {
+        lanes_[1]->Submit([this, &done] { lanes_[2]->Submit([&done] { done.set_value(); }); });
+      });
+    }
+    drained.wait();
+  }
+
+ private:
+  struct Item {
+    InType input;
+    std::shared_ptr<TaskType> task;
+    std::exception_ptr error;
+    std::promise<OutType> output;
+  };
+
+  // Runs a stage unless an earlier one failed, recording its failure in the item and aborting its task
+  template <typename Stage>
+  static void RunStage(Item &item, const char *stage_name, Stage &&stage) {
+    if (item.error) {
+      return;
+    }
+    try {
+      if (!std::forward<Stage>(stage)()) {
+        throw std::runtime_error(std::string(stage_name) + " failed");
+      }
+    } catch (...) {
+      item.error = std::current_exception();
+      if (item.task) {
+        item.task->AbortPipeline();
+      }
+    }
+  }
+
+  static void Prepare(Item &item) {
+    RunStage(item, "Validation/PreProcessing", [&item] {
+      item.task = TaskGetter<TaskType, InType>(std::move(item.input));
+      return item.task->Validation() && item.task->PreProcessing();
+    });
+  }
+
+  static void Execute(Item &item) {
+    RunStage(item, "Run", [&item] { return item.task->Run(); });
+  }
+
+  static void Finish(Item &item) {
+    RunStage(item, "PostProcessing", [&item] { return item.task->PostProcessing(); });
+    if (item.error) {
+      item.output.set_exception(item.error);
+    } else {
+      item.output.set_value(std::move(item.task->GetOutput()));
+    }
+  }
+
+  bool process_task_;
+  std::array<std::unique_ptr<detail::SerialExecutor>, 3> lanes_;
+};
+
+}  // namespace ppc::task
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "task/include/task.hpp"
+
+namespace ppc::task {
+
+/// @brief Satisfied by task classes that can run many of their instances at once.
+/// @details Such a class declares `static bool RunBatch(std::span<TaskType *const> batch)`, which does the work
+/// of RunImpl() for every task of the batch (reading GetInput() and writing GetOutput() of each), e.g. with one
+/// collective over all items instead of one per item. It is called on every rank with the same batch.
+template <typename TaskType>
+concept BatchRunnable = requires(std::span<TaskType *const> batch) {
+  { TaskType::RunBatch(batch) } -> std::convertible_to<bool>;
+};
+
+template <typename InType, typename OutType>
+/// @brief Runs a batch of independent inputs through one pipeline.
+/// @details Every input gets its own task, created by the factory, and each stage of the batch runs that stage
+/// of all of them. Run() either hands the whole batch to a batched runner or, without one, calls Run() of every
+/// task in turn. Output `i` is the output of the task for input `i`. The inputs are moved into their tasks, so
+/// GetInput() of the batch stays empty; read them through GetItemTasks().
+/// @tparam InType Input data type of one item.
+/// @tparam OutType Output data type of one item.
+class BatchTask : public Task<std::vector<InType>, std::vector<OutType>> {
+ public:
+  using ItemTaskPtr = TaskPtr<InType, OutType>;
+  using ItemTaskFactory = std::function<ItemTaskPtr(InType)>;
+  using BatchRunner = std::function<bool(std::span<const ItemTaskPtr>)>;
+
+  /// @brief Creates one task per input.
+  /// @param inputs Inputs of the batch.
+  /// @param make_item_task Creates the task for one input.
+  /// @param run_batch Runs all tasks at once after their PreProcessing(); empty to run them one by one.
+  BatchTask(std::vector<InType> inputs, const ItemTaskFactory &make_item_task, BatchRunner run_batch = {})
+      : run_batch_(std::move(run_batch)) {
+    items_.reserve(inputs.size());
+    for (auto &input : inputs) {
+      items_.push_back(make_item_task(std::move(input)));
+    }
+  }
+
+  // A batch that was aborted or never finished leaves its items in the middle of the pipeline; the batch itself
+  // reports that on destruction, so its items end quietly
+  ~BatchTask() override {
+    for (const auto &item : items_) {
+      if (item->stage_ != Task<InType, OutType>::PipelineStage::kDone) {
+        item->AbortPipeline();
+      }
+    }
+  }
+
+  BatchTask(const BatchTask &) = delete;
+  BatchTask &operator=(const BatchTask &) = delete;
+  BatchTask(BatchTask &&) = delete;
+  BatchTask &operator=(BatchTask &&) = delete;
+
+  /// @brief Returns true if Run() uses the batched runner rather than a loop over the items.
+  [[nodiscard]] bool IsBatched() const {
+    return static_cast<bool>(run_batch_);
+  }
+
+  /// @brief Returns the task of every input, in input order.
+  [[nodiscard]] std::span<const ItemTaskPtr> GetItemTasks() const {
+    return items_;
+  }
+
+ protected:
+  // Every stage visits all items even after one fails, so that no item is left behind in the pipeline
+  bool ValidationImpl() override {
+    bool valid = true;
+    for (const auto &item : items_) {
+      item->GetStateOfTesting() = this->GetStateOfTesting();
+      valid = item->Validation() && valid;
+    }
+    return valid;
+  }
+
+  bool PreProcessingImpl() override {
+    bool prepared = true;
+    for (const auto &item : items_) {
+      prepared = item->PreProcessing() && prepared;
+    }
+    return prepared;
+  }
+
+  bool RunImpl() override {
+    if (!run_batch_) {
+      bool done = true;
+      for (const auto &item : items_) {
+        done = item->Run() && done;
+      }
+      return done;
+    }
+    for (const auto &item : items_) {
+      item->BeginRun();
+    }
+    return run_batch_(items_);
+  }
+
+  bool PostProcessingImpl() override {
+    bool done = true;
+    auto &outputs = this->GetOutput();
+    outputs.resize(items_.size());
+    for (std::size_t i = 0; i < items_.size(); i++) {
+      done = items_[i]->PostProcessing() && done;
+      outputs[i] = items_[i]->GetOutput();
+    }
+    return done;
+  }
+
+ private:
+  std::vector<ItemTaskPtr> items_;
+  BatchRunner run_batch_;
+};
+
+/// @brief Creates a BatchTask running one TaskType per input.
+/// @details The batch uses TaskType::RunBatch() if TaskType is BatchRunnable and a loop over Run() otherwise.
+/// It reports the type of TaskType as its dynamic type.
+/// @tparam TaskType Task class of one item.
+/// @param inputs Inputs of the batch.
+template <typename TaskType>
+std::shared_ptr<BatchTask<TaskInputType<TaskType>, TaskOutputType<TaskType>>> MakeBatchTask(
+    std::vector<TaskInputType<TaskType>> inputs) {
+  using InType = TaskInputType<TaskType>;
+  using OutType = TaskOutputType<TaskType>;
+  using Batch = BatchTask<InType, OutType>;
+
+  typename Batch::BatchRunner run_batch;
+  if constexpr (BatchRunnable<TaskType>) {
+    run_batch = [](std::span<const typename Batch::ItemTaskPtr> items) {
+      std::vector<TaskType *> batch;
+      batch.reserve(items.size());
+      for (const auto &item : items) {
+        batch.push_back(static_cast<TaskType *>(item.get()));
+      }
+      return static_cast<bool>(TaskType::RunBatch(std::span<TaskType *const>(batch)));
+    };
+  }
+  auto task = std::make_shared<Batch>(std::move(inputs), TaskGetter<TaskType, InType>, std::move(run_batch));
+  task->SetTypeOfTask(TaskType::GetStaticTypeOfTask());
+  return task;
+}
+
+}  // namespace ppc::task
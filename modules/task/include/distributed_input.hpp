@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "dist/include/block_range.hpp"
+
+namespace ppc::task {
+
+template <typename T>
+/// @brief Task input of which every rank may hold only its own block.
+/// @details The global array is row-major with shape `global_shape`; blocks split its outermost dimension
+/// (ppc::dist::GetBlockRange over the rows). A task that declares AcceptsDistributedInput() receives, in distributed
+/// mode, only the rows of the calling rank and can skip scattering them from the root. Otherwise the whole
+/// array is present (`first_row == 0`, all rows local), as for any other input.
+/// @tparam T Element type.
+struct DistributedInput {
+  /// Shape of the global array, outermost dimension first; empty for a 1-D array of `local.size()` elements
+  std::vector<std::size_t> global_shape;
+  /// First global row held by this rank
+  std::size_t first_row = 0;
+  /// Rows [first_row, first_row + GetLocalRows()) of the global array, row-major
+  std::vector<T> local;
+  /// True if each rank holds only its own block
+  bool distributed = false;
+
+  /// @brief Number of rows of the global array.
+  [[nodiscard]] std::size_t GetGlobalRows() const {
+    return global_shape.empty() ? local.size() : global_shape.front();
+  }
+
+  /// @brief Number of elements in one row (1 for 1-D arrays).
+  [[nodiscard]] std::size_t GetRowSize() const {
+    std::size_t row_size = 1;
+    for (std::size_t dim = 1; dim < global_shape.size(); dim++) {
+      row_size *= global_shape[dim];
+    }
+    return row_size;
+  }
+
+  /// @brief Number of elements of the global array.
+  [[nodiscard]] std::size_t GlobalSize() const {
+    return GetGlobalRows() * GetRowSize();
+  }
+
+  /// @brief Number of rows held by this rank.
+  [[nodiscard]] std::size_t GetLocalRows() const {
+    const std::size_t row_size = GetRowSize();
+    return row_size == 0 ? 0 : local.size() / row_size;
+  }
+
+  /// @brief Global index of the first local element.
+  [[nodiscard]] std::size_t GetFirstIndex() const {
+    return first_row * GetRowSize();
+  }
+
+  /// @brief Block of rows owned by `rank` out of `num_ranks` in distributed mode.
+  [[nodiscard]] ppc::dist::BlockRange GetRowRange(int num_ranks, int rank) const {
+    return ppc::dist::GetBlockRange(GetGlobalRows(), num_ranks, rank);
+  }
+};
+
+/// @brief Wraps a whole array held by the caller into a non-distributed DistributedInput.
+/// @param values Global array, row-major.
+/// @param global_shape Its shape; empty for a 1-D array.
+template <typename T>
+DistributedInput<T> MakeWholeInput(std::vector<T> values, std::vector<std::size_t> global_shape = {}) {
+  if (global_shape.empty()) {
+    global_shape.push_back(values.size());
+  }
+  return {.global_shape = std::move(global_shape), .first_row = 0, .local = std::move(values), .distributed = false};
+}
+
+/// @brief Builds the input of one rank, generating only the elements it holds.
+/// @param global_shape Shape of the global array, outermost dimension first.
+/// @param num_ranks Number of ranks the rows are split over; 1 builds the whole array.
+/// @param rank Rank whose block is built.
+/// @param fill Called once as fill(block, first_index) to generate the elements of the block, where
+/// `first_index` is the global index of block[0] (see ppc::util::datagen for generators that support this).
+template <typename T>
+DistributedInput<T> MakeDistributedInput(std::vector<std::size_t> global_shape, int num_ranks, int rank,
+                                         const std::function<void(std::span<T>, std::size_t)> &fill) {
+  DistributedInput<T> input{
+      .global_shape = std::move(global_shape), .first_row = 0, .local = {}, .distributed = num_ranks > 1};
+  const auto rows = input.GetRowRange(num_ranks, rank);
+  input.first_row = rows.begin;
+  input.local.resize(rows.count * input.GetRowSize());
+  fill(std::span<T>(input.local), input.GetFirstIndex());
+  return input;
+}
+
+}  // namespace ppc::task
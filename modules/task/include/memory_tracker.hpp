@@ -0,0 +1,110 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace ppc::task {
+
+/// @brief Memory footprint of an interval of execution on the calling rank.
+struct MemorySample {
+  /// @brief Peak resident set size of the process at the end of the interval (high-water mark), bytes.
+  std::uint64_t peak_rss_bytes = 0;
+  /// @brief Change of the resident set size of the process over the interval, bytes.
+  std::int64_t rss_delta_bytes = 0;
+  /// @brief Peak growth of the heap charged to the interval (see HeapTracker); only meaningful if heap_tracked.
+  std::uint64_t heap_peak_bytes = 0;
+  /// @brief Number of operator new calls charged to the interval; only meaningful if heap_tracked.
+  std::uint64_t heap_allocations = 0;
+  /// @brief True if the operator new hook (heap_hook.cpp) is linked into the executable.
+  bool heap_tracked = false;
+
+  /// @brief Footprint compared against PPC_MEMORY_LIMIT_MB: the heap peak if tracked, the peak RSS otherwise.
+  [[nodiscard]] std::uint64_t Footprint() const {
+    return heap_tracked ? heap_peak_bytes : peak_rss_bytes;
+  }
+};
+
+/// @brief Combines samples of consecutive intervals: peaks are maximized, RSS changes and allocations are summed.
+inline MemorySample CombineMemorySamples(const MemorySample &lhs, const MemorySample &rhs) {
+  return {.peak_rss_bytes = std::max(lhs.peak_rss_bytes, rhs.peak_rss_bytes),
+          .rss_delta_bytes = lhs.rss_delta_bytes + rhs.rss_delta_bytes,
+          .heap_peak_bytes = std::max(lhs.heap_peak_bytes, rhs.heap_peak_bytes),
+          .heap_allocations = lhs.heap_allocations + rhs.heap_allocations,
+          .heap_tracked = lhs.heap_tracked || rhs.heap_tracked};
+}
+
+/// @brief Returns the peak resident set size of the process in bytes (0 if unavailable).
+std::uint64_t GetPeakRssBytes();
+
+/// @brief Returns the current resident set size of the process in bytes (0 if unavailable).
+std::uint64_t GetCurrentRssBytes();
+
+/// @brief Returns the per-rank footprint limit from PPC_MEMORY_LIMIT_MB in bytes (0 means unlimited).
+std::uint64_t GetMemoryLimitBytes();
+
+/// @brief Heap accounting fed by the replaceable global operator new/delete.
+/// @details The process-wide counters see the allocations of every thread. Each MemoryScope additionally opens a
+/// scope token that belongs to the thread which opened it: allocations of that thread are charged to its scope and
+/// the enclosing ones only, so stages running concurrently on different threads (e.g. the lanes of a PipelineStream)
+/// do not see each other's memory. Threads that opened no scope, such as the OpenMP, TBB or std::thread workers of a
+/// stage, are charged to every open scope, since they cannot be attributed to one lane. The hook lives in
+/// modules/task/heap_hook/heap_hook.cpp and is linked into the test runners only (USE_HEAP_TRACKING); without it
+/// every counter stays zero and IsInstalled() returns false.
+class HeapTracker {
+ public:
+  /// @brief Called by the hook before the first allocation is counted.
+  static void Install() noexcept;
+  [[nodiscard]] static bool IsInstalled() noexcept;
+
+  /// @brief Accounts an allocation of the given usable size; must not allocate.
+  static void RecordAllocation(std::size_t bytes) noexcept;
+  /// @brief Accounts a deallocation of the given usable size; must not allocate.
+  static void RecordDeallocation(std::size_t bytes) noexcept;
+
+  /// @brief Heap bytes allocated and not yet freed by all threads of the process.
+  [[nodiscard]] static std::int64_t CurrentBytes() noexcept;
+  /// @brief Number of allocations of all threads of the process since it started.
+  [[nodiscard]] static std::uint64_t Allocations() noexcept;
+
+  /// @brief Opens a scope token on the calling thread, nested into the thread's current scope.
+  /// @return The token, or -1 if too many scopes are open at once.
+  [[nodiscard]] static int OpenScope() noexcept;
+  /// @brief Closes a token returned by OpenScope(); tokens of a thread close in reverse order of opening.
+  static void CloseScope(int scope) noexcept;
+  /// @brief Highest growth of the heap charged to the scope since it was opened.
+  [[nodiscard]] static std::int64_t ScopePeakBytes(int scope) noexcept;
+  /// @brief Number of allocations charged to the scope since it was opened.
+  [[nodiscard]] static std::uint64_t ScopeAllocations(int scope) noexcept;
+};
+
+/// @brief Samples the memory footprint of its lifetime on the calling thread into a MemorySample.
+/// @details Scopes may nest: the heap peak of an enclosing scope still covers the inner one.
+class MemoryScope {
+ public:
+  explicit MemoryScope(MemorySample &sample)
+      : sample_(sample), rss_begin_bytes_(GetCurrentRssBytes()), heap_scope_(HeapTracker::OpenScope()) {}
+
+  ~MemoryScope() {
+    const auto heap_growth_bytes = HeapTracker::ScopePeakBytes(heap_scope_);
+    const auto rss_end_bytes = static_cast<std::int64_t>(GetCurrentRssBytes());
+    sample_ = {.peak_rss_bytes = GetPeakRssBytes(),
+               .rss_delta_bytes = rss_end_bytes - static_cast<std::int64_t>(rss_begin_bytes_),
+               .heap_peak_bytes = heap_growth_bytes > 0 ? static_cast<std::uint64_t>(heap_growth_bytes) : 0,
+               .heap_allocations = HeapTracker::ScopeAllocations(heap_scope_),
+               .heap_tracked = HeapTracker::IsInstalled() && heap_scope_ >= 0};
+    HeapTracker::CloseScope(heap_scope_);
+  }
+
+  MemoryScope(const MemoryScope &) = delete;
+  MemoryScope &operator=(const MemoryScope &) = delete;
+  MemoryScope(MemoryScope &&) = delete;
+  MemoryScope &operator=(MemoryScope &&) = delete;
+
+ private:
+  MemorySample &sample_;
+  std::uint64_t rss_begin_bytes_;
+  int heap_scope_;
+};
+
+}  // namespace ppc::task
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace ppc::task {
+
+/// @brief Bump allocator for the scratch buffers of a task.
+/// @details Buffers are carved out of a list of blocks that are only released when the arena is destroyed.
+/// Rewinding to a mark makes the memory behind it reusable without freeing it; rewinding to the start also
+/// merges all blocks into one of their combined size, so once every buffer size has been seen, an iteration
+/// that requests the same buffers again is served from existing memory without any heap allocation.
+class ScratchArena {
+ public:
+  /// @brief Alignment of every buffer, enough for SIMD loads and to keep buffers on separate cache lines.
+  static constexpr std::size_t kAlignment = 64;
+
+  /// @brief Position in the arena returned by GetMark().
+  struct Mark {
+    /// Index of the current block
+    std::size_t block = 0;
+    /// First free byte in the current block
+    std::size_t offset = 0;
+  };
+
+  /// @brief Returns an uninitialized buffer of `count` elements, valid until the arena is rewound past it.
+  template <typename T>
+  std::span<T> Allocate(std::size_t count) {
+    static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>,
+                  "Scratch buffers hold trivial types only: their memory is reused without running destructors");
+    static_assert(alignof(T) <= kAlignment, "Over-aligned scratch element type");
+    if (count == 0) {
+      return {};
+    }
+    return {static_cast<T *>(AllocateBytes(count * sizeof(T))), count};
+  }
+
+  /// @brief Returns the current position; buffers allocated later are released by Rewind() to it.
+  [[nodiscard]] Mark GetMark() const {
+    return mark_;
+  }
+
+  /// @brief Makes the memory allocated after `mark` reusable; buffers allocated before it stay valid.
+  void Rewind(Mark mark);
+
+  /// @brief Makes the whole arena reusable and merges its blocks into one.
+  void Reset() {
+    Rewind({});
+  }
+
+  /// @brief Total size of all blocks in bytes.
+  [[nodiscard]] std::size_t GetCapacity() const {
+    return capacity_;
+  }
+
+  /// @brief Number of blocks; 1 in the steady state.
+  [[nodiscard]] std::size_t GetNumBlocks() const {
+    return blocks_.size();
+  }
+
+ private:
+  struct AlignedDelete {
+    void operator()(std::byte *ptr) const;
+  };
+  struct Block {
+    std::unique_ptr<std::byte[], AlignedDelete> data;
+    std::size_t size = 0;
+  };
+
+  void *AllocateBytes(std::size_t size);
+  void AddBlock(std::size_t size);
+
+  std::vector<Block> blocks_;
+  Mark mark_;
+  std::size_t capacity_ = 0;
+};
+
+}  // namespace ppc::task
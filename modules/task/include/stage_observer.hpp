@@ -0,0 +1,57 @@
+#pragma once
+
+namespace ppc::task {
+
+/// @brief Receives the pipeline stages of every task.
+/// @details Lets higher layers, such as the timeline tracer of the performance module, follow the stages without
+/// the task module depending on them. Both calls are made on the thread that executes the stage.
+class StageObserver {
+ public:
+  StageObserver() = default;
+  virtual ~StageObserver() = default;
+
+  StageObserver(const StageObserver &) = delete;
+  StageObserver &operator=(const StageObserver &) = delete;
+  StageObserver(StageObserver &&) = delete;
+  StageObserver &operator=(StageObserver &&) = delete;
+
+  /// @brief Called before a stage starts.
+  /// @param stage_name "Validation", "PreProcessing", "Run" or "PostProcessing"; static storage duration.
+  virtual void OnStageBegin(const char *stage_name) = 0;
+
+  /// @brief Called after the stage returned or threw.
+  virtual void OnStageEnd(const char *stage_name) = 0;
+};
+
+/// @brief Installs the process-wide stage observer; nullptr removes it.
+void SetStageObserver(StageObserver *observer);
+
+/// @brief Returns the installed stage observer, or nullptr.
+StageObserver *GetStageObserver();
+
+/// @brief Reports its lifetime as one stage to the observer installed at construction.
+class StageObserverScope {
+ public:
+  explicit StageObserverScope(const char *stage_name) : stage_name_(stage_name), observer_(GetStageObserver()) {
+    if (observer_ != nullptr) {
+      observer_->OnStageBegin(stage_name_);
+    }
+  }
+
+  ~StageObserverScope() {
+    if (observer_ != nullptr) {
+      observer_->OnStageEnd(stage_name_);
+    }
+  }
+
+  StageObserverScope(const StageObserverScope &) = delete;
+  StageObserverScope &operator=(const StageObserverScope &) = delete;
+  StageObserverScope(StageObserverScope &&) = delete;
+  StageObserverScope &operator=(StageObserverScope &&) = delete;
+
+ private:
+  const char *stage_name_;
+  StageObserver *observer_;
+};
+
+}  // namespace ppc::task
@@ -4,18 +4,26 @@
 
 #include <array>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <util/include/util.hpp>
 #include <utility>
 
+#include "task/include/distributed_input.hpp"
+#include "task/include/memory_tracker.hpp"
+#include "task/include/scratch_arena.hpp"
+#include "task/include/stage_observer.hpp"
+
 namespace ppc::task {
 
 /// @brief Represents the type of task (parallelization technology).
@@ -98,6 +106,40 @@ inline std::string GetStringTaskType(TypeOfTask type_of_task, const std::string
 
 enum class StateOfTesting : uint8_t { kFunc, kPerf };
 
+/// @brief Wall-clock durations of the pipeline stages, in seconds.
+/// @details Each field holds the duration of the most recent call of the corresponding stage.
+struct StageTimings {
+  /// Duration of ValidationImpl()
+  double validation_sec = 0.0;
+  /// Duration of PreProcessingImpl()
+  double pre_processing_sec = 0.0;
+  /// Duration of RunImpl()
+  double run_sec = 0.0;
+  /// Duration of PostProcessingImpl()
+  double post_processing_sec = 0.0;
+};
+
+/// @brief Memory footprint of each pipeline stage on the calling rank.
+struct StageMemory {
+  /// Sample of ValidationImpl()
+  MemorySample validation;
+  /// Sample of PreProcessingImpl()
+  MemorySample pre_processing;
+  /// Sample of RunImpl()
+  MemorySample run;
+  /// Sample of PostProcessingImpl()
+  MemorySample post_processing;
+
+  /// @brief Peaks over all stages; allocations are summed.
+  [[nodiscard]] MemorySample Peak() const {
+    return CombineMemorySamples(CombineMemorySamples(validation, pre_processing),
+                                CombineMemorySamples(run, post_processing));
+  }
+};
+
+template <typename InType, typename OutType>
+class BatchTask;
+
 template <typename InType, typename OutType>
 /// @brief Base abstract class representing a generic task with a defined pipeline.
 /// @tparam InType Input data type.
@@ -113,7 +155,9 @@ class Task {
       stage_ = PipelineStage::kException;
       throw std::runtime_error("Validation should be called before preprocessing");
     }
-    return ValidationImpl();
+    scratch_.Reset();
+    return MeasureStage("Validation", stage_timings_.validation_sec, stage_memory_.validation,
+                        [this] { return ValidationImpl(); });
   }
 
   /// @brief Performs preprocessing on the input data.
@@ -128,19 +172,17 @@ class Task {
     if (state_of_testing_ == StateOfTesting::kFunc) {
       InternalTimeTest();
     }
-    return PreProcessingImpl();
+    const bool result = MeasureStage("PreProcessing", stage_timings_.pre_processing_sec, stage_memory_.pre_processing,
+                                     [this] { return PreProcessingImpl(); });
+    run_scratch_mark_ = scratch_.GetMark();
+    return result;
   }
 
   /// @brief Executes the main logic of the task.
   /// @return True if execution is successful.
   virtual bool Run() final {
-    if (stage_ == PipelineStage::kPreProcessing || stage_ == PipelineStage::kRun) {
-      stage_ = PipelineStage::kRun;
-    } else {
-      stage_ = PipelineStage::kException;
-      throw std::runtime_error("Run should be called after preprocessing");
-    }
-    return RunImpl();
+    BeginRun();
+    return MeasureStage("Run", stage_timings_.run_sec, stage_memory_.run, [this] { return RunImpl(); });
   }
 
   /// @brief Performs postprocessing on the output data.
@@ -155,7 +197,15 @@ class Task {
     if (state_of_testing_ == StateOfTesting::kFunc) {
       InternalTimeTest();
     }
-    return PostProcessingImpl();
+    return MeasureStage("PostProcessing", stage_timings_.post_processing_sec, stage_memory_.post_processing,
+                        [this] { return PostProcessingImpl(); });
+  }
+
+  /// @brief Ends the pipeline after a stage returned false or threw, skipping the remaining stages.
+  /// @details The task then counts as finished with an exception, so that destroying it is not reported as an
+  /// incomplete pipeline.
+  void AbortPipeline() {
+    stage_ = PipelineStage::kException;
   }
 
   /// @brief Returns the current testing mode.
@@ -188,6 +238,31 @@ class Task {
     return TypeOfTask::kUnknown;
   }
 
+  /// @brief Declares whether the task accepts a DistributedInput holding only the calling rank's block.
+  /// @details Tasks whose InType is DistributedInput<T> and that skip the root scatter when
+  /// `GetInput().distributed` is set hide this with a version returning true.
+  /// @return False by default.
+  static constexpr bool AcceptsDistributedInput() {
+    return false;
+  }
+
+  /// @brief Returns durations of the most recent call of each pipeline stage.
+  /// @return Per-stage timings measured with a steady clock.
+  [[nodiscard]] const StageTimings &GetStageTimings() const {
+    return stage_timings_;
+  }
+
+  /// @brief Returns the memory footprint of the most recent call of each pipeline stage.
+  /// @return Per-stage peak RSS and, with the heap hook linked, heap peaks and allocation counts.
+  [[nodiscard]] const StageMemory &GetStageMemory() const {
+    return stage_memory_;
+  }
+
+  /// @brief Returns the arena behind GetScratch(), e.g. to check that it stopped growing.
+  [[nodiscard]] const ScratchArena &GetScratchArena() const {
+    return scratch_;
+  }
+
   /// @brief Returns a reference to the input data.
   /// @return Reference to the task's input data.
   InType &GetInput() {
@@ -238,6 +313,16 @@ class Task {
     }
   }
 
+  /// @brief Returns an uninitialized scratch buffer of `count` elements of a trivial type.
+  /// @details Buffers come from an arena owned by the task that is rewound, not freed, between iterations, so
+  /// repeated pipelines reuse the same memory. Buffers obtained before Run() (e.g. in PreProcessingImpl())
+  /// stay valid until the next Validation(); buffers obtained in RunImpl() or later stay valid until the next
+  /// Run(). Keep results that must outlive that in GetOutput().
+  template <typename T>
+  std::span<T> GetScratch(std::size_t count) {
+    return scratch_.Allocate<T>(count);
+  }
+
   /// @brief User-defined validation logic.
   /// @return True if validation is successful.
   virtual bool ValidationImpl() = 0;
@@ -255,12 +340,40 @@ class Task {
   virtual bool PostProcessingImpl() = 0;
 
  private:
+  friend class BatchTask<InType, OutType>;
+
+  // Enters the run stage; BatchTask calls it directly for items whose RunImpl() a batched run replaces
+  void BeginRun() {
+    if (stage_ == PipelineStage::kPreProcessing || stage_ == PipelineStage::kRun) {
+      stage_ = PipelineStage::kRun;
+    } else {
+      stage_ = PipelineStage::kException;
+      throw std::runtime_error("Run should be called after preprocessing");
+    }
+    scratch_.Rewind(run_scratch_mark_);
+  }
+
+  // Times a stage, samples its memory footprint and reports it to the installed StageObserver (e.g. the tracer)
+  template <typename StageImpl>
+  static bool MeasureStage(const char *stage_name, double &duration_sec, MemorySample &memory, StageImpl &&stage_impl) {
+    const StageObserverScope observer_scope(stage_name);
+    const MemoryScope memory_scope(memory);
+    const auto start = std::chrono::steady_clock::now();
+    const bool result = std::forward<StageImpl>(stage_impl)();
+    duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+  }
+
   InType input_{};
   OutType output_{};
   StateOfTesting state_of_testing_ = StateOfTesting::kFunc;
   TypeOfTask type_of_task_ = TypeOfTask::kUnknown;
   StatusOfTask status_of_task_ = StatusOfTask::kEnabled;
   std::chrono::high_resolution_clock::time_point tmp_time_point_;
+  StageTimings stage_timings_;
+  StageMemory stage_memory_;
+  ScratchArena scratch_;
+  ScratchArena::Mark run_scratch_mark_;
   enum class PipelineStage : uint8_t {
     kNone,
     kValidation,
@@ -277,14 +390,60 @@ class Task {
 template <typename InType, typename OutType>
 using TaskPtr = std::shared_ptr<Task<InType, OutType>>;
 
+/// @brief Runs the stages of `task` in order, stopping at the first one that returns false or throws.
+/// @details A task that stops early is aborted (see Task::AbortPipeline()), so that it may be destroyed.
+/// @return True if every stage returned true.
+template <typename InType, typename OutType>
+bool RunPipeline(Task<InType, OutType> &task) {
+  bool done = false;
+  try {
+    done = task.Validation() && task.PreProcessing() && task.Run() && task.PostProcessing();
+  } catch (...) {
+    task.AbortPipeline();
+    throw;
+  }
+  if (!done) {
+    task.AbortPipeline();
+  }
+  return done;
+}
+
+namespace detail {
+
+template <typename InType, typename OutType>
+std::pair<InType, OutType> TaskIoTypes(const Task<InType, OutType> &);
+
+}  // namespace detail
+
+/// @brief Input type of a task class derived from Task<InType, OutType>.
+template <typename TaskType>
+using TaskInputType = typename decltype(detail::TaskIoTypes(std::declval<const TaskType &>()))::first_type;
+
+/// @brief Output type of a task class derived from Task<InType, OutType>.
+template <typename TaskType>
+using TaskOutputType = typename decltype(detail::TaskIoTypes(std::declval<const TaskType &>()))::second_type;
+
+/// @brief Immutable input buffer shared by the test fixture and tasks instead of being copied.
+/// @details Use it as (part of) InType for large inputs, e.g. `using InType = SharedInput<std::vector<int>>;`.
+template <typename T>
+using SharedInput = std::shared_ptr<const T>;
+
+/// @brief Wraps a value into a SharedInput, moving it when given an rvalue.
+template <typename T>
+SharedInput<std::remove_cvref_t<T>> MakeSharedInput(T &&value) {
+  return std::make_shared<const std::remove_cvref_t<T>>(std::forward<T>(value));
+}
+
 /// @brief Constructs and returns a shared pointer to a task with the given input.
+/// @details The input is moved into the constructor, so tasks declaring `explicit Task(InType in)` take
+/// ownership without a copy; constructors taking `const InType &` keep working unchanged.
 /// @tparam TaskType Type of the task to create.
 /// @tparam InType Type of the input.
 /// @param in Input to pass to the task constructor.
 /// @return Shared a pointer to the newly created task.
 template <typename TaskType, typename InType>
-std::shared_ptr<TaskType> TaskGetter(const InType &in) {
-  return std::make_shared<TaskType>(in);
+std::shared_ptr<TaskType> TaskGetter(InType in) {
+  return std::make_shared<TaskType>(std::move(in));
 }
 
 }  // namespace ppc::task
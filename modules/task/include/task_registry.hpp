@@ -0,0 +1,154 @@
+#pragma once
+
+#include <any>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "task/include/task.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::task {
+
+template <typename InType, typename OutType>
+/// @brief Creates a task of one implementation from its input.
+using TaskFactory = std::function<TaskPtr<InType, OutType>(InType)>;
+
+template <typename InType, typename OutType>
+/// @brief Registered implementation of a task, with its factory.
+struct RegisteredImplementation {
+  /// Technology of the implementation
+  TypeOfTask type_of_task = TypeOfTask::kUnknown;
+  /// Creates a task of the implementation
+  TaskFactory<InType, OutType> make_task;
+};
+
+/// @brief Run-time directory of task implementations, keyed by task namespace and TypeOfTask.
+/// @details Implementations add themselves at static initialization through a TaskRegistration object in the
+/// translation unit that defines them, so every implementation linked into a binary can be listed and created
+/// by name. Registration happens before main(); queries may come from any thread afterwards. A registration that
+/// clashes with an earlier one cannot throw there, so the clash is recorded and reported by the lookups of the
+/// implementation and by GetDuplicates().
+class TaskRegistry {
+ public:
+  /// @brief Returns the registry of the process.
+  static TaskRegistry &Instance();
+
+  /// @brief Adds TaskType under its namespace and static TypeOfTask.
+  /// @throws std::invalid_argument If an implementation of the same type is already registered for the namespace.
+  template <typename TaskType>
+  void Register() {
+    using InType = TaskInputType<TaskType>;
+    using OutType = TaskOutputType<TaskType>;
+    if (!Add(ppc::util::GetNamespace<TaskType>(), TaskType::GetStaticTypeOfTask(), typeid(InType), typeid(OutType),
+             TaskFactory<InType, OutType>(TaskGetter<TaskType, InType>), false)) {
+      throw std::invalid_argument(DuplicateMessage(ppc::util::GetNamespace<TaskType>(),
+                                                   TaskType::GetStaticTypeOfTask()));
+    }
+  }
+
+  /// @brief Adds TaskType like Register(), but records a clash with an earlier implementation instead of throwing.
+  /// @details The earlier implementation is kept; lookups of the clashing implementation throw from then on.
+  /// @return False if an implementation of the same type was already registered for the namespace.
+  template <typename TaskType>
+  bool RegisterOrRecordDuplicate() {
+    using InType = TaskInputType<TaskType>;
+    using OutType = TaskOutputType<TaskType>;
+    return Add(ppc::util::GetNamespace<TaskType>(), TaskType::GetStaticTypeOfTask(), typeid(InType),
+               typeid(OutType), TaskFactory<InType, OutType>(TaskGetter<TaskType, InType>), true);
+  }
+
+  /// @brief Returns a description of every implementation registered twice at static initialization.
+  [[nodiscard]] std::vector<std::string> GetDuplicates() const;
+
+  /// @brief Returns the namespaces of all registered tasks in lexicographic order.
+  [[nodiscard]] std::vector<std::string> GetNamespaces() const;
+
+  /// @brief Returns the registered implementations of a task, in TypeOfTask order; empty for unknown namespaces.
+  [[nodiscard]] std::vector<TypeOfTask> GetTypesOfTask(const std::string &task_namespace) const;
+
+  /// @brief Returns true if the task has an implementation of the given type.
+  [[nodiscard]] bool Contains(const std::string &task_namespace, TypeOfTask type_of_task) const;
+
+  /// @brief Returns the factory of one implementation.
+  /// @tparam InType Input data type of the task.
+  /// @tparam OutType Output data type of the task.
+  /// @throws std::out_of_range If the implementation is not registered.
+  /// @throws std::invalid_argument If the task has other data types or the implementation is registered twice.
+  template <typename InType, typename OutType>
+  [[nodiscard]] TaskFactory<InType, OutType> GetFactory(const std::string &task_namespace,
+                                                        TypeOfTask type_of_task) const {
+    const auto &entry = Find(task_namespace, type_of_task);
+    CheckDataTypes(task_namespace, entry, typeid(InType), typeid(OutType));
+    return std::any_cast<TaskFactory<InType, OutType>>(entry.factory);
+  }
+
+  /// @brief Returns every implementation of a task with its factory, in TypeOfTask order.
+  /// @throws std::invalid_argument If the task has other data types or an implementation is registered twice.
+  template <typename InType, typename OutType>
+  [[nodiscard]] std::vector<RegisteredImplementation<InType, OutType>> GetImplementations(
+      const std::string &task_namespace) const {
+    std::vector<RegisteredImplementation<InType, OutType>> implementations;
+    for (const auto type_of_task : GetTypesOfTask(task_namespace)) {
+      implementations.push_back(
+          {.type_of_task = type_of_task, .make_task = GetFactory<InType, OutType>(task_namespace, type_of_task)});
+    }
+    return implementations;
+  }
+
+  /// @brief Creates a task of one implementation.
+  /// @throws std::out_of_range If the implementation is not registered.
+  /// @throws std::invalid_argument If the task has other data types or the implementation is registered twice.
+  template <typename InType, typename OutType>
+  TaskPtr<InType, OutType> MakeTask(const std::string &task_namespace, TypeOfTask type_of_task, InType in) const {
+    return GetFactory<InType, OutType>(task_namespace, type_of_task)(std::move(in));
+  }
+
+ private:
+  struct Entry {
+    std::type_index input_type;
+    std::type_index output_type;
+    // Holds a TaskFactory<InType, OutType> for the types above
+    std::any factory;
+  };
+  using Key = std::pair<std::string, TypeOfTask>;
+
+  TaskRegistry() = default;
+
+  // Returns false if the implementation is already registered; records the clash if record_duplicate is set
+  bool Add(const std::string &task_namespace, TypeOfTask type_of_task, const std::type_info &input_type,
+           const std::type_info &output_type, std::any factory, bool record_duplicate);
+  [[nodiscard]] const Entry &Find(const std::string &task_namespace, TypeOfTask type_of_task) const;
+  static void CheckDataTypes(const std::string &task_namespace, const Entry &entry, const std::type_info &input_type,
+                             const std::type_info &output_type);
+  static std::string DuplicateMessage(const std::string &task_namespace, TypeOfTask type_of_task);
+
+  mutable std::mutex mutex_;
+  std::map<Key, Entry> entries_;
+  std::set<Key> duplicates_;
+};
+
+template <typename TaskType>
+/// @brief Registers TaskType in the TaskRegistry when constructed.
+/// @details A clash with an earlier registration is recorded rather than thrown, since it would escape from static
+/// initialization and terminate the program; see TaskRegistry::GetDuplicates(). Define one at namespace scope
+/// next to the implementation, so that it is linked whenever the task is:
+/// @code
+/// namespace {
+/// const ppc::task::TaskRegistration<NsTaskMPI> kRegistration;
+/// }  // namespace
+/// @endcode
+struct TaskRegistration {
+  TaskRegistration() {
+    TaskRegistry::Instance().RegisterOrRecordDuplicate<TaskType>();
+  }
+};
+
+}  // namespace ppc::task
@@ -0,0 +1,97 @@
+#include "task/include/async_task.hpp"
+
+#include <mpi.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "oneapi/tbb/task_arena.h"
+
+namespace {
+
+// Without MPI_THREAD_SERIALIZED, MPI may only be called from the thread that initialized it
+bool CanUseProgressThread() {
+  int initialized = 0;
+  MPI_Initialized(&initialized);
+  if (initialized == 0) {
+    return true;
+  }
+  int provided = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&provided);
+  return provided >= MPI_THREAD_SERIALIZED;
+}
+
+// The progress thread is created on first use and joined by ppc::task::ShutdownProgressThread()
+std::mutex progress_thread_mutex;
+std::unique_ptr<ppc::task::detail::SerialExecutor> progress_thread;
+
+}  // namespace
+
+ppc::task::detail::SerialExecutor::SerialExecutor() : thread_([this] { Loop(); }) {}
+
+ppc::task::detail::SerialExecutor::~SerialExecutor() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  ready_.notify_one();
+  thread_.join();
+}
+
+void ppc::task::detail::SerialExecutor::Submit(std::function<void()> job) {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.push_back(std::move(job));
+  }
+  ready_.notify_one();
+}
+
+void ppc::task::detail::SerialExecutor::Loop() {
+  while (true) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      ready_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+      if (jobs_.empty()) {
+        return;
+      }
+      job = std::move(jobs_.front());
+      jobs_.pop_front();
+    }
+    job();
+  }
+}
+
+bool ppc::task::detail::IsProcessTask(TypeOfTask type_of_task) {
+  return type_of_task == TypeOfTask::kMPI || type_of_task == TypeOfTask::kALL;
+}
+
+void ppc::task::detail::SubmitProcessJob(std::function<void()> job) {
+  if (!CanUseProgressThread()) {
+    job();
+    return;
+  }
+  const std::lock_guard<std::mutex> lock(progress_thread_mutex);
+  if (!progress_thread) {
+    progress_thread = std::make_unique<SerialExecutor>();
+  }
+  progress_thread->Submit(std::move(job));
+}
+
+void ppc::task::ShutdownProgressThread() {
+  std::unique_ptr<detail::SerialExecutor> executor;
+  {
+    const std::lock_guard<std::mutex> lock(progress_thread_mutex);
+    executor = std::move(progress_thread);
+  }
+  // Destroying the executor runs the queued jobs before joining its thread
+  executor.reset();
+}
+
+void ppc::task::detail::EnqueueThreadJob(std::function<void()> job) {
+  // Default concurrency, which tbb::global_control limits to PPC_NUM_THREADS in the test runners
+  static tbb::task_arena arena;
+  arena.enqueue(std::move(job));
+}
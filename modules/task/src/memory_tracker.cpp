@@ -0,0 +1,193 @@
+#include "task/include/memory_tracker.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+
+#include "util/include/util.hpp"
+
+#ifdef _WIN32
+#  include <windows.h>
+// windows.h must come first
+#  include <psapi.h>
+#else
+#  include <sys/resource.h>
+#  include <unistd.h>
+#endif
+
+namespace {
+
+// Accounting of one open MemoryScope; `current` starts at zero, so `peak` is the growth over the scope
+struct HeapScopeSlot {
+  std::atomic<bool> in_use{false};
+  std::atomic<std::int64_t> current{0};
+  std::atomic<std::int64_t> peak{0};
+  std::atomic<std::uint64_t> allocations{0};
+  // Enclosing scope on the thread that opened this one, or -1
+  int parent = -1;
+};
+
+constexpr int kMaxHeapScopes = 64;
+
+// Constant-initialized, so the hook may use them before any dynamic initialization has run, on any thread
+std::atomic<bool> heap_installed{false};
+std::atomic<std::int64_t> heap_current_bytes{0};
+std::atomic<std::uint64_t> heap_allocations{0};
+std::atomic<int> heap_open_scopes{0};
+std::array<HeapScopeSlot, kMaxHeapScopes> heap_scopes;
+// Innermost scope opened by the calling thread, or -1 on threads that opened none (e.g. OpenMP or TBB workers)
+thread_local int heap_bound_scope = -1;
+
+void RaiseTo(std::atomic<std::int64_t> &peak, std::int64_t value) noexcept {
+  auto observed = peak.load(std::memory_order_relaxed);
+  while (observed < value && !peak.compare_exchange_weak(observed, value, std::memory_order_relaxed)) {
+  }
+}
+
+void ChargeScope(HeapScopeSlot &slot, std::int64_t bytes, bool allocation) noexcept {
+  const auto current = slot.current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  if (allocation) {
+    RaiseTo(slot.peak, current);
+    slot.allocations.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+// A thread with a scope charges its scope and the enclosing ones. Any other thread cannot be attributed to one
+// lane, so it charges every open scope: worker threads spawned by a stage are then counted by that stage
+void ChargeScopes(std::int64_t bytes, bool allocation) noexcept {
+  if (heap_open_scopes.load(std::memory_order_relaxed) == 0) {
+    return;
+  }
+  if (heap_bound_scope >= 0) {
+    for (int scope = heap_bound_scope; scope >= 0; scope = heap_scopes.at(scope).parent) {
+      ChargeScope(heap_scopes.at(scope), bytes, allocation);
+    }
+    return;
+  }
+  for (auto &slot : heap_scopes) {
+    if (slot.in_use.load(std::memory_order_acquire)) {
+      ChargeScope(slot, bytes, allocation);
+    }
+  }
+}
+
+}  // namespace
+
+std::uint64_t ppc::task::GetPeakRssBytes() {
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS counters{};
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) != 0) {
+    return static_cast<std::uint64_t>(counters.PeakWorkingSetSize);
+  }
+  return 0;
+#else
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#  ifdef __APPLE__
+  const auto max_rss = static_cast<std::uint64_t>(usage.ru_maxrss);
+#  else
+  // Linux reports kilobytes
+  const auto max_rss = static_cast<std::uint64_t>(usage.ru_maxrss) * 1024;
+#  endif
+  // The kernel updates the high-water mark lazily, so it can lag behind the current RSS
+  return std::max(max_rss, GetCurrentRssBytes());
+#endif
+}
+
+std::uint64_t ppc::task::GetCurrentRssBytes() {
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS counters{};
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) != 0) {
+    return static_cast<std::uint64_t>(counters.WorkingSetSize);
+  }
+  return 0;
+#else
+  // Second field of statm: resident pages
+  std::ifstream statm("/proc/self/statm");
+  std::uint64_t total_pages = 0;
+  std::uint64_t resident_pages = 0;
+  if (!(statm >> total_pages >> resident_pages)) {
+    return 0;
+  }
+  return resident_pages * static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+void ppc::task::HeapTracker::Install() noexcept {
+  heap_installed.store(true, std::memory_order_relaxed);
+}
+
+bool ppc::task::HeapTracker::IsInstalled() noexcept {
+  return heap_installed.load(std::memory_order_relaxed);
+}
+
+void ppc::task::HeapTracker::RecordAllocation(std::size_t bytes) noexcept {
+  heap_current_bytes.fetch_add(static_cast<std::int64_t>(bytes), std::memory_order_relaxed);
+  heap_allocations.fetch_add(1, std::memory_order_relaxed);
+  ChargeScopes(static_cast<std::int64_t>(bytes), true);
+}
+
+void ppc::task::HeapTracker::RecordDeallocation(std::size_t bytes) noexcept {
+  heap_current_bytes.fetch_sub(static_cast<std::int64_t>(bytes), std::memory_order_relaxed);
+  ChargeScopes(-static_cast<std::int64_t>(bytes), false);
+}
+
+std::int64_t ppc::task::HeapTracker::CurrentBytes() noexcept {
+  return heap_current_bytes.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ppc::task::HeapTracker::Allocations() noexcept {
+  return heap_allocations.load(std::memory_order_relaxed);
+}
+
+int ppc::task::HeapTracker::OpenScope() noexcept {
+  for (int scope = 0; scope < kMaxHeapScopes; scope++) {
+    auto &slot = heap_scopes.at(scope);
+    bool expected = false;
+    if (!slot.in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+      continue;
+    }
+    slot.current.store(0, std::memory_order_relaxed);
+    slot.peak.store(0, std::memory_order_relaxed);
+    slot.allocations.store(0, std::memory_order_relaxed);
+    slot.parent = heap_bound_scope;
+    heap_bound_scope = scope;
+    heap_open_scopes.fetch_add(1, std::memory_order_relaxed);
+    return scope;
+  }
+  return -1;
+}
+
+void ppc::task::HeapTracker::CloseScope(int scope) noexcept {
+  if (scope < 0 || scope >= kMaxHeapScopes) {
+    return;
+  }
+  auto &slot = heap_scopes.at(scope);
+  heap_bound_scope = slot.parent;
+  heap_open_scopes.fetch_sub(1, std::memory_order_relaxed);
+  slot.in_use.store(false, std::memory_order_release);
+}
+
+std::int64_t ppc::task::HeapTracker::ScopePeakBytes(int scope) noexcept {
+  if (scope < 0 || scope >= kMaxHeapScopes) {
+    return 0;
+  }
+  return heap_scopes.at(scope).peak.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ppc::task::HeapTracker::ScopeAllocations(int scope) noexcept {
+  if (scope < 0 || scope >= kMaxHeapScopes) {
+    return 0;
+  }
+  return heap_scopes.at(scope).allocations.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ppc::task::GetMemoryLimitBytes() {
+  const double limit_mb = ppc::util::GetMemoryLimitMb();
+  return limit_mb > 0.0 ? static_cast<std::uint64_t>(limit_mb * 1024.0 * 1024.0) : 0;
+}
@@ -0,0 +1,57 @@
+#include "task/include/scratch_arena.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+
+namespace {
+
+// Blocks are never smaller than this, so that small buffers do not each cost an allocation
+constexpr std::size_t kMinBlockSize = std::size_t{64} * 1024;
+
+std::size_t AlignUp(std::size_t value) {
+  constexpr auto kAlignment = ppc::task::ScratchArena::kAlignment;
+  return (value + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+}  // namespace
+
+void ppc::task::ScratchArena::AlignedDelete::operator()(std::byte *ptr) const {
+  ::operator delete[](ptr, std::align_val_t{kAlignment});
+}
+
+void ppc::task::ScratchArena::Rewind(Mark mark) {
+  mark_ = mark;
+  if (mark.block == 0 && mark.offset == 0 && blocks_.size() > 1) {
+    const auto total = capacity_;
+    blocks_.clear();
+    capacity_ = 0;
+    AddBlock(total);
+  }
+}
+
+void *ppc::task::ScratchArena::AllocateBytes(std::size_t size) {
+  size = AlignUp(size);
+  while (mark_.block < blocks_.size()) {
+    auto &block = blocks_[mark_.block];
+    if (mark_.offset + size <= block.size) {
+      void *ptr = block.data.get() + mark_.offset;
+      mark_.offset += size;
+      return ptr;
+    }
+    if (mark_.block + 1 == blocks_.size()) {
+      break;
+    }
+    mark_ = {.block = mark_.block + 1, .offset = 0};
+  }
+  // Geometric growth keeps the number of blocks, and thus of allocations, logarithmic in the demand
+  AddBlock(std::max({size, kMinBlockSize, capacity_}));
+  mark_ = {.block = blocks_.size() - 1, .offset = size};
+  return blocks_.back().data.get();
+}
+
+void ppc::task::ScratchArena::AddBlock(std::size_t size) {
+  auto *data = static_cast<std::byte *>(::operator new[](size, std::align_val_t{kAlignment}));
+  blocks_.push_back({.data = std::unique_ptr<std::byte[], AlignedDelete>(data), .size = size});
+  capacity_ += size;
+}
@@ -0,0 +1,20 @@
+#include "task/include/stage_observer.hpp"
+
+#include <atomic>
+
+namespace {
+
+std::atomic<ppc::task::StageObserver *> &InstalledObserver() {
+  static std::atomic<ppc::task::StageObserver *> observer = nullptr;
+  return observer;
+}
+
+}  // namespace
+
+void ppc::task::SetStageObserver(StageObserver *observer) {
+  InstalledObserver().store(observer, std::memory_order_release);
+}
+
+ppc::task::StageObserver *ppc::task::GetStageObserver() {
+  return InstalledObserver().load(std::memory_order_acquire);
+}
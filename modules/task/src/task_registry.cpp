@@ -0,0 +1,94 @@
+#include "task/include/task_registry.hpp"
+
+#include <any>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "task/include/task.hpp"
+
+ppc::task::TaskRegistry &ppc::task::TaskRegistry::Instance() {
+  static TaskRegistry registry;
+  return registry;
+}
+
+std::vector<std::string> ppc::task::TaskRegistry::GetNamespaces() const {
+  const std::lock_guard lock(mutex_);
+  std::vector<std::string> namespaces;
+  for (const auto &[key, entry] : entries_) {
+    if (namespaces.empty() || namespaces.back() != key.first) {
+      namespaces.push_back(key.first);
+    }
+  }
+  return namespaces;
+}
+
+std::vector<ppc::task::TypeOfTask> ppc::task::TaskRegistry::GetTypesOfTask(const std::string &task_namespace) const {
+  const std::lock_guard lock(mutex_);
+  std::vector<TypeOfTask> types;
+  for (auto it = entries_.lower_bound({task_namespace, TypeOfTask{}});
+       it != entries_.end() && it->first.first == task_namespace; ++it) {
+    types.push_back(it->first.second);
+  }
+  return types;
+}
+
+bool ppc::task::TaskRegistry::Contains(const std::string &task_namespace, TypeOfTask type_of_task) const {
+  const std::lock_guard lock(mutex_);
+  return entries_.contains({task_namespace, type_of_task});
+}
+
+std::vector<std::string> ppc::task::TaskRegistry::GetDuplicates() const {
+  const std::lock_guard lock(mutex_);
+  std::vector<std::string> duplicates;
+  for (const auto &[task_namespace, type_of_task] : duplicates_) {
+    duplicates.push_back(TypeOfTaskToString(type_of_task) + " implementation of " + task_namespace);
+  }
+  return duplicates;
+}
+
+bool ppc::task::TaskRegistry::Add(const std::string &task_namespace, TypeOfTask type_of_task,
+                                  const std::type_info &input_type, const std::type_info &output_type,
+                                  std::any factory, bool record_duplicate) {
+  const std::lock_guard lock(mutex_);
+  const auto [it, inserted] = entries_.try_emplace(
+      {task_namespace, type_of_task},
+      Entry{.input_type = input_type, .output_type = output_type, .factory = std::move(factory)});
+  if (!inserted && record_duplicate) {
+    duplicates_.insert(it->first);
+  }
+  return inserted;
+}
+
+const ppc::task::TaskRegistry::Entry &ppc::task::TaskRegistry::Find(const std::string &task_namespace,
+                                                                     TypeOfTask type_of_task) const {
+  const std::lock_guard lock(mutex_);
+  // Entries are never removed, so the reference stays valid after the lock is released
+  const auto it = entries_.find({task_namespace, type_of_task});
+  if (it == entries_.end()) {
+    throw std::out_of_range("TaskRegistry: no " + TypeOfTaskToString(type_of_task) + " implementation of " +
+                            task_namespace);
+  }
+  if (duplicates_.contains(it->first)) {
+    throw std::invalid_argument(DuplicateMessage(task_namespace, type_of_task));
+  }
+  return it->second;
+}
+
+void ppc::task::TaskRegistry::CheckDataTypes(const std::string &task_namespace, const Entry &entry,
+                                             const std::type_info &input_type, const std::type_info &output_type) {
+  if (entry.input_type != std::type_index(input_type) || entry.output_type != std::type_index(output_type)) {
+    throw std::invalid_argument("TaskRegistry: " + task_namespace + " takes " + entry.input_type.name() +
+                                " and returns " + entry.output_type.name() + ", requested " + input_type.name() +
+                                " and " + output_type.name());
+  }
+}
+
+std::string ppc::task::TaskRegistry::DuplicateMessage(const std::string &task_namespace, TypeOfTask type_of_task) {
+  return "TaskRegistry: " + TypeOfTaskToString(type_of_task) + " implementation of " + task_namespace +
+         " is registered twice";
+}
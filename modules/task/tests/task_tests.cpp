@@ -1,13 +1,18 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <libenvpp/env.hpp>
 #include <memory>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <system_error>
@@ -16,9 +21,19 @@
 #include <vector>
 
 #include "runners/include/runners.hpp"
+#include "task/include/async_task.hpp"
+#include "task/include/batch_task.hpp"
+#include "task/include/memory_tracker.hpp"
 #include "task/include/task.hpp"
+#include "task/include/task_registry.hpp"
 #include "util/include/util.hpp"
 
+using ppc::task::GetCurrentRssBytes;
+using ppc::task::GetMemoryLimitBytes;
+using ppc::task::GetPeakRssBytes;
+using ppc::task::HeapTracker;
+using ppc::task::MemorySample;
+using ppc::task::MemoryScope;
 using ppc::task::StateOfTesting;
 using ppc::task::StatusOfTask;
 using ppc::task::Task;
@@ -308,6 +323,653 @@ TEST(TaskTest, PostProcessingThrowsIfCalledBeforeRun) {
   EXPECT_THROW(task->PostProcessing(), std::runtime_error);
 }
 
+TEST(TaskTest, StageTimingsMeasureEachStage) {
+  struct SleepyRunTask : Task<int, int> {
+    bool ValidationImpl() override {
+      return true;
+    }
+    bool PreProcessingImpl() override {
+      return true;
+    }
+    bool RunImpl() override {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      return true;
+    }
+    bool PostProcessingImpl() override {
+      return true;
+    }
+  } task;
+
+  EXPECT_DOUBLE_EQ(task.GetStageTimings().run_sec, 0.0);
+  task.Validation();
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  const auto &timings = task.GetStageTimings();
+  EXPECT_GE(timings.run_sec, 0.02);
+  EXPECT_LT(timings.validation_sec, timings.run_sec);
+  EXPECT_LT(timings.pre_processing_sec, timings.run_sec);
+  EXPECT_LT(timings.post_processing_sec, timings.run_sec);
+}
+
+TEST(TaskTest, TaskGetterMovesInputIntoTask) {
+  struct OwningTask : ppc::test::TestTask<std::vector<int32_t>, int32_t> {
+    explicit OwningTask(std::vector<int32_t> in) : TestTask(std::vector<int32_t>{}) {
+      GetInput() = std::move(in);
+    }
+  };
+
+  std::vector<int32_t> in(20, 1);
+  const auto *buffer = in.data();
+  auto task = ppc::task::TaskGetter<OwningTask>(std::move(in));
+  EXPECT_EQ(task->GetInput().data(), buffer);
+  EXPECT_TRUE(task->Validation());
+  task->PreProcessing();
+  task->Run();
+  task->PostProcessing();
+  EXPECT_EQ(task->GetOutput(), 20);
+}
+
+TEST(TaskTest, SharedInputIsSharedBetweenTasks) {
+  using InType = ppc::task::SharedInput<std::vector<int32_t>>;
+  struct SharedSumTask : Task<InType, int32_t> {
+    explicit SharedSumTask(InType in) {
+      GetInput() = std::move(in);
+    }
+    bool ValidationImpl() override {
+      return GetInput() != nullptr;
+    }
+    bool PreProcessingImpl() override {
+      GetOutput() = 0;
+      return true;
+    }
+    bool RunImpl() override {
+      for (auto value : *GetInput()) {
+        GetOutput() += value;
+      }
+      return true;
+    }
+    bool PostProcessingImpl() override {
+      return true;
+    }
+  };
+
+  const auto input = ppc::task::MakeSharedInput(std::vector<int32_t>(20, 1));
+  auto first = ppc::task::TaskGetter<SharedSumTask>(input);
+  auto second = ppc::task::TaskGetter<SharedSumTask>(input);
+  EXPECT_EQ(first->GetInput().get(), second->GetInput().get());
+  EXPECT_EQ(input.use_count(), 3);
+  for (const auto &task : {first, second}) {
+    EXPECT_TRUE(task->Validation());
+    task->PreProcessing();
+    task->Run();
+    task->PostProcessing();
+    EXPECT_EQ(task->GetOutput(), 20);
+  }
+}
+
+TEST(TaskTest, DistributedInputBlocksJoinIntoTheWholeInput) {
+  const std::function<void(std::span<int32_t>, std::size_t)> fill = [](std::span<int32_t> block, std::size_t first) {
+    for (std::size_t i = 0; i < block.size(); i++) {
+      block[i] = static_cast<int32_t>(first + i);
+    }
+  };
+  const auto whole = ppc::task::MakeDistributedInput<int32_t>({5, 3}, 1, 0, fill);
+  EXPECT_FALSE(whole.distributed);
+  EXPECT_EQ(whole.GlobalSize(), 15U);
+  EXPECT_EQ(whole.GetLocalRows(), 5U);
+
+  std::vector<int32_t> joined;
+  for (int rank = 0; rank < 3; rank++) {
+    const auto block = ppc::task::MakeDistributedInput<int32_t>({5, 3}, 3, rank, fill);
+    EXPECT_TRUE(block.distributed);
+    EXPECT_EQ(block.GlobalSize(), 15U);
+    EXPECT_EQ(block.first_row, ppc::dist::GetBlockRange(5, 3, rank).begin);
+    EXPECT_EQ(block.GetLocalRows(), ppc::dist::GetBlockRange(5, 3, rank).count);
+    EXPECT_EQ(block.GetFirstIndex(), block.first_row * 3);
+    joined.insert(joined.end(), block.local.begin(), block.local.end());
+  }
+  EXPECT_EQ(joined, whole.local);
+
+  const auto wrapped = ppc::task::MakeWholeInput(std::vector<int32_t>{4, 5, 6});
+  EXPECT_FALSE(wrapped.distributed);
+  EXPECT_EQ(wrapped.global_shape, std::vector<std::size_t>{3});
+  EXPECT_EQ(wrapped.GetLocalRows(), 3U);
+}
+
+TEST(TaskTest, TasksDoNotAcceptDistributedInputByDefault) {
+  using DistributedTask = ppc::test::TestTask<ppc::task::DistributedInput<int32_t>, int32_t>;
+  EXPECT_FALSE(DistributedTask::AcceptsDistributedInput());
+}
+
+TEST(TaskTest, ScratchArenaReusesMemoryAfterRewind) {
+  ppc::task::ScratchArena arena;
+  EXPECT_TRUE(arena.Allocate<double>(0).empty());
+
+  const auto first = arena.Allocate<double>(10);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(first.data()) % ppc::task::ScratchArena::kAlignment, 0U);
+  const auto mark = arena.GetMark();
+  const auto second = arena.Allocate<int32_t>(100);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second.data()) % ppc::task::ScratchArena::kAlignment, 0U);
+  arena.Rewind(mark);
+  EXPECT_EQ(arena.Allocate<int32_t>(100).data(), second.data());
+
+  // Outgrowing the block adds another one; a reset merges them so the same requests then fit into one block
+  const auto big = arena.Allocate<char>(arena.GetCapacity());
+  ASSERT_EQ(big.size(), arena.GetCapacity() / 2);
+  EXPECT_EQ(arena.GetNumBlocks(), 2U);
+  const auto capacity = arena.GetCapacity();
+  arena.Reset();
+  EXPECT_EQ(arena.GetNumBlocks(), 1U);
+  EXPECT_EQ(arena.GetCapacity(), capacity);
+  arena.Allocate<double>(10);
+  arena.Allocate<int32_t>(100);
+  arena.Allocate<char>(big.size());
+  EXPECT_EQ(arena.GetNumBlocks(), 1U);
+  EXPECT_EQ(arena.GetCapacity(), capacity);
+}
+
+TEST(TaskTest, ScratchFromPreProcessingSurvivesRepeatedRuns) {
+  struct ScratchTask : ppc::test::TestTask<std::vector<int32_t>, int32_t> {
+    using TestTask::TestTask;
+    std::span<int32_t> prepared;
+    std::vector<const int32_t *> run_buffers;
+    bool PreProcessingImpl() override {
+      prepared = GetScratch<int32_t>(GetInput().size());
+      std::ranges::copy(GetInput(), prepared.begin());
+      return true;
+    }
+    bool RunImpl() override {
+      auto partial = GetScratch<int32_t>(prepared.size());
+      run_buffers.push_back(partial.data());
+      GetOutput() = 0;
+      for (std::size_t i = 0; i < prepared.size(); i++) {
+        partial[i] = prepared[i] * 2;
+        GetOutput() += partial[i];
+      }
+      return true;
+    }
+  };
+
+  auto task = std::make_shared<ScratchTask>(std::vector<int32_t>(1000, 1));
+  for (int pipeline = 0; pipeline < 2; pipeline++) {
+    ASSERT_TRUE(task->Validation());
+    task->PreProcessing();
+    for (int run = 0; run < 3; run++) {
+      task->Run();
+      EXPECT_EQ(task->GetOutput(), 2000);
+    }
+    task->PostProcessing();
+  }
+  ASSERT_EQ(task->run_buffers.size(), 6U);
+  for (const auto *buffer : task->run_buffers) {
+    EXPECT_EQ(buffer, task->run_buffers.front());
+  }
+  EXPECT_EQ(task->GetScratchArena().GetNumBlocks(), 1U);
+}
+
+namespace {
+
+class BatchedSumTask : public ppc::test::TestTask<std::vector<int32_t>, int32_t> {
+ public:
+  using TestTask::TestTask;
+
+  static bool RunBatch(std::span<BatchedSumTask *const> batch) {
+    batch_sizes.push_back(batch.size());
+    for (auto *task : batch) {
+      task->GetOutput() = 0;
+      for (const int32_t value : task->GetInput()) {
+        task->GetOutput() += value;
+      }
+    }
+    return true;
+  }
+
+  static inline std::vector<std::size_t> batch_sizes;
+};
+
+}  // namespace
+
+TEST(TaskTest, BatchTaskRunsItemsOneByOneWithoutBatchedRun) {
+  using ItemTask = ppc::test::TestTask<std::vector<int32_t>, int32_t>;
+  static_assert(!ppc::task::BatchRunnable<ItemTask>);
+
+  auto task = ppc::task::MakeBatchTask<ItemTask>({{1, 2, 3}, {4}, {5, 6}});
+  EXPECT_FALSE(task->IsBatched());
+  ASSERT_TRUE(task->Validation());
+  ASSERT_TRUE(task->PreProcessing());
+  ASSERT_TRUE(task->Run());
+  ASSERT_TRUE(task->PostProcessing());
+  EXPECT_EQ(task->GetOutput(), (std::vector<int32_t>{6, 4, 11}));
+}
+
+TEST(TaskTest, BatchTaskHandsWholeBatchToRunBatch) {
+  static_assert(ppc::task::BatchRunnable<BatchedSumTask>);
+  BatchedSumTask::batch_sizes.clear();
+
+  auto task = ppc::task::MakeBatchTask<BatchedSumTask>({{1, 2, 3}, {4}, {5, 6}, {7}});
+  EXPECT_TRUE(task->IsBatched());
+  ASSERT_TRUE(task->Validation());
+  ASSERT_TRUE(task->PreProcessing());
+  ASSERT_TRUE(task->Run());
+  ASSERT_TRUE(task->Run());
+  ASSERT_TRUE(task->PostProcessing());
+  EXPECT_EQ(task->GetOutput(), (std::vector<int32_t>{6, 4, 11, 7}));
+  EXPECT_EQ(BatchedSumTask::batch_sizes, (std::vector<std::size_t>{4, 4}));
+}
+
+TEST(TaskTest, BatchTaskFailsValidationIfAnyItemFails) {
+  using ItemTask = ppc::test::TestTask<std::vector<int32_t>, int32_t>;
+  auto task = ppc::task::MakeBatchTask<ItemTask>({{1}, {}});
+  EXPECT_FALSE(task->Validation());
+  // Every item was validated and the batch can be driven to the end like any task
+  task->PreProcessing();
+  task->Run();
+  task->PostProcessing();
+  EXPECT_EQ(task->GetItemTasks().size(), 2U);
+}
+
+TEST(TaskTest, BatchTaskWithInvalidItemEndsItsItemsQuietly) {
+  using ItemTask = ppc::test::TestTask<std::vector<int32_t>, int32_t>;
+  ppc::util::DestructorFailureFlag::Unset();
+  {
+    auto task = ppc::task::MakeBatchTask<ItemTask>({{1, 2}, {}, {3}});
+    EXPECT_TRUE(task->GetInput().empty());
+    EXPECT_EQ(task->GetItemTasks()[0]->GetInput(), (std::vector<int32_t>{1, 2}));
+    EXPECT_FALSE(ppc::task::RunPipeline(*task));
+  }
+  EXPECT_FALSE(ppc::util::DestructorFailureFlag::Get());
+}
+
+TEST(TaskTest, RunPipelineAsyncReportsResultOfPipeline) {
+  using ItemTask = ppc::test::TestTask<std::vector<int32_t>, int32_t>;
+  auto task = std::make_shared<ItemTask>(std::vector<int32_t>{1, 2, 3});
+  auto empty_task = std::make_shared<ItemTask>(std::vector<int32_t>{});
+  auto done = ppc::task::RunPipelineAsync<std::vector<int32_t>, int32_t>(task);
+  auto failed = ppc::task::RunPipelineAsync<std::vector<int32_t>, int32_t>(empty_task);
+  EXPECT_TRUE(done.get());
+  EXPECT_EQ(task->GetOutput(), 6);
+  EXPECT_FALSE(failed.get());
+  EXPECT_THROW(empty_task->PreProcessing(), std::runtime_error);
+  EXPECT_FALSE(ppc::util::DestructorFailureFlag::Get());
+}
+
+TEST(TaskTest, RunPipelineAsyncAbortsTaskThatThrows) {
+  struct ThrowingTask : ppc::test::TestTask<std::vector<int32_t>, int32_t> {
+    using TestTask::TestTask;
+    bool RunImpl() override {
+      throw std::runtime_error("Run failed");
+    }
+  };
+  {
+    auto task = std::make_shared<ThrowingTask>(std::vector<int32_t>{1});
+    auto future = ppc::task::RunPipelineAsync<std::vector<int32_t>, int32_t>(task);
+    EXPECT_THROW(future.get(), std::runtime_error);
+  }
+  EXPECT_FALSE(ppc::util::DestructorFailureFlag::Get());
+}
+
+TEST(TaskTest, RunPipelineAsyncRunsProcessTasksOnProgressThread) {
+  struct ThreadIdTask : ppc::test::TestTask<std::vector<int32_t>, int32_t> {
+    using TestTask::TestTask;
+    std::thread::id run_thread;
+    bool RunImpl() override {
+      run_thread = std::this_thread::get_id();
+      return TestTask::RunImpl();
+    }
+  };
+
+  std::vector<std::shared_ptr<ThreadIdTask>> tasks;
+  std::vector<ppc::task::PipelineFuture> futures;
+  for (int i = 0; i < 3; i++) {
+    tasks.push_back(std::make_shared<ThreadIdTask>(std::vector<int32_t>{i}));
+    tasks.back()->SetTypeOfTask(TypeOfTask::kMPI);
+    futures.push_back(ppc::task::RunPipelineAsync<std::vector<int32_t>, int32_t>(tasks.back()));
+  }
+  for (auto &future : futures) {
+    EXPECT_TRUE(future.get());
+  }
+  for (const auto &task : tasks) {
+    EXPECT_NE(task->run_thread, std::this_thread::get_id());
+    EXPECT_EQ(task->run_thread, tasks.front()->run_thread);
+  }
+}
+
+namespace {
+
+// Run() of input k waits for PreProcessing() of input k + 1 and reports whether it saw it
+class OverlapProbeTask : public ppc::task::Task<int32_t, bool> {
+ public:
+  explicit OverlapProbeTask(int32_t in) {
+    GetInput() = in;
+  }
+
+  static constexpr TypeOfTask GetStaticTypeOfTask() {
+    return TypeOfTask::kSEQ;
+  }
+
+  static inline std::atomic<int32_t> prepared{0};
+  static inline int32_t last_input = 0;
+
+ protected:
+  bool ValidationImpl() override {
+    return true;
+  }
+
+  bool PreProcessingImpl() override {
+    prepared++;
+    return true;
+  }
+
+  bool RunImpl() override {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (GetInput() < last_input && prepared.load() <= GetInput() + 1 &&
+           std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();
+    }
+    GetOutput() = GetInput() == last_input || prepared.load() > GetInput() + 1;
+    return true;
+  }
+
+  bool PostProcessingImpl() override {
+    return true;
+  }
+};
+
+}  // namespace
+
+TEST(TaskTest, PipelineStreamOverlapsConsecutiveInputs) {
+  OverlapProbeTask::prepared = 0;
+  OverlapProbeTask::last_input = 3;
+  std::vector<std::future<bool>> overlapped;
+  {
+    ppc::task::PipelineStream<OverlapProbeTask> stream;
+    for (int32_t input = 0; input <= OverlapProbeTask::last_input; input++) {
+      overlapped.push_back(stream.Push(input));
+    }
+  }
+  for (auto &future : overlapped) {
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_TRUE(future.get());
+  }
+}
+
+TEST(TaskTest, PipelineStreamReportsFailedStage) {
+  using ItemTask = ppc::test::TestTask<std::vector<int32_t>, int32_t>;
+  {
+    ppc::task::PipelineStream<ItemTask> stream;
+    auto good = stream.Push({1, 2});
+    auto bad = stream.Push({});
+    EXPECT_EQ(good.get(), 3);
+    EXPECT_THROW(bad.get(), std::runtime_error);
+  }
+  // The failed task was aborted rather than left in its validation stage
+  EXPECT_FALSE(ppc::util::DestructorFailureFlag::Get());
+}
+
+TEST(TaskTest, ShutdownProgressThreadRunsQueuedPipelines) {
+  using ItemTask = ppc::test::TestTask<std::vector<int32_t>, int32_t>;
+  auto task = std::make_shared<ItemTask>(std::vector<int32_t>{4, 5});
+  task->SetTypeOfTask(TypeOfTask::kMPI);
+  auto future = ppc::task::RunPipelineAsync<std::vector<int32_t>, int32_t>(task);
+  ppc::task::ShutdownProgressThread();
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+  EXPECT_TRUE(future.get());
+  EXPECT_EQ(task->GetOutput(), 9);
+
+  // A later process task starts a new progress thread
+  auto next = std::make_shared<ItemTask>(std::vector<int32_t>{1});
+  next->SetTypeOfTask(TypeOfTask::kMPI);
+  EXPECT_TRUE((ppc::task::RunPipelineAsync<std::vector<int32_t>, int32_t>(next).get()));
+}
+
+namespace ppc::test::registry_probe {
+
+class DoubleTask : public ppc::task::Task<int32_t, int32_t> {
+ public:
+  explicit DoubleTask(int32_t in) {
+    GetInput() = in;
+  }
+
+ protected:
+  bool ValidationImpl() override {
+    return true;
+  }
+  bool PreProcessingImpl() override {
+    return true;
+  }
+  bool RunImpl() override {
+    GetOutput() = 2 * GetInput();
+    return true;
+  }
+  bool PostProcessingImpl() override {
+    return true;
+  }
+};
+
+class DoubleTaskSEQ : public DoubleTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return ppc::task::TypeOfTask::kSEQ;
+  }
+  explicit DoubleTaskSEQ(int32_t in) : DoubleTask(in) {
+    SetTypeOfTask(GetStaticTypeOfTask());
+  }
+};
+
+class DoubleTaskOMP : public DoubleTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return ppc::task::TypeOfTask::kOMP;
+  }
+  explicit DoubleTaskOMP(int32_t in) : DoubleTask(in) {
+    SetTypeOfTask(GetStaticTypeOfTask());
+  }
+};
+
+namespace {
+const ppc::task::TaskRegistration<DoubleTaskSEQ> kSeqRegistration;
+const ppc::task::TaskRegistration<DoubleTaskOMP> kOmpRegistration;
+}  // namespace
+
+}  // namespace ppc::test::registry_probe
+
+namespace ppc::test::duplicate_registry_probe {
+
+class FirstTaskSEQ : public ppc::test::registry_probe::DoubleTaskSEQ {
+ public:
+  using DoubleTaskSEQ::DoubleTaskSEQ;
+};
+
+class SecondTaskSEQ : public ppc::test::registry_probe::DoubleTaskSEQ {
+ public:
+  using DoubleTaskSEQ::DoubleTaskSEQ;
+};
+
+namespace {
+const ppc::task::TaskRegistration<FirstTaskSEQ> kFirstRegistration;
+const ppc::task::TaskRegistration<SecondTaskSEQ> kSecondRegistration;
+}  // namespace
+
+}  // namespace ppc::test::duplicate_registry_probe
+
+TEST(TaskTest, RegistryListsImplementationsRegisteredAtStartup) {
+  const auto &registry = ppc::task::TaskRegistry::Instance();
+  const std::string probe_namespace = "ppc::test::registry_probe";
+  const auto namespaces = registry.GetNamespaces();
+  EXPECT_NE(std::ranges::find(namespaces, probe_namespace), namespaces.end());
+  EXPECT_EQ(registry.GetTypesOfTask(probe_namespace),
+            (std::vector{ppc::task::TypeOfTask::kOMP, ppc::task::TypeOfTask::kSEQ}));
+  EXPECT_TRUE(registry.Contains(probe_namespace, ppc::task::TypeOfTask::kSEQ));
+  EXPECT_FALSE(registry.Contains(probe_namespace, ppc::task::TypeOfTask::kMPI));
+  EXPECT_TRUE(registry.GetTypesOfTask("no_such_task").empty());
+}
+
+TEST(TaskTest, RegistryCreatesTasksByNamespaceAndType) {
+  const auto &registry = ppc::task::TaskRegistry::Instance();
+  for (const auto &implementation : registry.GetImplementations<int32_t, int32_t>("ppc::test::registry_probe")) {
+    auto task = implementation.make_task(21);
+    EXPECT_EQ(task->GetDynamicTypeOfTask(), implementation.type_of_task);
+    ASSERT_TRUE(task->Validation() && task->PreProcessing() && task->Run() && task->PostProcessing());
+    EXPECT_EQ(task->GetOutput(), 42);
+  }
+  auto task = registry.MakeTask<int32_t, int32_t>("ppc::test::registry_probe", ppc::task::TypeOfTask::kSEQ, 5);
+  EXPECT_EQ(task->GetDynamicTypeOfTask(), ppc::task::TypeOfTask::kSEQ);
+  task->Validation();
+  task->PreProcessing();
+  task->Run();
+  task->PostProcessing();
+  EXPECT_EQ(task->GetOutput(), 10);
+}
+
+TEST(TaskTest, RegistryRejectsUnknownImplementationsWrongTypesAndDuplicates) {
+  auto &registry = ppc::task::TaskRegistry::Instance();
+  const std::string probe_namespace = "ppc::test::registry_probe";
+  EXPECT_THROW((void)(registry.GetFactory<int32_t, int32_t>(probe_namespace, ppc::task::TypeOfTask::kMPI)),
+               std::out_of_range);
+  EXPECT_THROW((void)(registry.GetFactory<double, int32_t>(probe_namespace, ppc::task::TypeOfTask::kSEQ)),
+               std::invalid_argument);
+  EXPECT_THROW(registry.Register<ppc::test::registry_probe::DoubleTaskSEQ>(), std::invalid_argument);
+}
+
+TEST(TaskTest, RegistryRegistersEveryImplementationOnce) {
+  // The duplicate probe above is the only implementation of the binary that is registered twice on purpose
+  EXPECT_EQ(ppc::task::TaskRegistry::Instance().GetDuplicates(),
+            std::vector<std::string>{"seq implementation of ppc::test::duplicate_registry_probe"});
+}
+
+TEST(TaskTest, RegistryReportsDuplicatesRegisteredAtStartup) {
+  const auto &registry = ppc::task::TaskRegistry::Instance();
+  const std::string probe_namespace = "ppc::test::duplicate_registry_probe";
+  EXPECT_TRUE(registry.Contains(probe_namespace, ppc::task::TypeOfTask::kSEQ));
+  EXPECT_THROW((void)(registry.MakeTask<int32_t, int32_t>(probe_namespace, ppc::task::TypeOfTask::kSEQ, 1)),
+               std::invalid_argument);
+  EXPECT_THROW((void)(registry.GetImplementations<int32_t, int32_t>(probe_namespace)), std::invalid_argument);
+}
+
+TEST(MemoryTrackerTest, ReportsPeakRss) {
+  const auto peak = GetPeakRssBytes();
+  EXPECT_GT(peak, 0U);
+#ifdef __linux__
+  EXPECT_LE(GetCurrentRssBytes(), peak);
+#endif
+}
+
+TEST(MemoryTrackerTest, NestedScopesKeepTheOuterPeak) {
+  MemorySample outer;
+  MemorySample inner;
+  {
+    const MemoryScope outer_scope(outer);
+    HeapTracker::RecordAllocation(4096);
+    HeapTracker::RecordDeallocation(4096);
+    {
+      const MemoryScope inner_scope(inner);
+      HeapTracker::RecordAllocation(1024);
+      HeapTracker::RecordDeallocation(1024);
+    }
+  }
+  EXPECT_GE(inner.heap_peak_bytes, 1024U);
+  EXPECT_LT(inner.heap_peak_bytes, 4096U);
+  EXPECT_GE(inner.heap_allocations, 1U);
+  EXPECT_GE(outer.heap_peak_bytes, 4096U);
+  EXPECT_GE(outer.heap_allocations, 2U);
+  EXPECT_GT(outer.peak_rss_bytes, 0U);
+}
+
+TEST(MemoryTrackerTest, OverlappingScopesOnOtherThreadsDoNotInterfere) {
+  std::atomic<int> phase{0};
+  MemorySample other;
+  std::thread worker([&] {
+    const MemoryScope scope(other);
+    HeapTracker::RecordAllocation(1 << 20);
+    phase = 1;
+    while (phase.load() != 2) {
+      std::this_thread::yield();
+    }
+    HeapTracker::RecordDeallocation(1 << 20);
+  });
+  while (phase.load() != 1) {
+    std::this_thread::yield();
+  }
+
+  // The scope of this thread starts and ends while the worker holds its megabyte
+  MemorySample local;
+  {
+    const MemoryScope scope(local);
+    HeapTracker::RecordAllocation(1024);
+    HeapTracker::RecordDeallocation(1024);
+  }
+  phase = 2;
+  worker.join();
+
+  EXPECT_GE(local.heap_peak_bytes, 1024U);
+  EXPECT_LT(local.heap_peak_bytes, 1U << 20);
+  EXPECT_GE(other.heap_peak_bytes, 1U << 20);
+}
+
+TEST(MemoryTrackerTest, WorkerThreadsAreChargedToTheOpenScope) {
+  MemorySample sample;
+  const auto process_allocations = HeapTracker::Allocations();
+  {
+    const MemoryScope scope(sample);
+    // Like an OpenMP or TBB worker of the stage: the thread opened no scope of its own
+    std::thread worker([] {
+      HeapTracker::RecordAllocation(1 << 20);
+      HeapTracker::RecordDeallocation(1 << 20);
+    });
+    worker.join();
+  }
+  EXPECT_GE(sample.heap_peak_bytes, 1U << 20);
+  EXPECT_GE(sample.heap_allocations, 1U);
+  EXPECT_GE(HeapTracker::Allocations(), process_allocations + 1);
+}
+
+TEST(MemoryTrackerTest, FootprintPrefersHeapPeakWhenTracked) {
+  MemorySample sample{.peak_rss_bytes = 100,
+                      .rss_delta_bytes = 8,
+                      .heap_peak_bytes = 10,
+                      .heap_allocations = 1,
+                      .heap_tracked = false};
+  EXPECT_EQ(sample.Footprint(), 100U);
+  sample.heap_tracked = true;
+  EXPECT_EQ(sample.Footprint(), 10U);
+
+  const auto combined = CombineMemorySamples(sample, {.peak_rss_bytes = 50,
+                                                      .rss_delta_bytes = -3,
+                                                      .heap_peak_bytes = 20,
+                                                      .heap_allocations = 2,
+                                                      .heap_tracked = false});
+  EXPECT_EQ(combined.peak_rss_bytes, 100U);
+  EXPECT_EQ(combined.rss_delta_bytes, 5);
+  EXPECT_EQ(combined.heap_peak_bytes, 20U);
+  EXPECT_EQ(combined.heap_allocations, 3U);
+  EXPECT_TRUE(combined.heap_tracked);
+}
+
+TEST(MemoryTrackerTest, ScopeReportsRssChange) {
+  MemorySample sample;
+  std::vector<char> block;
+  {
+    const MemoryScope scope(sample);
+    // Touch the pages, so that they become resident
+    block.assign(std::size_t{16} << 20, 1);
+  }
+#ifdef __linux__
+  EXPECT_GT(sample.rss_delta_bytes, 0);
+  EXPECT_GE(sample.peak_rss_bytes, block.size());
+#endif
+}
+
+TEST(MemoryTrackerTest, MemoryLimitIsReadInMegabytes) {
+  EXPECT_EQ(GetMemoryLimitBytes(), 0U);
+  env::detail::set_scoped_environment_variable scoped("PPC_MEMORY_LIMIT_MB", "1.5");
+  EXPECT_EQ(GetMemoryLimitBytes(), 3U * 512U * 1024U);
+}
+
 int main(int argc, char **argv) {
+  if (ppc::util::IsUnderMpirun()) {
+    return ppc::runners::Init(argc, argv);
+  }
   return ppc::runners::SimpleInit(argc, argv);
 }
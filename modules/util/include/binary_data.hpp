@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ppc::util {
+
+/// @brief Element type of an array stored in a binary test data file.
+enum class DType : uint8_t {
+  kInt8,
+  kUInt8,
+  kInt16,
+  kUInt16,
+  kInt32,
+  kUInt32,
+  kInt64,
+  kUInt64,
+  kFloat32,
+  kFloat64,
+};
+
+/// @brief Maps a C++ element type to its DType.
+template <typename T>
+constexpr DType GetDType() {
+  if constexpr (std::is_same_v<T, int8_t>) {
+    return DType::kInt8;
+  } else if constexpr (std::is_same_v<T, uint8_t>) {
+    return DType::kUInt8;
+  } else if constexpr (std::is_same_v<T, int16_t>) {
+    return DType::kInt16;
+  } else if constexpr (std::is_same_v<T, uint16_t>) {
+    return DType::kUInt16;
+  } else if constexpr (std::is_same_v<T, int32_t>) {
+    return DType::kInt32;
+  } else if constexpr (std::is_same_v<T, uint32_t>) {
+    return DType::kUInt32;
+  } else if constexpr (std::is_same_v<T, int64_t>) {
+    return DType::kInt64;
+  } else if constexpr (std::is_same_v<T, uint64_t>) {
+    return DType::kUInt64;
+  } else if constexpr (std::is_same_v<T, float>) {
+    return DType::kFloat32;
+  } else {
+    static_assert(std::is_same_v<T, double>, "Unsupported element type of binary test data");
+    return DType::kFloat64;
+  }
+}
+
+/// @brief Size of one element of the given type in bytes.
+std::size_t GetDTypeSize(DType dtype);
+
+/// @brief Parses a type name such as "int32" or "float64".
+/// @throws std::invalid_argument If the name is unknown.
+DType ParseDType(const std::string &name);
+
+/// @brief Extension of binary test data files.
+inline constexpr const char *kBinaryDataExtension = ".ppcb";
+
+/// @brief Returns the binary variant of a data file: the same path with the extension replaced by ".ppcb".
+std::string GetBinaryVariantPath(const std::string &path);
+
+/// @brief True if the path names a binary test data file.
+bool IsBinaryDataPath(const std::string &path);
+
+/// @brief Returns the path itself, or its binary variant if only the latter exists.
+std::string ResolveBinaryVariant(const std::string &path);
+
+/// @brief Read-only, memory-mapped binary test data file holding one or more typed arrays.
+/// @details Layout: a 16-byte file header ("PPCB", version, byte order, number of arrays), then for every
+/// array a 16-byte array header (dtype, rank, payload size) followed by its shape as uint64 values and
+/// the raw payload. Payloads start at 64-byte offsets, so the returned spans are suitably aligned.
+class BinaryDataFile {
+ public:
+  /// @brief Maps the file into memory and validates its header.
+  /// @throws std::runtime_error If the file cannot be opened, is malformed or has a foreign byte order.
+  explicit BinaryDataFile(const std::string &path);
+  ~BinaryDataFile();
+
+  BinaryDataFile(const BinaryDataFile &) = delete;
+  BinaryDataFile &operator=(const BinaryDataFile &) = delete;
+  BinaryDataFile(BinaryDataFile &&other) noexcept;
+  BinaryDataFile &operator=(BinaryDataFile &&other) noexcept;
+
+  [[nodiscard]] std::size_t GetNumArrays() const {
+    return arrays_.size();
+  }
+
+  [[nodiscard]] DType GetArrayDType(std::size_t index) const {
+    return arrays_.at(index).dtype;
+  }
+
+  [[nodiscard]] const std::vector<std::uint64_t> &GetArrayShape(std::size_t index) const {
+    return arrays_.at(index).shape;
+  }
+
+  /// @brief Returns a view of an array's elements, valid while the file object lives.
+  /// @throws std::runtime_error If T does not match the stored element type.
+  template <typename T>
+  [[nodiscard]] std::span<const T> GetArray(std::size_t index) const {
+    const auto &array = arrays_.at(index);
+    if (array.dtype != GetDType<T>()) {
+      throw std::runtime_error("Element type mismatch in " + path_);
+    }
+    return {reinterpret_cast<const T *>(data_ + array.offset), array.num_elements};
+  }
+
+ private:
+  struct ArrayInfo {
+    DType dtype;
+    std::vector<std::uint64_t> shape;
+    std::size_t num_elements;
+    std::size_t offset;
+  };
+
+  void Unmap() noexcept;
+
+  std::string path_;
+  const unsigned char *data_ = nullptr;
+  std::size_t size_ = 0;
+  std::vector<ArrayInfo> arrays_;
+};
+
+/// @brief Collects typed arrays and writes them as a binary test data file (see BinaryDataFile).
+class BinaryDataWriter {
+ public:
+  /// @brief Appends an array; an empty shape means a 1-D array of values.size() elements.
+  /// @throws std::invalid_argument If the shape does not match the number of values.
+  template <typename T>
+  void AddArray(std::span<const T> values, std::vector<std::uint64_t> shape = {}) {
+    if (shape.empty()) {
+      shape.push_back(values.size());
+    }
+    std::vector<unsigned char> bytes(values.size_bytes());
+    if (!bytes.empty()) {
+      std::memcpy(bytes.data(), values.data(), bytes.size());
+    }
+    AddRawArray(GetDType<T>(), std::move(shape), std::move(bytes));
+  }
+
+  /// @brief Appends an array given as raw bytes in native byte order.
+  void AddRawArray(DType dtype, std::vector<std::uint64_t> shape, std::vector<unsigned char> bytes);
+
+  /// @throws std::runtime_error If the file cannot be written.
+  void Save(const std::string &path) const;
+
+ private:
+  struct Entry {
+    DType dtype;
+    std::vector<std::uint64_t> shape;
+    std::vector<unsigned char> bytes;
+  };
+  std::vector<Entry> entries_;
+};
+
+/// @brief Converts a whitespace-separated text data file into a binary one.
+/// @param text_path Source file.
+/// @param binary_path Destination file.
+/// @param dtype Element type of every array.
+/// @param header_dims For each array in the text, the number of leading values that give its shape
+/// (e.g. {2} for "rows cols" followed by the matrix). 0 makes the array take all remaining values.
+/// @throws std::runtime_error If the text cannot be read, parsed or does not match the layout.
+void ConvertTextToBinary(const std::string &text_path, const std::string &binary_path, DType dtype,
+                         const std::vector<std::size_t> &header_dims);
+
+}  // namespace ppc::util
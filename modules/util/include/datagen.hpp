@@ -0,0 +1,150 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @brief Deterministic synthetic input generators for tests.
+/// @details Every element is a pure function of (seed, element index), computed with the counter-based Philox4x32-10
+/// generator. Generation is therefore parallel (OpenMP) and bit-identical for any number of threads, and a rank can
+/// generate just its own slice of a global array by passing the index of its first element.
+namespace ppc::util::datagen {
+
+/// @brief Philox4x32-10 block: four 32-bit random words for a 64-bit counter and a 64-bit key.
+constexpr std::array<std::uint32_t, 4> Philox4x32(std::uint64_t counter, std::uint64_t key) {
+  constexpr std::uint32_t kMul0 = 0xD2511F53U;
+  constexpr std::uint32_t kMul1 = 0xCD9E8D57U;
+  constexpr std::uint32_t kWeyl0 = 0x9E3779B9U;
+  constexpr std::uint32_t kWeyl1 = 0xBB67AE85U;
+
+  std::array<std::uint32_t, 4> ctr = {static_cast<std::uint32_t>(counter), static_cast<std::uint32_t>(counter >> 32),
+                                      0U, 0U};
+  std::uint32_t key0 = static_cast<std::uint32_t>(key);
+  std::uint32_t key1 = static_cast<std::uint32_t>(key >> 32);
+  for (int round = 0; round < 10; round++) {
+    const std::uint64_t product0 = static_cast<std::uint64_t>(kMul0) * ctr[0];
+    const std::uint64_t product1 = static_cast<std::uint64_t>(kMul1) * ctr[2];
+    ctr = {static_cast<std::uint32_t>(product1 >> 32) ^ ctr[1] ^ key0, static_cast<std::uint32_t>(product1),
+           static_cast<std::uint32_t>(product0 >> 32) ^ ctr[3] ^ key1, static_cast<std::uint32_t>(product0)};
+    key0 += kWeyl0;
+    key1 += kWeyl1;
+  }
+  return ctr;
+}
+
+/// @brief 64 random bits of element `index` of the stream `seed`.
+constexpr std::uint64_t RandomBits(std::uint64_t seed, std::uint64_t index) {
+  const auto block = Philox4x32(index, seed);
+  return (static_cast<std::uint64_t>(block[0]) << 32) | block[1];
+}
+
+/// @brief Derives a seed from a name, e.g. the test suite, so that every rank regenerates the same data.
+std::uint64_t SeedFromName(std::string_view name);
+
+/// @brief Element `index` of a uniform stream in [lo, hi] for integers or [lo, hi) for floating-point types.
+template <typename T>
+constexpr T UniformValue(std::uint64_t seed, std::uint64_t index, T lo, T hi) {
+  const auto bits = RandomBits(seed, index);
+  if constexpr (std::is_floating_point_v<T>) {
+    const double unit = static_cast<double>(bits >> 11) * 0x1.0p-53;
+    return static_cast<T>(static_cast<double>(lo) + (unit * (static_cast<double>(hi) - static_cast<double>(lo))));
+  } else {
+    static_assert(std::is_integral_v<T>, "UniformValue supports integral and floating-point types");
+    const auto range = static_cast<std::uint64_t>(hi) - static_cast<std::uint64_t>(lo) + 1;
+    // range == 0 means the full 64-bit range
+    return static_cast<T>(static_cast<std::uint64_t>(lo) + (range == 0 ? bits : bits % range));
+  }
+}
+
+namespace detail {
+
+template <typename Body>
+void ParallelFor(std::size_t count, Body &&body) {
+  const auto signed_count = static_cast<std::int64_t>(count);
+#pragma omp parallel for schedule(static)
+  for (std::int64_t i = 0; i < signed_count; i++) {
+    body(static_cast<std::size_t>(i));
+  }
+}
+
+}  // namespace detail
+
+/// @brief Fills `out` with elements [first_index, first_index + out.size()) of a uniform stream.
+template <typename T>
+void FillUniform(std::span<T> out, std::uint64_t seed, T lo, T hi, std::uint64_t first_index = 0) {
+  detail::ParallelFor(out.size(), [&](std::size_t i) { out[i] = UniformValue<T>(seed, first_index + i, lo, hi); });
+}
+
+/// @brief Returns elements [first_index, first_index + count) of a uniform stream.
+template <typename T>
+std::vector<T> UniformVector(std::uint64_t seed, std::size_t count, T lo, T hi, std::uint64_t first_index = 0) {
+  std::vector<T> values(count);
+  FillUniform(std::span<T>(values), seed, lo, hi, first_index);
+  return values;
+}
+
+/// @brief Returns rows [first_row, first_row + rows) of a row-major uniform matrix with `cols` columns.
+template <typename T>
+std::vector<T> UniformMatrix(std::uint64_t seed, std::size_t rows, std::size_t cols, T lo, T hi,
+                             std::size_t first_row = 0) {
+  return UniformVector<T>(seed, rows * cols, lo, hi, static_cast<std::uint64_t>(first_row) * cols);
+}
+
+/// @brief Interleaved 8-bit pixels (row-major, `channels` values per pixel) of a noise image.
+std::vector<std::uint8_t> ImagePixels(std::uint64_t seed, std::size_t width, std::size_t height,
+                                      std::size_t channels);
+
+/// @brief Order of the values produced by OrderedVector().
+enum class Order : std::uint8_t {
+  /// Uniform values in random order
+  kRandom,
+  /// Non-decreasing
+  kSorted,
+  /// Non-increasing
+  kReversed,
+  /// Sorted, then a fraction of adjacent pairs swapped
+  kNearlySorted,
+};
+
+/// @brief Returns `count` values spread over [lo, hi] in the requested order.
+/// @param swap_fraction Fraction of adjacent pairs swapped for Order::kNearlySorted.
+template <typename T>
+std::vector<T> OrderedVector(std::uint64_t seed, std::size_t count, T lo, T hi, Order order,
+                             double swap_fraction = 0.01) {
+  if (order == Order::kRandom) {
+    return UniformVector<T>(seed, count, lo, hi);
+  }
+  std::vector<T> values(count);
+  if (count == 0) {
+    return values;
+  }
+  // Element i of the sorted sequence is drawn from the i-th of `count` equal buckets of [lo, hi]
+  const double bucket = (static_cast<double>(hi) - static_cast<double>(lo)) / static_cast<double>(count);
+  detail::ParallelFor(count, [&](std::size_t i) {
+    const double offset = UniformValue<double>(seed, i, 0.0, 1.0);
+    const double value = static_cast<double>(lo) + ((static_cast<double>(i) + offset) * bucket);
+    const std::size_t position = order == Order::kReversed ? count - 1 - i : i;
+    values[position] = static_cast<T>(value);
+  });
+  if (order == Order::kNearlySorted) {
+    const auto swap_seed = RandomBits(seed, ~std::uint64_t{0});
+    detail::ParallelFor(count / 2, [&](std::size_t pair) {
+      if (UniformValue<double>(swap_seed, pair, 0.0, 1.0) < swap_fraction) {
+        std::swap(values[2 * pair], values[(2 * pair) + 1]);
+      }
+    });
+  }
+  return values;
+}
+
+/// @brief Text of `num_words` lowercase words of min_length..max_length letters separated by single spaces.
+std::string TextCorpus(std::uint64_t seed, std::size_t num_words, std::size_t min_length = 1,
+                       std::size_t max_length = 10);
+
+}  // namespace ppc::util::datagen
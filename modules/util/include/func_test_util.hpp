@@ -13,6 +13,8 @@
 #include <type_traits>
 #include <utility>
 
+#include "task/include/batch_task.hpp"
+#include "task/include/memory_tracker.hpp"
 #include "task/include/task.hpp"
 #include "util/include/util.hpp"
 
@@ -105,6 +107,16 @@ class BaseRunFuncTests : public ::testing::TestWithParam<FuncTestParam<InType, O
     EXPECT_TRUE(task_->Run());
     EXPECT_TRUE(task_->PostProcessing());
     EXPECT_TRUE(CheckTestOutputData(task_->GetOutput()));
+    CheckMemoryLimit();
+  }
+
+  /// @brief Fails the test if a stage's footprint on this rank exceeds PPC_MEMORY_LIMIT_MB.
+  void CheckMemoryLimit() {
+    const auto memory_limit = ppc::task::GetMemoryLimitBytes();
+    if (memory_limit > 0) {
+      EXPECT_LE(task_->GetStageMemory().Peak().Footprint(), memory_limit)
+          << "A pipeline stage exceeded PPC_MEMORY_LIMIT_MB=" << GetMemoryLimitMb();
+    }
   }
 
  private:
@@ -142,4 +154,22 @@ constexpr auto AddFuncTask(const SizesContainer &sizes, const std::string &setti
   return TaskListGenerator<Task, InType>(sizes, settings_path);
 }
 
+template <typename Task, typename SizesContainer, std::size_t... Is>
+auto GenBatchTaskTuplesImpl(const SizesContainer &sizes, const std::string &settings_path,
+                            std::index_sequence<Is...> /*unused*/) {
+  return std::make_tuple(std::make_tuple(ppc::task::MakeBatchTask<Task>,
+                                         std::string(GetNamespace<Task>()) + "_" +
+                                             ppc::task::GetStringTaskType(Task::GetStaticTypeOfTask(), settings_path) +
+                                             "_batch",
+                                         sizes[Is])...);
+}
+
+/// @brief Like AddFuncTask, but each test runs a batch of inputs (std::vector<InType>) through
+/// ppc::task::MakeBatchTask<Task>.
+template <typename Task, typename SizesContainer>
+constexpr auto AddBatchFuncTask(const SizesContainer &sizes, const std::string &settings_path) {
+  return GenBatchTaskTuplesImpl<Task>(sizes, settings_path,
+                                      std::make_index_sequence<std::tuple_size_v<std::decay_t<SizesContainer>>>{});
+}
+
 }  // namespace ppc::util
@@ -3,29 +3,44 @@
 #include <gtest/gtest.h>
 #include <omp.h>
 
+#include <algorithm>
 #include <chrono>
 #include <csignal>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <iterator>
+#include <limits>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include "performance/include/perf_results_writer.hpp"
 #include "performance/include/performance.hpp"
+#include "task/include/memory_tracker.hpp"
 #include "task/include/task.hpp"
+#include "util/include/datagen.hpp"
 #include "util/include/util.hpp"
 
 namespace ppc::util {
 
 double GetTimeMPI();
 int GetMPIRank();
+int GetMPISize();
 
+/// @brief Perf test case: task getter, test name, perf mode, requested input size (0 for a fixed input) and
+/// whether the task accepts a ppc::task::DistributedInput.
 template <typename InType, typename OutType>
 using PerfTestParam = std::tuple<std::function<ppc::task::TaskPtr<InType, OutType>(InType)>, std::string,
-                                 ppc::performance::PerfResults::TypeOfRunning>;
+                                 ppc::performance::PerfResults::TypeOfRunning, std::size_t, bool>;
+
+template <typename TaskType>
+using TaskOutType = std::remove_cvref_t<decltype(std::declval<TaskType &>().GetOutput())>;
 
 template <typename InType, typename OutType>
 /// @brief Base class for performance testing of parallel tasks.
@@ -43,8 +58,64 @@ class BaseRunPerfTests : public ::testing::TestWithParam<PerfTestParam<InType, O
  protected:
   virtual bool CheckTestOutputData(OutType &output_data) = 0;
   /// @brief Supplies input data for performance testing.
+  /// @details Called once per test case, so large inputs can be handed over with `return std::move(input_data_);`.
   virtual InType GetTestInputData() = 0;
 
+  /// @brief Declares the work done by one run of the task, enabling throughput and roofline metrics.
+  /// @details Called before GetTestInputData(). The default declares no bytes or flops; elements then
+  /// fall back to the size of the input data.
+  virtual ppc::performance::PerfWork GetWork() {
+    return {};
+  }
+
+  /// @brief Returns the input size requested by a size-parameterised test case.
+  /// @details The size from MakeAllSizedPerfTasks() is multiplied by PPC_PERF_SIZE_SCALE, so weak-scaling
+  /// sweeps grow the input automatically. Available in SetUp().
+  /// @return Requested number of input elements, or 0 for tests with a fixed input.
+  /// @throws std::overflow_error if the scaled size does not fit into std::size_t.
+  static std::size_t GetRequestedInputSize() {
+    return GetRequestedInputSize(::testing::TestWithParam<PerfTestParam<InType, OutType>>::GetParam());
+  }
+
+  /// @brief GetRequestedInputSize() of the given test case parameter.
+  static std::size_t GetRequestedInputSize(const PerfTestParam<InType, OutType> &perf_test_param) {
+    const auto size = std::get<static_cast<std::size_t>(GTestParamIndex::kInputSize)>(perf_test_param);
+    const auto scale = static_cast<std::size_t>(GetPerfSizeScale());
+    if (size > std::numeric_limits<std::size_t>::max() / scale) {
+      throw std::overflow_error("Input size " + std::to_string(size) + " times PPC_PERF_SIZE_SCALE " +
+                                std::to_string(scale) + " overflows");
+    }
+    return size * scale;
+  }
+
+  /// @brief Seed for ppc::util::datagen generators, derived from the test suite name.
+  /// @details Identical for all implementations, modes and ranks of a task, so every rank can regenerate
+  /// the same input (or just its own slice of it) without a Scatter. Available in SetUp().
+  static std::uint64_t GetDataSeed() {
+    return datagen::SeedFromName(::testing::UnitTest::GetInstance()->current_test_info()->test_suite_name());
+  }
+
+  /// @brief True if every rank should generate only its own block of the input.
+  /// @details Holds for tasks declaring AcceptsDistributedInput() when run on several ranks, unless
+  /// PPC_PERF_DISTRIBUTED_INPUT=0 restores the root-owned input for comparison. Available in SetUp().
+  static bool IsInputDistributed() {
+    const bool accepts = std::get<static_cast<std::size_t>(GTestParamIndex::kDistributedInput)>(
+        ::testing::TestWithParam<PerfTestParam<InType, OutType>>::GetParam());
+    return accepts && IsDistributedInputEnabled() && GetMPISize() > 1;
+  }
+
+  /// @brief Builds the input of the calling rank: its own block if IsInputDistributed(), otherwise the whole array.
+  /// @param global_shape Shape of the global array, outermost dimension first.
+  /// @param fill Generates a block as fill(block, first_index), e.g. with ppc::util::datagen::FillUniform.
+  template <typename T>
+  static ppc::task::DistributedInput<T> MakeDistributedTestInput(
+      std::vector<std::size_t> global_shape, const std::function<void(std::span<T>, std::size_t)> &fill) {
+    if (IsInputDistributed()) {
+      return ppc::task::MakeDistributedInput<T>(std::move(global_shape), GetMPISize(), GetMPIRank(), fill);
+    }
+    return ppc::task::MakeDistributedInput<T>(std::move(global_shape), 1, 0, fill);
+  }
+
   virtual void SetPerfAttributes(ppc::performance::PerfAttr &perf_attrs) {
     if (task_->GetDynamicTypeOfTask() == ppc::task::TypeOfTask::kMPI ||
         task_->GetDynamicTypeOfTask() == ppc::task::TypeOfTask::kALL) {
@@ -71,6 +142,7 @@ class BaseRunPerfTests : public ::testing::TestWithParam<PerfTestParam<InType, O
     auto task_getter = std::get<static_cast<std::size_t>(GTestParamIndex::kTaskGetter)>(perf_test_param);
     auto test_name = std::get<static_cast<std::size_t>(GTestParamIndex::kNameTest)>(perf_test_param);
     auto mode = std::get<static_cast<std::size_t>(GTestParamIndex::kTestParams)>(perf_test_param);
+    const auto requested_size = GetRequestedInputSize(perf_test_param);
 
     ASSERT_FALSE(test_name.find("unknown") != std::string::npos);
     if (test_name.find("disabled") != std::string::npos) {
@@ -79,15 +151,25 @@ class BaseRunPerfTests : public ::testing::TestWithParam<PerfTestParam<InType, O
 
     const auto test_env_scope = ppc::util::test::MakePerTestEnvForCurrentGTest(test_name);
 
-    task_ = task_getter(GetTestInputData());
-    ppc::performance::Perf perf(task_);
     ppc::performance::PerfAttr perf_attr;
+    perf_attr.work = GetWork();
+    auto input_data = GetTestInputData();
+    const auto input_size = ppc::performance::GetInputSize(input_data);
+    task_ = task_getter(std::move(input_data));
+    ppc::performance::Perf perf(task_);
+    perf_attr.collect_counters = IsPerfCountersEnabled();
+    if (perf_attr.work.elements <= 0.0) {
+      perf_attr.work.elements = static_cast<double>(input_size);
+    }
+    perf_attr.input_size = requested_size > 0 ? requested_size : input_size;
     SetPerfAttributes(perf_attr);
 
     if (mode == ppc::performance::PerfResults::TypeOfRunning::kPipeline) {
       perf.PipelineRun(perf_attr);
     } else if (mode == ppc::performance::PerfResults::TypeOfRunning::kTaskRun) {
       perf.TaskRun(perf_attr);
+    } else if (mode == ppc::performance::PerfResults::TypeOfRunning::kWarm) {
+      perf.WarmRun(perf_attr);
     } else {
       std::stringstream err_msg;
       err_msg << '\n' << "The type of performance check for the task was not selected.\n";
@@ -95,9 +177,29 @@ class BaseRunPerfTests : public ::testing::TestWithParam<PerfTestParam<InType, O
     }
 
     if (GetMPIRank() == 0) {
+      ppc::performance::PerfRecord record;
+      record.test_id = test_name;
+      record.type_of_task = ppc::task::TypeOfTaskToString(task_->GetDynamicTypeOfTask());
+      record.task_namespace = ppc::performance::GetTaskNamespaceFromTestId(test_name, record.type_of_task);
+      record.type_of_running = ppc::performance::GetStringParamName(mode);
+      record.num_proc = GetNumProc();
+      record.num_threads = GetNumThreads();
+      record.size_scale = GetPerfSizeScale();
+      record.requested_size = requested_size;
+      record.input_size = input_size;
+      record.distributed_input = IsInputDistributed();
+      record.results = perf.GetPerfResults();
+      ppc::performance::AppendPerfRecord(record);
+
       perf.PrintPerfStatistic(test_name);
     }
 
+    const auto memory_limit = ppc::task::GetMemoryLimitBytes();
+    if (memory_limit > 0) {
+      EXPECT_LE(perf.GetPerfResults().memory.MaxFootprint(), memory_limit)
+          << "A rank exceeded PPC_MEMORY_LIMIT_MB=" << GetMemoryLimitMb();
+    }
+
     OutType output_data = task_->GetOutput();
     ASSERT_TRUE(CheckTestOutputData(output_data));
   }
@@ -111,10 +213,42 @@ auto MakePerfTaskTuples(const std::string &settings_path) {
   const auto name = std::string(GetNamespace<TaskType>()) + "_" +
                     ppc::task::GetStringTaskType(TaskType::GetStaticTypeOfTask(), settings_path);
 
+  constexpr bool kDistributed = TaskType::AcceptsDistributedInput();
+  return std::make_tuple(
+      std::make_tuple(ppc::task::TaskGetter<TaskType, InputType>, name,
+                      ppc::performance::PerfResults::TypeOfRunning::kPipeline, std::size_t{0}, kDistributed),
+      std::make_tuple(ppc::task::TaskGetter<TaskType, InputType>, name,
+                      ppc::performance::PerfResults::TypeOfRunning::kTaskRun, std::size_t{0}, kDistributed));
+}
+
+/// @brief Creates the warm-mode perf test case of a task (see ppc::performance::Perf::WarmRun()).
+template <typename TaskType, typename InputType>
+auto MakeWarmPerfTaskTuples(const std::string &settings_path) {
+  const auto name = std::string(GetNamespace<TaskType>()) + "_" +
+                    ppc::task::GetStringTaskType(TaskType::GetStaticTypeOfTask(), settings_path);
+
   return std::make_tuple(std::make_tuple(ppc::task::TaskGetter<TaskType, InputType>, name,
-                                         ppc::performance::PerfResults::TypeOfRunning::kPipeline),
-                         std::make_tuple(ppc::task::TaskGetter<TaskType, InputType>, name,
-                                         ppc::performance::PerfResults::TypeOfRunning::kTaskRun));
+                                         ppc::performance::PerfResults::TypeOfRunning::kWarm, std::size_t{0},
+                                         TaskType::AcceptsDistributedInput()));
+}
+
+/// @brief Creates one perf test case per (mode, size) for a task; sizes are encoded as "_size<N>" in the name.
+template <typename TaskType, typename InputType>
+auto MakeSizedPerfTaskParams(const std::string &settings_path, const std::vector<std::size_t> &sizes) {
+  const auto name = std::string(GetNamespace<TaskType>()) + "_" +
+                    ppc::task::GetStringTaskType(TaskType::GetStaticTypeOfTask(), settings_path);
+
+  std::vector<PerfTestParam<InputType, TaskOutType<TaskType>>> params;
+  for (const auto size : sizes) {
+    const auto sized_name = name + "_size" + std::to_string(size);
+    params.emplace_back(ppc::task::TaskGetter<TaskType, InputType>, sized_name,
+                        ppc::performance::PerfResults::TypeOfRunning::kPipeline, size,
+                        TaskType::AcceptsDistributedInput());
+    params.emplace_back(ppc::task::TaskGetter<TaskType, InputType>, sized_name,
+                        ppc::performance::PerfResults::TypeOfRunning::kTaskRun, size,
+                        TaskType::AcceptsDistributedInput());
+  }
+  return params;
 }
 
 template <typename Tuple, std::size_t... I>
@@ -133,4 +267,22 @@ auto MakeAllPerfTasks(const std::string &settings_path) {
   return std::tuple_cat(MakePerfTaskTuples<TaskTypes, InputType>(settings_path)...);
 }
 
+/// @brief Warm-mode counterpart of MakeAllPerfTasks(); combine both with std::tuple_cat.
+/// @details Warm cases time the full pipeline once the tasks' scratch buffers are sized, i.e. the steady state
+/// of a long-running service, and report the heap allocations left per iteration.
+template <typename InputType, typename... TaskTypes>
+auto MakeAllWarmPerfTasks(const std::string &settings_path) {
+  return std::tuple_cat(MakeWarmPerfTaskTuples<TaskTypes, InputType>(settings_path)...);
+}
+
+/// @brief Size-parameterised counterpart of MakeAllPerfTasks(); use with ::testing::ValuesIn.
+/// @details The fixture builds its input in SetUp() from GetRequestedInputSize().
+template <typename InputType, typename FirstTaskType, typename... TaskTypes>
+auto MakeAllSizedPerfTasks(const std::string &settings_path, const std::vector<std::size_t> &sizes) {
+  auto params = MakeSizedPerfTaskParams<FirstTaskType, InputType>(settings_path, sizes);
+  (std::ranges::move(MakeSizedPerfTaskParams<TaskTypes, InputType>(settings_path, sizes), std::back_inserter(params)),
+   ...);
+  return params;
+}
+
 }  // namespace ppc::util
@@ -64,13 +64,26 @@ class DestructorFailureFlag {
   inline static std::atomic<bool> failure_flag{false};
 };
 
-enum class GTestParamIndex : uint8_t { kTaskGetter, kNameTest, kTestParams };
+enum class GTestParamIndex : uint8_t { kTaskGetter, kNameTest, kTestParams, kInputSize, kDistributedInput };
 
+/// @brief Returns the absolute path of a file in a task's data directory.
+/// @details If the file does not exist but its binary variant (same name with the ".ppcb" extension) does,
+/// the binary variant is returned; check with IsBinaryDataPath() and read it with BinaryDataFile.
 std::string GetAbsoluteTaskPath(const std::string &id_path, const std::string &relative_path);
 int GetNumThreads();
 int GetNumProc();
 double GetTaskMaxTime();
 double GetPerfMaxTime();
+std::string GetPerfOutputPath();
+double GetPerfImbalanceThreshold();
+bool IsPerfCountersEnabled();
+int GetPerfSizeScale();
+bool IsDistributedInputEnabled();
+double GetPerfPeakBandwidth();
+double GetPerfPeakGflops();
+std::string GetCalibrationDir();
+std::string GetTraceOutputPath();
+double GetMemoryLimitMb();
 
 template <typename T>
 std::string GetNamespace() {
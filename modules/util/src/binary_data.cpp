@@ -0,0 +1,402 @@
+#include "util/include/binary_data.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace {
+
+constexpr std::array<char, 4> kMagic = {'P', 'P', 'C', 'B'};
+constexpr std::uint8_t kVersion = 1;
+constexpr std::uint8_t kLittleEndian = 1;
+constexpr std::uint8_t kBigEndian = 2;
+constexpr std::size_t kPayloadAlignment = 64;
+
+struct FileHeader {
+  std::array<char, 4> magic;
+  std::uint8_t version;
+  std::uint8_t byte_order;
+  std::uint16_t reserved;
+  std::uint32_t num_arrays;
+  std::uint32_t reserved2;
+};
+static_assert(sizeof(FileHeader) == 16);
+
+struct ArrayHeader {
+  std::uint8_t dtype;
+  std::uint8_t rank;
+  std::uint16_t reserved;
+  std::uint32_t reserved2;
+  std::uint64_t payload_bytes;
+};
+static_assert(sizeof(ArrayHeader) == 16);
+
+std::uint8_t NativeByteOrder() {
+  return std::endian::native == std::endian::little ? kLittleEndian : kBigEndian;
+}
+
+std::size_t AlignUp(std::size_t offset) {
+  return (offset + kPayloadAlignment - 1) / kPayloadAlignment * kPayloadAlignment;
+}
+
+// Product of the extents, or nothing if it does not fit into 64 bits
+std::optional<std::uint64_t> CountElements(const std::vector<std::uint64_t> &shape) {
+  if (std::ranges::find(shape, 0) != shape.end()) {
+    return 0;
+  }
+  std::uint64_t num_elements = 1;
+  for (auto extent : shape) {
+    if (num_elements > std::numeric_limits<std::uint64_t>::max() / extent) {
+      return std::nullopt;
+    }
+    num_elements *= extent;
+  }
+  return num_elements;
+}
+
+template <typename T>
+void AppendParsed(const std::string &token, std::vector<unsigned char> &bytes) {
+  T value{};
+  const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+  if (ec != std::errc() || ptr != token.data() + token.size()) {
+    throw std::runtime_error("Cannot parse '" + token + "' as the requested element type");
+  }
+  const auto old_size = bytes.size();
+  bytes.resize(old_size + sizeof(T));
+  std::memcpy(bytes.data() + old_size, &value, sizeof(T));
+}
+
+void AppendToken(ppc::util::DType dtype, const std::string &token, std::vector<unsigned char> &bytes) {
+  using ppc::util::DType;
+  switch (dtype) {
+    case DType::kInt8:
+      AppendParsed<int8_t>(token, bytes);
+      break;
+    case DType::kUInt8:
+      AppendParsed<uint8_t>(token, bytes);
+      break;
+    case DType::kInt16:
+      AppendParsed<int16_t>(token, bytes);
+      break;
+    case DType::kUInt16:
+      AppendParsed<uint16_t>(token, bytes);
+      break;
+    case DType::kInt32:
+      AppendParsed<int32_t>(token, bytes);
+      break;
+    case DType::kUInt32:
+      AppendParsed<uint32_t>(token, bytes);
+      break;
+    case DType::kInt64:
+      AppendParsed<int64_t>(token, bytes);
+      break;
+    case DType::kUInt64:
+      AppendParsed<uint64_t>(token, bytes);
+      break;
+    case DType::kFloat32:
+      AppendParsed<float>(token, bytes);
+      break;
+    case DType::kFloat64:
+      AppendParsed<double>(token, bytes);
+      break;
+  }
+}
+
+}  // namespace
+
+std::size_t ppc::util::GetDTypeSize(DType dtype) {
+  switch (dtype) {
+    case DType::kInt8:
+    case DType::kUInt8:
+      return 1;
+    case DType::kInt16:
+    case DType::kUInt16:
+      return 2;
+    case DType::kInt32:
+    case DType::kUInt32:
+    case DType::kFloat32:
+      return 4;
+    case DType::kInt64:
+    case DType::kUInt64:
+    case DType::kFloat64:
+      return 8;
+  }
+  throw std::invalid_argument("Unknown element type");
+}
+
+ppc::util::DType ppc::util::ParseDType(const std::string &name) {
+  static const std::array<std::pair<const char *, DType>, 10> kNames = {{{"int8", DType::kInt8},
+                                                                         {"uint8", DType::kUInt8},
+                                                                         {"int16", DType::kInt16},
+                                                                         {"uint16", DType::kUInt16},
+                                                                         {"int32", DType::kInt32},
+                                                                         {"uint32", DType::kUInt32},
+                                                                         {"int64", DType::kInt64},
+                                                                         {"uint64", DType::kUInt64},
+                                                                         {"float32", DType::kFloat32},
+                                                                         {"float64", DType::kFloat64}}};
+  for (const auto &[type_name, dtype] : kNames) {
+    if (name == type_name) {
+      return dtype;
+    }
+  }
+  throw std::invalid_argument("Unknown element type: " + name);
+}
+
+std::string ppc::util::GetBinaryVariantPath(const std::string &path) {
+  return std::filesystem::path(path).replace_extension(kBinaryDataExtension).string();
+}
+
+bool ppc::util::IsBinaryDataPath(const std::string &path) {
+  return std::filesystem::path(path).extension() == kBinaryDataExtension;
+}
+
+std::string ppc::util::ResolveBinaryVariant(const std::string &path) {
+  if (!std::filesystem::exists(path)) {
+    auto binary_path = GetBinaryVariantPath(path);
+    if (std::filesystem::exists(binary_path)) {
+      return binary_path;
+    }
+  }
+  return path;
+}
+
+ppc::util::BinaryDataFile::BinaryDataFile(const std::string &path) : path_(path) {
+#ifdef _WIN32
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    throw std::runtime_error("Failed to open " + path);
+  }
+  LARGE_INTEGER file_size{};
+  GetFileSizeEx(file, &file_size);
+  size_ = static_cast<std::size_t>(file_size.QuadPart);
+  HANDLE mapping = size_ > 0 ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+  CloseHandle(file);
+  if (mapping != nullptr) {
+    data_ = static_cast<const unsigned char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+  }
+#else
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Failed to open " + path);
+  }
+  struct stat file_stat{};
+  if (fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+    size_ = static_cast<std::size_t>(file_stat.st_size);
+    void *mapped = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    data_ = mapped == MAP_FAILED ? nullptr : static_cast<const unsigned char *>(mapped);
+  }
+  close(fd);
+#endif
+  if (data_ == nullptr) {
+    throw std::runtime_error("Failed to map " + path);
+  }
+
+  // Validate the whole table of contents up front so that GetArray() only has to check the type
+  try {
+    FileHeader header{};
+    if (size_ < sizeof(header)) {
+      throw std::runtime_error("Truncated binary data file " + path);
+    }
+    std::memcpy(&header, data_, sizeof(header));
+    if (header.magic != kMagic || header.version != kVersion) {
+      throw std::runtime_error("Not a binary data file: " + path);
+    }
+    if (header.byte_order != NativeByteOrder()) {
+      throw std::runtime_error("Byte order of " + path + " does not match this machine");
+    }
+
+    std::size_t offset = sizeof(header);
+    for (std::uint32_t i = 0; i < header.num_arrays; i++) {
+      ArrayHeader array_header{};
+      if (offset + sizeof(array_header) > size_) {
+        throw std::runtime_error("Truncated binary data file " + path);
+      }
+      std::memcpy(&array_header, data_ + offset, sizeof(array_header));
+      offset += sizeof(array_header);
+
+      if (array_header.dtype > static_cast<std::uint8_t>(DType::kFloat64)) {
+        throw std::runtime_error("Unknown element type in binary data file " + path);
+      }
+      ArrayInfo info{.dtype = static_cast<DType>(array_header.dtype), .shape = {}, .num_elements = 0, .offset = 0};
+      if (offset + (array_header.rank * sizeof(std::uint64_t)) > size_) {
+        throw std::runtime_error("Truncated binary data file " + path);
+      }
+      info.shape.resize(array_header.rank);
+      std::memcpy(info.shape.data(), data_ + offset, array_header.rank * sizeof(std::uint64_t));
+      offset = AlignUp(offset + (array_header.rank * sizeof(std::uint64_t)));
+
+      // The shape comes from the file, so its product is checked against the bytes that are actually there
+      const auto num_elements = CountElements(info.shape);
+      const std::uint64_t max_elements = (size_ > offset ? size_ - offset : 0) / GetDTypeSize(info.dtype);
+      if (!num_elements || *num_elements > max_elements ||
+          *num_elements * GetDTypeSize(info.dtype) != array_header.payload_bytes) {
+        throw std::runtime_error("Corrupted array in binary data file " + path);
+      }
+      info.num_elements = static_cast<std::size_t>(*num_elements);
+      info.offset = offset;
+      offset = AlignUp(offset + array_header.payload_bytes);
+      arrays_.push_back(std::move(info));
+    }
+  } catch (...) {
+    Unmap();
+    throw;
+  }
+}
+
+ppc::util::BinaryDataFile::~BinaryDataFile() {
+  Unmap();
+}
+
+ppc::util::BinaryDataFile::BinaryDataFile(BinaryDataFile &&other) noexcept
+    : path_(std::move(other.path_)),
+      data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      arrays_(std::move(other.arrays_)) {}
+
+ppc::util::BinaryDataFile &ppc::util::BinaryDataFile::operator=(BinaryDataFile &&other) noexcept {
+  if (this != &other) {
+    Unmap();
+    path_ = std::move(other.path_);
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    arrays_ = std::move(other.arrays_);
+  }
+  return *this;
+}
+
+void ppc::util::BinaryDataFile::Unmap() noexcept {
+  if (data_ == nullptr) {
+    return;
+  }
+#ifdef _WIN32
+  UnmapViewOfFile(data_);
+#else
+  munmap(const_cast<unsigned char *>(data_), size_);
+#endif
+  data_ = nullptr;
+  size_ = 0;
+}
+
+void ppc::util::BinaryDataWriter::AddRawArray(DType dtype, std::vector<std::uint64_t> shape,
+                                              std::vector<unsigned char> bytes) {
+  const auto num_elements = CountElements(shape);
+  if (shape.empty() || !num_elements || *num_elements > bytes.size() / GetDTypeSize(dtype) ||
+      *num_elements * GetDTypeSize(dtype) != bytes.size()) {
+    throw std::invalid_argument("Array shape does not match the number of values");
+  }
+  entries_.push_back({.dtype = dtype, .shape = std::move(shape), .bytes = std::move(bytes)});
+}
+
+void ppc::util::BinaryDataWriter::Save(const std::string &path) const {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    throw std::runtime_error("Failed to open " + path);
+  }
+  std::size_t offset = 0;
+  auto write = [&](const void *data, std::size_t bytes) {
+    file.write(static_cast<const char *>(data), static_cast<std::streamsize>(bytes));
+    offset += bytes;
+  };
+  auto pad = [&]() {
+    static constexpr std::array<char, kPayloadAlignment> kZeros{};
+    write(kZeros.data(), AlignUp(offset) - offset);
+  };
+
+  const FileHeader header{.magic = kMagic,
+                          .version = kVersion,
+                          .byte_order = NativeByteOrder(),
+                          .reserved = 0,
+                          .num_arrays = static_cast<std::uint32_t>(entries_.size()),
+                          .reserved2 = 0};
+  write(&header, sizeof(header));
+  for (const auto &entry : entries_) {
+    const ArrayHeader array_header{.dtype = static_cast<std::uint8_t>(entry.dtype),
+                                   .rank = static_cast<std::uint8_t>(entry.shape.size()),
+                                   .reserved = 0,
+                                   .reserved2 = 0,
+                                   .payload_bytes = entry.bytes.size()};
+    write(&array_header, sizeof(array_header));
+    write(entry.shape.data(), entry.shape.size() * sizeof(std::uint64_t));
+    pad();
+    write(entry.bytes.data(), entry.bytes.size());
+    pad();
+  }
+  if (!file) {
+    throw std::runtime_error("Failed to write " + path);
+  }
+}
+
+void ppc::util::ConvertTextToBinary(const std::string &text_path, const std::string &binary_path, DType dtype,
+                                    const std::vector<std::size_t> &header_dims) {
+  std::ifstream file(text_path);
+  if (!file.is_open()) {
+    throw std::runtime_error("Failed to open " + text_path);
+  }
+  const std::vector<std::string> tokens{std::istream_iterator<std::string>(file), std::istream_iterator<std::string>()};
+
+  BinaryDataWriter writer;
+  std::size_t pos = 0;
+  for (const auto dims : header_dims) {
+    std::vector<std::uint64_t> shape;
+    for (std::size_t i = 0; i < dims; i++) {
+      if (pos >= tokens.size()) {
+        throw std::runtime_error("Missing shape values in " + text_path);
+      }
+      std::uint64_t extent = 0;
+      const auto &token = tokens[pos++];
+      const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), extent);
+      if (ec != std::errc() || ptr != token.data() + token.size()) {
+        throw std::runtime_error("Invalid shape value '" + token + "' in " + text_path);
+      }
+      shape.push_back(extent);
+    }
+    if (dims == 0) {
+      shape.push_back(tokens.size() - pos);
+    }
+    const auto num_elements = CountElements(shape);
+    if (!num_elements) {
+      throw std::runtime_error("Array shape overflows in " + text_path);
+    }
+    // Bounded by the token count, so the reservation below cannot overflow
+    if (*num_elements > tokens.size() - pos) {
+      throw std::runtime_error("Not enough values in " + text_path);
+    }
+
+    std::vector<unsigned char> bytes;
+    bytes.reserve(static_cast<std::size_t>(*num_elements) * GetDTypeSize(dtype));
+    for (std::uint64_t i = 0; i < *num_elements; i++) {
+      AppendToken(dtype, tokens[pos++], bytes);
+    }
+    writer.AddRawArray(dtype, std::move(shape), std::move(bytes));
+  }
+  if (pos != tokens.size()) {
+    throw std::runtime_error("Unconsumed values at the end of " + text_path);
+  }
+  writer.Save(binary_path);
+}
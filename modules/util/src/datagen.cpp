@@ -0,0 +1,52 @@
+#include "util/include/datagen.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+std::uint64_t ppc::util::datagen::SeedFromName(std::string_view name) {
+  // FNV-1a, stable across platforms and standard library implementations
+  std::uint64_t hash = 0xCBF29CE484222325ULL;
+  for (const char ch : name) {
+    hash ^= static_cast<unsigned char>(ch);
+    hash *= 0x100000001B3ULL;
+  }
+  return hash;
+}
+
+std::vector<std::uint8_t> ppc::util::datagen::ImagePixels(std::uint64_t seed, std::size_t width, std::size_t height,
+                                                          std::size_t channels) {
+  return UniformVector<std::uint8_t>(seed, width * height * channels, 0, 255);
+}
+
+std::string ppc::util::datagen::TextCorpus(std::uint64_t seed, std::size_t num_words, std::size_t min_length,
+                                           std::size_t max_length) {
+  if (num_words == 0) {
+    return {};
+  }
+  // Word lengths first, so that every word knows its offset before the letters are filled in parallel
+  std::vector<std::size_t> offsets(num_words + 1, 0);
+  const auto length_seed = RandomBits(seed, ~std::uint64_t{0});
+  detail::ParallelFor(num_words, [&](std::size_t word) {
+    offsets[word + 1] = UniformValue<std::size_t>(length_seed, word, min_length, max_length) + 1;
+  });
+  for (std::size_t word = 0; word < num_words; word++) {
+    offsets[word + 1] += offsets[word];
+  }
+
+  std::string text(offsets[num_words] - 1, ' ');
+  const std::size_t blocks_per_word = (max_length + 3) / 4;
+  detail::ParallelFor(num_words, [&](std::size_t word) {
+    const std::size_t length = offsets[word + 1] - offsets[word] - 1;
+    for (std::size_t letter = 0; letter < length; letter += 4) {
+      const auto block = Philox4x32((word * blocks_per_word) + (letter / 4), seed);
+      for (std::size_t k = 0; k < 4 && letter + k < length; k++) {
+        text[offsets[word] + letter + k] = static_cast<char>('a' + (block.at(k) % 26));
+      }
+    }
+  });
+  return text;
+}
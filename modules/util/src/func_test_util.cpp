@@ -11,3 +11,9 @@ int ppc::util::GetMPIRank() {
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   return rank;
 }
+
+int ppc::util::GetMPISize() {
+  int size = 0;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  return size;
+}
@@ -6,6 +6,8 @@
 #include <libenvpp/detail/get.hpp>
 #include <string>
 
+#include "util/include/binary_data.hpp"
+
 namespace {
 
 std::string GetAbsolutePath(const std::string &relative_path) {
@@ -17,7 +19,8 @@ std::string GetAbsolutePath(const std::string &relative_path) {
 
 std::string ppc::util::GetAbsoluteTaskPath(const std::string &id_path, const std::string &relative_path) {
   std::filesystem::path task_relative = std::filesystem::path(id_path) / "data" / relative_path;
-  return GetAbsolutePath(task_relative.string());
+  // Large inputs may be shipped only in the binary format (see binary_data.hpp)
+  return ResolveBinaryVariant(GetAbsolutePath(task_relative.string()));
 }
 
 int ppc::util::GetNumThreads() {
@@ -52,6 +55,80 @@ double ppc::util::GetPerfMaxTime() {
   return 10.0;
 }
 
+std::string ppc::util::GetPerfOutputPath() {
+  const auto val = env::get<std::string>("PPC_PERF_OUTPUT");
+  if (val.has_value()) {
+    return val.value();
+  }
+  return {};
+}
+
+double ppc::util::GetPerfImbalanceThreshold() {
+  const auto val = env::get<double>("PPC_PERF_IMBALANCE_THRESHOLD");
+  if (val.has_value()) {
+    return val.value();
+  }
+  return 1.25;
+}
+
+bool ppc::util::IsPerfCountersEnabled() {
+  const auto val = env::get<int>("PPC_PERF_COUNTERS");
+  return val.has_value() && val.value() != 0;
+}
+
+int ppc::util::GetPerfSizeScale() {
+  const auto val = env::get<int>("PPC_PERF_SIZE_SCALE");
+  if (val.has_value() && val.value() > 0) {
+    return val.value();
+  }
+  return 1;
+}
+
+bool ppc::util::IsDistributedInputEnabled() {
+  const auto val = env::get<int>("PPC_PERF_DISTRIBUTED_INPUT");
+  return !val.has_value() || val.value() != 0;
+}
+
+double ppc::util::GetPerfPeakBandwidth() {
+  const auto val = env::get<double>("PPC_PERF_PEAK_BANDWIDTH");
+  if (val.has_value() && val.value() > 0.0) {
+    return val.value();
+  }
+  return 0.0;
+}
+
+double ppc::util::GetPerfPeakGflops() {
+  const auto val = env::get<double>("PPC_PERF_PEAK_GFLOPS");
+  if (val.has_value() && val.value() > 0.0) {
+    return val.value();
+  }
+  return 0.0;
+}
+
+std::string ppc::util::GetCalibrationDir() {
+  const auto val = env::get<std::string>("PPC_CALIBRATION_DIR");
+  if (val.has_value() && !val.value().empty()) {
+    return val.value();
+  }
+  return (std::filesystem::path(PPC_PATH_TO_PROJECT) / "build" / "perf_stat_dir" / "calibration").string();
+}
+
+std::string ppc::util::GetTraceOutputPath() {
+  const auto val = env::get<std::string>("PPC_TRACE_OUTPUT");
+  if (val.has_value()) {
+    return val.value();
+  }
+  return "";
+}
+
+double ppc::util::GetMemoryLimitMb() {
+  const auto val = env::get<double>("PPC_MEMORY_LIMIT_MB");
+  if (val.has_value()) {
+    return val.value();
+  }
+  return 0.0;
+}
+
 // List of environment variables that signal the application is running under
 // an MPI launcher. The array size must match the number of entries to avoid
 // looking up empty environment variable names.
@@ -2,11 +2,21 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <libenvpp/detail/environment.hpp>
 #include <libenvpp/detail/get.hpp>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "omp.h"
+#include "util/include/binary_data.hpp"
+#include "util/include/datagen.hpp"
 
 namespace my::nested {
 struct Type {};
@@ -124,3 +134,224 @@ TEST(GetNumProc, ReadsFromEnvironment) {
   env::detail::set_scoped_environment_variable scoped("PPC_NUM_PROC", "4");
   EXPECT_EQ(ppc::util::GetNumProc(), 4);
 }
+
+TEST(GetPerfImbalanceThreshold, ReturnsDefaultWhenUnset) {
+  const auto old = env::get<double>("PPC_PERF_IMBALANCE_THRESHOLD");
+  if (old.has_value()) {
+    env::detail::delete_environment_variable("PPC_PERF_IMBALANCE_THRESHOLD");
+  }
+  EXPECT_DOUBLE_EQ(ppc::util::GetPerfImbalanceThreshold(), 1.25);
+  if (old.has_value()) {
+    env::detail::set_environment_variable("PPC_PERF_IMBALANCE_THRESHOLD", std::to_string(*old));
+  }
+}
+
+TEST(GetPerfImbalanceThreshold, ReadsFromEnvironment) {
+  env::detail::set_scoped_environment_variable scoped("PPC_PERF_IMBALANCE_THRESHOLD", "1.5");
+  EXPECT_DOUBLE_EQ(ppc::util::GetPerfImbalanceThreshold(), 1.5);
+}
+
+TEST(GetPerfSizeScale, ReturnsDefaultWhenUnset) {
+  const auto old = env::get<int>("PPC_PERF_SIZE_SCALE");
+  if (old.has_value()) {
+    env::detail::delete_environment_variable("PPC_PERF_SIZE_SCALE");
+  }
+  EXPECT_EQ(ppc::util::GetPerfSizeScale(), 1);
+  if (old.has_value()) {
+    env::detail::set_environment_variable("PPC_PERF_SIZE_SCALE", std::to_string(*old));
+  }
+}
+
+TEST(GetPerfSizeScale, ReadsFromEnvironment) {
+  env::detail::set_scoped_environment_variable scoped("PPC_PERF_SIZE_SCALE", "8");
+  EXPECT_EQ(ppc::util::GetPerfSizeScale(), 8);
+}
+
+TEST(GetPerfSizeScale, IgnoresNonPositiveValues) {
+  env::detail::set_scoped_environment_variable scoped("PPC_PERF_SIZE_SCALE", "0");
+  EXPECT_EQ(ppc::util::GetPerfSizeScale(), 1);
+}
+
+TEST(GetPerfPeakBandwidth, ReadsFromEnvironment) {
+  env::detail::set_scoped_environment_variable scoped("PPC_PERF_PEAK_BANDWIDTH", "25.5");
+  EXPECT_DOUBLE_EQ(ppc::util::GetPerfPeakBandwidth(), 25.5);
+}
+
+TEST(GetCalibrationDir, ReadsFromEnvironment) {
+  env::detail::set_scoped_environment_variable scoped("PPC_CALIBRATION_DIR", "/tmp/ppc_calibration");
+  EXPECT_EQ(ppc::util::GetCalibrationDir(), "/tmp/ppc_calibration");
+}
+
+TEST(GetPerfPeakGflops, ReadsFromEnvironment) {
+  env::detail::set_scoped_environment_variable scoped("PPC_PERF_PEAK_GFLOPS", "100");
+  EXPECT_DOUBLE_EQ(ppc::util::GetPerfPeakGflops(), 100.0);
+}
+
+TEST(BinaryData, RoundTripsArraysThroughMemoryMap) {
+  const auto path = (std::filesystem::temp_directory_path() / "ppc_binary_round_trip.ppcb").string();
+  const std::vector<int32_t> matrix = {1, -2, 3, -4, 5, -6};
+  const std::vector<double> vector = {0.5, 1.5};
+  ppc::util::BinaryDataWriter writer;
+  writer.AddArray(std::span<const int32_t>(matrix), {2, 3});
+  writer.AddArray(std::span<const double>(vector));
+  writer.Save(path);
+
+  {
+    const ppc::util::BinaryDataFile file(path);
+    ASSERT_EQ(file.GetNumArrays(), 2U);
+    EXPECT_EQ(file.GetArrayDType(0), ppc::util::DType::kInt32);
+    EXPECT_EQ(file.GetArrayShape(0), (std::vector<std::uint64_t>{2, 3}));
+    const auto matrix_view = file.GetArray<int32_t>(0);
+    EXPECT_EQ(std::vector<int32_t>(matrix_view.begin(), matrix_view.end()), matrix);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(matrix_view.data()) % 64, 0U);
+    const auto vector_view = file.GetArray<double>(1);
+    EXPECT_EQ(std::vector<double>(vector_view.begin(), vector_view.end()), vector);
+    EXPECT_THROW((void)file.GetArray<float>(1), std::runtime_error);
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(BinaryData, ConvertsTextWithShapeHeaders) {
+  const auto dir = std::filesystem::temp_directory_path();
+  const auto text_path = (dir / "ppc_binary_convert.txt").string();
+  std::ofstream(text_path) << "2 3\n 1 2 3\n 4 5 6\n 5 7 9\n";
+  const auto binary_path = ppc::util::GetBinaryVariantPath(text_path);
+  EXPECT_TRUE(ppc::util::IsBinaryDataPath(binary_path));
+
+  ppc::util::ConvertTextToBinary(text_path, binary_path, ppc::util::ParseDType("int32"), {2, 0});
+  {
+    const ppc::util::BinaryDataFile file(binary_path);
+    ASSERT_EQ(file.GetNumArrays(), 2U);
+    EXPECT_EQ(file.GetArrayShape(0), (std::vector<std::uint64_t>{2, 3}));
+    EXPECT_EQ(file.GetArray<int32_t>(0)[5], 6);
+    EXPECT_EQ(file.GetArrayShape(1), (std::vector<std::uint64_t>{3}));
+    EXPECT_EQ(file.GetArray<int32_t>(1)[2], 9);
+  }
+
+  EXPECT_THROW(ppc::util::ConvertTextToBinary(text_path, binary_path, ppc::util::DType::kInt32, {2}),
+               std::runtime_error);
+  EXPECT_THROW(ppc::util::ParseDType("complex"), std::invalid_argument);
+
+  // 2^32 * 2^32 elements wrap to 0 in 64 bits
+  std::ofstream(text_path) << "4294967296 4294967296\n1 2\n";
+  EXPECT_THROW(ppc::util::ConvertTextToBinary(text_path, binary_path, ppc::util::DType::kInt32, {2}),
+               std::runtime_error);
+  std::ofstream(text_path) << "4294967296 4294967295\n1 2\n";
+  EXPECT_THROW(ppc::util::ConvertTextToBinary(text_path, binary_path, ppc::util::DType::kInt32, {2}),
+               std::runtime_error);
+  std::filesystem::remove(text_path);
+  std::filesystem::remove(binary_path);
+}
+
+TEST(BinaryData, RejectsFilesInOtherFormats) {
+  const auto path = (std::filesystem::temp_directory_path() / "ppc_binary_garbage.ppcb").string();
+  std::ofstream(path) << "1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16";
+  EXPECT_THROW(ppc::util::BinaryDataFile{path}, std::runtime_error);
+  std::filesystem::remove(path);
+  EXPECT_THROW(ppc::util::BinaryDataFile{path}, std::runtime_error);
+}
+
+TEST(BinaryData, RejectsShapesWhoseSizeOverflows) {
+  const auto path = (std::filesystem::temp_directory_path() / "ppc_binary_overflow.ppcb").string();
+  const std::vector<int8_t> values = {1, 2, 3, 4};
+  ppc::util::BinaryDataWriter writer;
+  writer.AddArray(std::span<const int8_t>(values), {1, 4});
+  writer.Save(path);
+  ASSERT_NO_THROW(ppc::util::BinaryDataFile{path});
+
+  // (2^62 + 1) * 4 wraps around to the 4 bytes of payload
+  const std::uint64_t huge_extent = (std::uint64_t{1} << 62) + 1;
+  {
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    // File header and array header take 16 bytes each, the shape follows
+    file.seekp(32);
+    file.write(reinterpret_cast<const char *>(&huge_extent), sizeof(huge_extent));
+  }
+  EXPECT_THROW(ppc::util::BinaryDataFile{path}, std::runtime_error);
+  EXPECT_THROW(writer.AddRawArray(ppc::util::DType::kInt8, {huge_extent, 4}, {1, 2, 3, 4}), std::invalid_argument);
+  std::filesystem::remove(path);
+}
+
+TEST(BinaryData, KeepsEmptyArrays) {
+  const auto path = (std::filesystem::temp_directory_path() / "ppc_binary_empty.ppcb").string();
+  ppc::util::BinaryDataWriter writer;
+  writer.AddRawArray(ppc::util::DType::kFloat64, {5, 0}, {});
+  writer.Save(path);
+  {
+    const ppc::util::BinaryDataFile file(path);
+    EXPECT_EQ(file.GetArrayShape(0), (std::vector<std::uint64_t>{5, 0}));
+    EXPECT_TRUE(file.GetArray<double>(0).empty());
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(ResolveBinaryVariant, FindsBinaryVariantOfMissingTextFile) {
+  const auto data_dir = std::filesystem::temp_directory_path() / "ppc_binary_variant_test";
+  std::filesystem::remove_all(data_dir);
+  std::filesystem::create_directories(data_dir);
+  const auto text_path = (data_dir / "input.txt").string();
+
+  EXPECT_EQ(ppc::util::ResolveBinaryVariant(text_path), text_path);
+  std::ofstream(data_dir / "input.ppcb").put('\0');
+  EXPECT_EQ(ppc::util::ResolveBinaryVariant(text_path), (data_dir / "input.ppcb").string());
+  std::ofstream(text_path) << "1";
+  EXPECT_EQ(ppc::util::ResolveBinaryVariant(text_path), text_path);
+
+  std::filesystem::remove_all(data_dir);
+}
+
+TEST(GetAbsoluteTaskPath, PointsIntoTheDataDirectoryOfTheTask) {
+  const auto expected = std::filesystem::path(PPC_PATH_TO_PROJECT) / "tasks" / "ppc_missing_task" / "data" / "in.txt";
+  EXPECT_EQ(ppc::util::GetAbsoluteTaskPath("ppc_missing_task", "in.txt"), expected.string());
+}
+
+TEST(Datagen, PhiloxMatchesKnownAnswer) {
+  // Random123 known-answer test for philox4x32_10 with zero counter and key
+  const auto block = ppc::util::datagen::Philox4x32(0, 0);
+  EXPECT_EQ(block[0], 0x6627e8d5U);
+  EXPECT_EQ(block[1], 0xe169c58dU);
+  EXPECT_EQ(block[2], 0xbc57ac4cU);
+  EXPECT_EQ(block[3], 0x9b00dbd8U);
+}
+
+TEST(Datagen, IsIdenticalForAnyThreadCountAndSlice) {
+  namespace datagen = ppc::util::datagen;
+  const auto seed = datagen::SeedFromName("Datagen");
+  const int old_threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+  const auto serial = datagen::UniformVector<int>(seed, 10000, -100, 100);
+  omp_set_num_threads(4);
+  const auto parallel = datagen::UniformVector<int>(seed, 10000, -100, 100);
+  omp_set_num_threads(old_threads);
+  EXPECT_EQ(serial, parallel);
+  EXPECT_TRUE(std::ranges::all_of(serial, [](int value) { return value >= -100 && value <= 100; }));
+
+  const auto slice = datagen::UniformVector<int>(seed, 100, -100, 100, 5000);
+  EXPECT_TRUE(std::equal(slice.begin(), slice.end(), serial.begin() + 5000));
+  const auto rows = datagen::UniformMatrix<int>(seed, 2, 100, -100, 100, 50);
+  EXPECT_TRUE(std::equal(rows.begin(), rows.end(), serial.begin() + 5000));
+  EXPECT_NE(datagen::UniformVector<int>(seed + 1, 100, -100, 100),
+            std::vector<int>(serial.begin(), serial.begin() + 100));
+}
+
+TEST(Datagen, ProducesOrderedVectors) {
+  namespace datagen = ppc::util::datagen;
+  const auto sorted = datagen::OrderedVector<int>(1, 1000, 0, 1000000, datagen::Order::kSorted);
+  EXPECT_TRUE(std::ranges::is_sorted(sorted));
+  const auto reversed = datagen::OrderedVector<double>(1, 1000, -1.0, 1.0, datagen::Order::kReversed);
+  EXPECT_TRUE(std::ranges::is_sorted(reversed, std::greater<>()));
+  const auto nearly = datagen::OrderedVector<int>(1, 1000, 0, 1000000, datagen::Order::kNearlySorted, 0.1);
+  EXPECT_FALSE(std::ranges::is_sorted(nearly));
+  auto resorted = nearly;
+  std::ranges::sort(resorted);
+  EXPECT_EQ(resorted, sorted);
+}
+
+TEST(Datagen, ProducesTextAndImages) {
+  namespace datagen = ppc::util::datagen;
+  const auto text = datagen::TextCorpus(7, 1000, 2, 9);
+  EXPECT_EQ(std::ranges::count(text, ' '), 999);
+  EXPECT_TRUE(std::ranges::all_of(text, [](char ch) { return ch == ' ' || (ch >= 'a' && ch <= 'z'); }));
+  EXPECT_EQ(text, datagen::TextCorpus(7, 1000, 2, 9));
+  EXPECT_EQ(datagen::ImagePixels(7, 4, 3, 3).size(), 36U);
+}
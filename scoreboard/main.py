@@ -129,10 +129,75 @@ def discover_tasks(tasks_dir, task_types):
 directories, tasks_type_map = discover_tasks(tasks_dir, task_types)
 
 
+def load_performance_records(
+    perf_records_path: Path,
+    columns: list[str],
+    missing: str = "?",
+    perf_type: str = "task_run",
+    num_proc: int | None = None,
+) -> dict:
+    """Load perf results from JSON Lines records written via ``PPC_PERF_OUTPUT``.
+
+    Returns a mapping: task namespace -> {column: time in seconds as string}.
+    Columns without a record are filled with ``missing``. For size-parameterised
+    tests the record with the largest requested input size is used.
+    Records of runs with different process counts (``num_proc``, 1 if absent)
+    never share a row: with ``num_proc`` given only records of that count are
+    used, otherwise those of the largest count recorded for the task.
+    """
+    perf_stats: dict[str, dict] = {}
+    # (task, num_proc) -> {type: (requested size, time)} of the records kept
+    runs: dict[tuple[str, int], dict[str, tuple[int, str]]] = {}
+    if not perf_records_path.exists():
+        logger.warning("Perf records not found at %s", perf_records_path)
+        return perf_stats
+
+    with open(perf_records_path, "r") as records_file:
+        for line in records_file:
+            line = line.strip()
+            if not line:
+                continue
+            record = json.loads(line)
+            if record.get("type_of_running") != perf_type:
+                continue
+            task_name = record.get("task_namespace")
+            task_type = record.get("type_of_task")
+            if not task_name or task_type not in columns:
+                continue
+            record_num_proc = int(record.get("num_proc", 1))
+            if num_proc is not None and record_num_proc != num_proc:
+                continue
+            requested_size = int(record.get("requested_size", 0))
+            times = runs.setdefault((task_name, record_num_proc), {})
+            if requested_size < times.get(task_type, (0, missing))[0]:
+                continue
+            times[task_type] = (requested_size, str(record.get("time_sec", missing)))
+
+    for task_name, record_num_proc in sorted(runs):
+        # Sorted by count, so the largest count of the task is written last
+        entry = {c: missing for c in columns}
+        for task_type, (_, time_sec) in runs[(task_name, record_num_proc)].items():
+            entry[task_type] = time_sec
+        perf_stats[task_name] = entry
+    return perf_stats
+
+
 def load_performance_data_threads(perf_stat_file_path: Path) -> dict:
-    """Load threads performance ratios (T_x/T_seq) from CSV.
+    """Load threads performance times in seconds from CSV.
     Expected header: Task, SEQ, OMP, TBB, STL, ALL
     """
+    if perf_stat_file_path.suffix == ".jsonl":
+        # Thread-level implementations run in one process, ALL with the process count of the MPI runs
+        single = load_performance_records(
+            perf_stat_file_path, task_types_threads, num_proc=1
+        )
+        hybrid = load_performance_records(perf_stat_file_path, ["all"])
+        merged: dict[str, dict] = {}
+        for task_name in sorted(single.keys() | hybrid.keys()):
+            row = single.get(task_name, {t: "?" for t in task_types_threads})
+            row["all"] = hybrid.get(task_name, {}).get("all", "?")
+            merged[task_name] = row
+        return merged
     perf_stats: dict[str, dict] = {}
     if perf_stat_file_path.exists():
         with open(perf_stat_file_path, "r", newline="") as csvfile:
@@ -159,6 +224,10 @@ def load_performance_data(perf_stat_file_path: Path) -> dict:
     Always returns a mapping: task -> {seq, omp, stl, tbb, all, mpi}
     Missing columns are filled with ``"N/A"``; empty cells stay empty strings.
     """
+    if perf_stat_file_path.suffix == ".jsonl":
+        return load_performance_records(
+            perf_stat_file_path, ["seq", "omp", "stl", "tbb", "all", "mpi"], "N/A"
+        )
     perf_stats: dict[str, dict] = {}
     if not perf_stat_file_path.exists():
         return perf_stats
@@ -193,6 +262,8 @@ def load_performance_data_processes(perf_stat_file_path: Path) -> dict:
     Expected header: Task, SEQ, MPI with absolute times. If the CSV contains
     split rows like <task>_seq and <task>_mpi, they are combined into one entry.
     """
+    if perf_stat_file_path.suffix == ".jsonl":
+        return load_performance_records(perf_stat_file_path, task_types_processes)
     perf_stats: dict[str, dict] = {}
     if not perf_stat_file_path.exists():
         logger.warning("Processes perf stats CSV not found at %s", perf_stat_file_path)
@@ -600,10 +671,12 @@ def _build_rows_for_task_types(
             task_points += plagiarism_points
 
             perf_val = perf_stats.get(dir, {}).get(task_type, "?")
+            # Perf records and tables hold raw times: speedup is relative to seq time
+            seq_val = perf_stats.get(dir, {}).get("seq")
 
             # Calculate acceleration and efficiency if performance data is available
             acceleration, efficiency = calculate_performance_metrics(
-                perf_val, eff_num_proc, task_type
+                perf_val, eff_num_proc, task_type, seq_val=seq_val
             )
 
             # Calculate deadline penalty points
@@ -781,8 +854,12 @@ def main():
         ds = _evenly_spaced_dates(n_items, s, e)
         return ds
 
-    # Locate perf CSVs from CI or local runs (threads and processes)
-    candidates_threads = [
+    # Locate perf records or CSVs from CI or local runs (threads and processes)
+    candidates_records = [
+        script_dir.parent / "build" / "perf_stat_dir" / "perf_results.jsonl",
+        script_dir.parent / "perf_stat_dir" / "perf_results.jsonl",
+    ]
+    candidates_threads = candidates_records + [
         script_dir.parent
         / "build"
         / "perf_stat_dir"
@@ -796,7 +873,7 @@ def main():
         (p for p in candidates_threads if p.exists()), candidates_threads[0]
     )
 
-    candidates_processes = [
+    candidates_processes = candidates_records + [
         script_dir.parent
         / "build"
         / "perf_stat_dir"
@@ -819,7 +896,7 @@ def main():
         import re
 
         perf_stats_local = dict(base)
-        if not perf_stat_file_path.exists():
+        if not perf_stat_file_path.exists() or perf_stat_file_path.suffix == ".jsonl":
             return perf_stats_local
         with open(perf_stat_file_path, "r", newline="") as csvfile:
             reader = csv.DictReader(csvfile)
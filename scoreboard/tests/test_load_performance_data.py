@@ -3,7 +3,12 @@ Tests for the load_performance_data function.
 """
 
 import csv
-from main import load_performance_data
+import json
+from main import (
+    load_performance_data,
+    load_performance_data_processes,
+    load_performance_data_threads,
+)
 
 
 class TestLoadPerformanceData:
@@ -142,3 +147,94 @@ class TestLoadPerformanceData:
         assert task_data["tbb"] == ""
         assert task_data["all"] == "N/A"
         assert task_data["mpi"] == "N/A"
+
+    def test_load_performance_data_jsonl_records(self, temp_dir):
+        """Test loading performance data from JSON Lines perf records."""
+        records_file = temp_dir / "perf_results.jsonl"
+
+        records = [
+            {
+                "task_namespace": "example_task",
+                "type_of_task": "seq",
+                "type_of_running": "task_run",
+                "time_sec": 1.0,
+            },
+            {
+                "task_namespace": "example_task",
+                "type_of_task": "mpi",
+                "type_of_running": "task_run",
+                "time_sec": 0.25,
+            },
+            # Pipeline records must not override task_run values
+            {
+                "task_namespace": "example_task",
+                "type_of_task": "seq",
+                "type_of_running": "pipeline",
+                "time_sec": 9.0,
+            },
+        ]
+        with open(records_file, "w") as f:
+            for record in records:
+                f.write(json.dumps(record) + "\n")
+
+        result = load_performance_data(records_file)
+
+        assert list(result.keys()) == ["example_task"]
+        task_data = result["example_task"]
+        assert task_data["seq"] == "1.0"
+        assert task_data["mpi"] == "0.25"
+        assert task_data["omp"] == "N/A"
+
+    def test_load_performance_data_jsonl_prefers_largest_size(self, temp_dir):
+        """Size-parameterised records: the largest requested size is reported."""
+        records_file = temp_dir / "perf_results.jsonl"
+
+        records = [
+            {
+                "task_namespace": "example_task",
+                "type_of_task": "seq",
+                "type_of_running": "task_run",
+                "requested_size": size,
+                "time_sec": time_sec,
+            }
+            for size, time_sec in [(1000, 0.5), (1000000, 2.0), (10000, 1.0)]
+        ]
+        with open(records_file, "w") as f:
+            for record in records:
+                f.write(json.dumps(record) + "\n")
+
+        result = load_performance_data(records_file)
+
+        assert result["example_task"]["seq"] == "2.0"
+
+    def test_load_performance_data_jsonl_keeps_process_counts_apart(self, temp_dir):
+        """Records of runs with different process counts never share a row."""
+        records_file = temp_dir / "perf_results.jsonl"
+
+        records = [
+            {
+                "task_namespace": "example_task",
+                "type_of_task": task_type,
+                "type_of_running": "task_run",
+                "num_proc": num_proc,
+                "time_sec": time_sec,
+            }
+            for task_type, num_proc, time_sec in [
+                ("seq", 4, 1.0),
+                ("mpi", 4, 0.25),
+                ("seq", 1, 0.9),
+                ("omp", 1, 0.3),
+                ("mpi", 2, 0.5),
+            ]
+        ]
+        with open(records_file, "w") as f:
+            for record in records:
+                f.write(json.dumps(record) + "\n")
+
+        processes = load_performance_data_processes(records_file)
+        threads = load_performance_data_threads(records_file)
+
+        assert processes["example_task"] == {"mpi": "0.25", "seq": "1.0"}
+        assert threads["example_task"]["seq"] == "0.9"
+        assert threads["example_task"]["omp"] == "0.3"
+        assert threads["example_task"]["all"] == "?"
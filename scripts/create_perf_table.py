@@ -1,4 +1,5 @@
 import argparse
+import json
 import os
 import re
 import xlsxwriter
@@ -21,7 +22,7 @@ NEW_PATTERN = re.compile(
 #   example_processes_2_mpi_enabled:pipeline:0.0507
 # Accept optional suffix after `_enabled` (e.g., `_enabled_size1000000`) before the colon
 SIMPLE_PATTERN = re.compile(
-    r"(.+?)_(omp|seq|tbb|stl|all|mpi)_enabled[^:]*:(task_run|pipeline):(-*\d*\.\d*)"
+    r"(.+?)_(omp|seq|tbb|stl|all|mpi)_enabled[^:]*:(task_run|pipeline|warm):(-*\d*\.\d*)"
 )
 
 
@@ -128,9 +129,23 @@ def _write_csv(path: str, header: list[str], tasks_list: list[str], table: dict)
             writer.writerow(row)
 
 
+def _read_json_records(path: str) -> list[dict]:
+    """Read JSON Lines perf records written by the C++ perf harness (PPC_PERF_OUTPUT)."""
+    records = []
+    with open(path, "r") as records_file:
+        for line in records_file:
+            line = line.strip()
+            if line:
+                records.append(json.loads(line))
+    return records
+
+
 parser = argparse.ArgumentParser()
 parser.add_argument(
-    "-i", "--input", help="Input file path (logs of perf tests, .txt)", required=True
+    "-i",
+    "--input",
+    help="Input file path (logs of perf tests, .txt, or perf records, .jsonl)",
+    required=True,
 )
 parser.add_argument(
     "-o", "--output", help="Output file path (path to .xlsx table)", required=True
@@ -139,15 +154,40 @@ args = parser.parse_args()
 logs_path = os.path.abspath(args.input)
 xlsx_path = os.path.abspath(args.output)
 
-# For each perf_type (pipeline/task_run) store times per task
+# For each perf_type (pipeline/task_run/warm) store times per task
 result_tables = {"pipeline": {}, "task_run": {}}
 # Map task name -> category (threads|processes)
 task_categories = {}
 # Track tasks per category to split output
 tasks_by_category = {"threads": set(), "processes": set()}
-
-with open(logs_path, "r") as logs_file:
-    logs_lines = logs_file.readlines()
+# Achieved fraction of the roofline bound per perf_type/task/type (JSON records only)
+roofline_tables = {}
+
+if logs_path.endswith(".jsonl"):
+    # Structured records carry namespace/type/mode explicitly: no log scraping needed
+    logs_lines = []
+    for record in _read_json_records(logs_path):
+        task_name = record["task_namespace"]
+        task_category = _infer_category(task_name)
+        # Size-parameterised tests get one row per input size
+        requested_size = int(record.get("requested_size", 0))
+        if requested_size > 0:
+            task_name = f"{task_name}_size{requested_size}"
+        perf_type = record["type_of_running"]
+        _ensure_task_tables(result_tables, perf_type, task_name)
+        result_tables[perf_type][task_name][record["type_of_task"]] = float(
+            record["time_sec"]
+        )
+        roofline_fraction = (record.get("throughput") or {}).get("roofline_fraction")
+        if roofline_fraction is not None:
+            roofline_tables.setdefault(perf_type, {}).setdefault(task_name, {})[
+                record["type_of_task"]
+            ] = float(roofline_fraction)
+        task_categories[task_name] = task_category
+        tasks_by_category[task_category].add(task_name)
+else:
+    with open(logs_path, "r") as logs_file:
+        logs_lines = logs_file.readlines()
 for line in logs_lines:
     # Handle both old format: tasks/task_type/task_name:perf_type:time
     # and new format: namespace_task_type_enabled:perf_type:time
@@ -283,3 +323,18 @@ for table_name, table_data in result_tables.items():
             xlsx_path, f"{category}_" + table_name + "_perf_table.csv"
         )
         _write_csv(csv_path, header, tasks_list, table_data)
+
+        # Roofline: fraction of achievable hardware throughput instead of assumed linear scaling
+        roofline_table = roofline_tables.get(table_name, {})
+        if any(task_name in roofline_table for task_name in tasks_list):
+            roofline_path = os.path.join(
+                xlsx_path, f"{category}_" + table_name + "_roofline_table.csv"
+            )
+            with open(roofline_path, "w", newline="") as csvfile:
+                writer = csv.writer(csvfile)
+                writer.writerow(["Task"] + [c.upper() for c in cols])
+                for task_name in tasks_list:
+                    task_row = roofline_table.get(task_name, {})
+                    writer.writerow(
+                        [task_name] + [task_row.get(c, "?") for c in cols]
+                    )
@@ -0,0 +1,143 @@
+import argparse
+import csv
+import json
+import os
+
+# Columns of the produced scaling curves; missing values are empty cells
+HEADER = [
+    "Task",
+    "Size",
+    "Type",
+    "NumProc",
+    "NumThreads",
+    "Workers",
+    "SizeScale",
+    "Time",
+    "Speedup",
+    "Efficiency",
+    "SpeedupVsSeq",
+]
+
+
+def _workers(record: dict) -> int:
+    """Number of workers an implementation actually uses at a grid point."""
+    task_type = record["type_of_task"]
+    num_proc = int(record.get("num_proc", 1))
+    num_threads = int(record.get("num_threads", 1))
+    if task_type == "seq":
+        return 1
+    if task_type == "mpi":
+        return num_proc
+    if task_type == "all":
+        return num_proc * num_threads
+    return num_threads
+
+
+def _read_records(path: str) -> list[dict]:
+    records = []
+    with open(path, "r") as records_file:
+        for line in records_file:
+            line = line.strip()
+            if line:
+                records.append(json.loads(line))
+    return records
+
+
+def build_curves(records: list[dict], scaling: str) -> dict[str, list[list]]:
+    """Group records into per-task curves: perf_type -> rows (see HEADER).
+
+    Strong scaling: Speedup = T(base) / T(w) relative to the smallest worker count
+    of the same implementation, Efficiency = Speedup * w_base / w.
+    Weak scaling: Efficiency = T(base) / T(w) (ideal 1.0), Speedup is the scaled
+    speedup Efficiency * w / w_base. SpeedupVsSeq = T(seq) / T(w) at the same grid
+    point; weak sweeps run seq on the unscaled input only, so their curves have no
+    SpeedupVsSeq column (see header_for).
+    """
+    # (perf_type, task, size, type) -> {(num_proc, num_threads, size_scale): record}
+    # size is the unscaled requested input size of size-parameterised tests (0 otherwise)
+    points: dict[tuple, dict] = {}
+    for record in records:
+        size_scale = max(int(record.get("size_scale", 1)), 1)
+        key = (
+            record["type_of_running"],
+            record["task_namespace"],
+            int(record.get("requested_size", 0)) // size_scale,
+            record["type_of_task"],
+        )
+        grid = (
+            int(record.get("num_proc", 1)),
+            int(record.get("num_threads", 1)),
+            int(record.get("size_scale", 1)),
+        )
+        points.setdefault(key, {})[grid] = record
+
+    curves: dict[str, list[list]] = {}
+    for (perf_type, task_name, size, task_type), grid_points in sorted(points.items()):
+        ordered = sorted(grid_points.items(), key=lambda kv: (_workers(kv[1]), kv[0]))
+        base = ordered[0][1]
+        base_time = float(base["time_sec"])
+        base_workers = _workers(base)
+        seq_points = points.get((perf_type, task_name, size, "seq"), {})
+        for grid, record in ordered:
+            time_sec = float(record["time_sec"])
+            workers = _workers(record)
+            speedup = efficiency = speedup_vs_seq = ""
+            if time_sec > 0 and base_time > 0:
+                ratio = base_time / time_sec
+                if scaling == "weak":
+                    efficiency = ratio
+                    speedup = ratio * workers / base_workers
+                else:
+                    speedup = ratio
+                    efficiency = ratio * base_workers / workers
+            seq_record = seq_points.get(grid)
+            if seq_record is not None and time_sec > 0:
+                speedup_vs_seq = float(seq_record["time_sec"]) / time_sec
+            row = [
+                task_name,
+                size,
+                task_type,
+                grid[0],
+                grid[1],
+                workers,
+                grid[2],
+                time_sec,
+                speedup,
+                efficiency,
+            ]
+            if scaling != "weak":
+                row.append(speedup_vs_seq)
+            curves.setdefault(perf_type, []).append(row)
+    return curves
+
+
+def header_for(scaling: str) -> list[str]:
+    """Columns of the curves of a sweep kind."""
+    if scaling == "weak":
+        return [column for column in HEADER if column != "SpeedupVsSeq"]
+    return HEADER
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "-i", "--input", help="Perf records (.jsonl) of a scaling sweep", required=True
+    )
+    parser.add_argument(
+        "-o", "--output", help="Output directory for the CSV curves", required=True
+    )
+    parser.add_argument(
+        "--scaling", choices=["strong", "weak"], default="strong", help="Sweep kind"
+    )
+    args = parser.parse_args()
+
+    curves = build_curves(_read_records(os.path.abspath(args.input)), args.scaling)
+    for perf_type, rows in curves.items():
+        csv_path = os.path.join(
+            os.path.abspath(args.output), f"{args.scaling}_scaling_{perf_type}.csv"
+        )
+        with open(csv_path, "w", newline="") as csvfile:
+            writer = csv.writer(csvfile)
+            writer.writerow(header_for(args.scaling))
+            writer.writerows(rows)
+        print(f"Scaling curves ({perf_type}) written to {csv_path}")
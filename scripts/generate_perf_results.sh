@@ -2,5 +2,8 @@
 set -euo pipefail
 
 mkdir -p build/perf_stat_dir
+rm -f build/perf_stat_dir/perf_results.jsonl
+PPC_PERF_OUTPUT="$(pwd)/build/perf_stat_dir/perf_results.jsonl"
+export PPC_PERF_OUTPUT
 scripts/run_tests.py --running-type="performance" | tee build/perf_stat_dir/perf_log.txt
-python3 scripts/create_perf_table.py --input build/perf_stat_dir/perf_log.txt --output build/perf_stat_dir
+python3 scripts/create_perf_table.py --input build/perf_stat_dir/perf_results.jsonl --output build/perf_stat_dir
@@ -4,6 +4,7 @@ import os
 import shlex
 import subprocess
 import platform
+import sys
 from pathlib import Path
 
 
@@ -14,8 +15,10 @@ def init_cmd_args():
     parser.add_argument(
         "--running-type",
         required=True,
-        choices=["threads", "processes", "performance"],
-        help="Specify the execution mode. Choose 'threads' for multithreading or 'processes' for multiprocessing.",
+        choices=["threads", "processes", "performance", "calibration"],
+        help="Specify the execution mode. Choose 'threads' for multithreading or 'processes' for multiprocessing. "
+        "'calibration' measures memory bandwidth, peak FLOPs and MPI latency/bandwidth of this host and "
+        "caches them for roofline metrics.",
     )
     parser.add_argument(
         "--additional-mpi-args",
@@ -29,6 +32,35 @@ def init_cmd_args():
         type=int,
         help="List of process/thread counts to run sequentially",
     )
+    parser.add_argument(
+        "--scaling",
+        choices=["strong", "weak"],
+        help="Performance mode only: sweep the process/thread grid given by "
+        "--proc-counts and --thread-counts. 'weak' also scales the problem size "
+        "of each implementation with the number of workers it uses via "
+        "PPC_PERF_SIZE_SCALE (seq: 1, mpi: processes, all: processes * threads, "
+        "others: threads).",
+    )
+    parser.add_argument(
+        "--proc-counts",
+        nargs="+",
+        type=int,
+        default=[1],
+        help="Process counts (PPC_NUM_PROC) of the scaling grid",
+    )
+    parser.add_argument(
+        "--thread-counts",
+        nargs="+",
+        type=int,
+        default=[1],
+        help="Thread counts (PPC_NUM_THREADS) of the scaling grid",
+    )
+    parser.add_argument(
+        "--scaling-output",
+        default=None,
+        help="Directory for scaling records and curves "
+        "(default: build/perf_stat_dir/scaling)",
+    )
     parser.add_argument(
         "--verbose", action="store_true", help="Print commands executed by the script"
     )
@@ -44,6 +76,8 @@ class PPCRunner:
         self.__ppc_env = None
         self.work_dir = None
         self.verbose = verbose
+        # Weak scaling: grow the input of each implementation with the workers it uses
+        self.weak_scaling = False
 
         self.valgrind_cmd = (
             "valgrind --error-exitcode=1 --leak-check=full --show-leak-kinds=all"
@@ -71,6 +105,20 @@ class PPCRunner:
         script_dir = script_path.parent  # Directory containing the script
         return script_dir.parent
 
+    @staticmethod
+    def __get_git_sha():
+        try:
+            proc = subprocess.run(
+                ["git", "rev-parse", "HEAD"],
+                cwd=PPCRunner.__get_project_path(),
+                stdout=subprocess.PIPE,
+                stderr=subprocess.DEVNULL,
+                text=True,
+            )
+        except Exception:
+            return "unknown"
+        return proc.stdout.strip() if proc.returncode == 0 else "unknown"
+
     def setup_env(self, ppc_env):
         self.__ppc_env = ppc_env
 
@@ -87,6 +135,10 @@ class PPCRunner:
                 "Required environment variable 'PPC_NUM_PROC' is not set."
             )
 
+        # Commit id recorded in structured perf results (see PPC_PERF_OUTPUT)
+        if not self.__ppc_env.get("PPC_GIT_SHA"):
+            self.__ppc_env["PPC_GIT_SHA"] = self.__get_git_sha()
+
         if (Path(self.__get_project_path()) / "install").exists():
             self.work_dir = Path(self.__get_project_path()) / "install" / "bin"
         else:
@@ -133,6 +185,17 @@ class PPCRunner:
 
     def __build_mpi_cmd(self, ppc_num_proc, additional_mpi_args):
         base = [self.mpi_exec] + shlex.split(additional_mpi_args)
+        # Optional variables are forwarded only when set
+        forwarded = [
+            var
+            for var in [
+                "PPC_PERF_OUTPUT",
+                "PPC_GIT_SHA",
+                "PPC_CALIBRATION_DIR",
+                "PPC_PERF_SIZE_SCALE",
+            ]
+            if self.__ppc_env.get(var)
+        ]
 
         if self.platform == "Windows":
             # MS-MPI style
@@ -144,6 +207,8 @@ class PPCRunner:
                 "OMP_NUM_THREADS",
                 self.__ppc_env["OMP_NUM_THREADS"],
             ]
+            for var in forwarded:
+                env_args += ["-env", var, self.__ppc_env[var]]
             np_args = ["-n", ppc_num_proc]
             return base + env_args + np_args
 
@@ -155,6 +220,8 @@ class PPCRunner:
                 "-x",
                 "OMP_NUM_THREADS",
             ]
+            for var in forwarded:
+                env_args += ["-x", var]
             np_flag = "-np"
         elif self.mpi_env_mode == "mpich":
             # Explicitly set env variables for all ranks
@@ -166,6 +233,8 @@ class PPCRunner:
                 "OMP_NUM_THREADS",
                 self.__ppc_env["OMP_NUM_THREADS"],
             ]
+            for var in forwarded:
+                env_args += ["-env", var, self.__ppc_env[var]]
             np_flag = "-n"
         else:
             # Unknown MPI flavor: rely on environment inheritance and default to -np
@@ -227,12 +296,33 @@ class PPCRunner:
                     + [str(self.work_dir / "ppc_func_tests")]
                     + self.__get_gtest_settings(1, "_" + task_type + "_")
                 )
+            # Core tests of the MPI helpers; they skip themselves outside of mpirun
+            self.__run_exec(
+                mpi_running
+                + [str(self.work_dir / "core_func_tests")]
+                + self.__get_gtest_settings(1, "MpiTest")
+            )
+
+    def __get_workers(self, task_type):
+        """Number of workers an implementation uses (see create_scaling_table.py)."""
+        if task_type == "seq":
+            return 1
+        if task_type == "mpi":
+            return int(self.__ppc_num_proc)
+        if task_type == "all":
+            return int(self.__ppc_num_proc) * int(self.__ppc_num_threads)
+        return int(self.__ppc_num_threads)
+
+    def __set_size_scale(self, task_type):
+        if self.weak_scaling:
+            self.__ppc_env["PPC_PERF_SIZE_SCALE"] = str(self.__get_workers(task_type))
 
     def run_performance(self):
         if not self.__ppc_env.get("PPC_ASAN_RUN"):
-            mpi_running = self.__build_mpi_cmd(self.__ppc_num_proc, "")
             # Collect perf stats for all implementations, including seq as baseline.
             for task_type in ["all", "mpi", "seq"]:
+                self.__set_size_scale(task_type)
+                mpi_running = self.__build_mpi_cmd(self.__ppc_num_proc, "")
                 self.__run_exec(
                     mpi_running
                     + [str(self.work_dir / "ppc_perf_tests")]
@@ -240,15 +330,22 @@ class PPCRunner:
                 )
 
         for task_type in ["omp", "seq", "stl", "tbb"]:
+            self.__set_size_scale(task_type)
             self.__run_exec(
                 [str(self.work_dir / "ppc_perf_tests")]
                 + self.__get_gtest_settings(1, "_" + task_type + "_")
             )
 
+    def run_calibration(self):
+        # Network measurements need at least two ranks
+        mpi_running = self.__build_mpi_cmd(self.__ppc_num_proc, "")
+        self.__run_exec(mpi_running + [str(self.work_dir / "ppc_calibration")])
+
 
 def _execute(args_dict, env):
     runner = PPCRunner(verbose=args_dict.get("verbose", False))
     runner.setup_env(env)
+    runner.weak_scaling = args_dict.get("scaling") == "weak"
 
     if args_dict["running_type"] in ["threads", "processes"]:
         runner.run_core()
@@ -259,15 +356,63 @@ def _execute(args_dict, env):
         runner.run_processes(args_dict["additional_mpi_args"])
     elif args_dict["running_type"] == "performance":
         runner.run_performance()
+    elif args_dict["running_type"] == "calibration":
+        runner.run_calibration()
     else:
         raise Exception("running-type is wrong!")
 
 
+def _execute_scaling(args_dict):
+    if args_dict["running_type"] != "performance":
+        raise Exception("--scaling is only supported with --running-type=performance")
+
+    project_path = Path(__file__).resolve().parent.parent
+    default_out_dir = project_path / "build" / "perf_stat_dir" / "scaling"
+    out_dir = Path(args_dict["scaling_output"] or default_out_dir)
+    out_dir.mkdir(parents=True, exist_ok=True)
+    records_path = out_dir / f"{args_dict['scaling']}_scaling_results.jsonl"
+    if records_path.exists():
+        records_path.unlink()
+
+    for num_proc in args_dict["proc_counts"]:
+        for num_threads in args_dict["thread_counts"]:
+            env_copy = os.environ.copy()
+            env_copy["PPC_NUM_PROC"] = str(num_proc)
+            env_copy["PPC_NUM_THREADS"] = str(num_threads)
+            env_copy["PPC_PERF_OUTPUT"] = str(records_path)
+            # Weak scaling sets it per implementation (PPCRunner.weak_scaling)
+            env_copy.pop("PPC_PERF_SIZE_SCALE", None)
+
+            print(
+                f"Executing {args_dict['scaling']} scaling point: "
+                f"processes={num_proc} threads={num_threads}",
+                flush=True,
+            )
+            _execute(args_dict, env_copy)
+
+    table_script = project_path / "scripts" / "create_scaling_table.py"
+    subprocess.run(
+        [
+            sys.executable,
+            str(table_script),
+            "--input",
+            str(records_path),
+            "--output",
+            str(out_dir),
+            "--scaling",
+            args_dict["scaling"],
+        ],
+        check=True,
+    )
+
+
 if __name__ == "__main__":
     args_dict = init_cmd_args()
     counts = args_dict.get("counts")
 
-    if counts:
+    if args_dict.get("scaling"):
+        _execute_scaling(args_dict)
+    elif counts:
         for count in counts:
             env_copy = os.environ.copy()
 
@@ -8,10 +8,13 @@
 #include <vector>
 
 #include "akimov_i_words_string_count/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace akimov_i_words_string_count {
 
 namespace {
+const ppc::task::TaskRegistration<AkimovIWordsStringCountMPI> kRegistration;
+
 
 inline bool IsSpaceChar(char ch) {
   return ch == ' ' || ch == '\n' || ch == '\t';
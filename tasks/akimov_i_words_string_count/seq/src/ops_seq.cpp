@@ -3,9 +3,14 @@
 #include <cctype>
 
 #include "akimov_i_words_string_count/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace akimov_i_words_string_count {
 
+namespace {
+const ppc::task::TaskRegistration<AkimovIWordsStringCountSEQ> kRegistration;
+}  // namespace
+
 AkimovIWordsStringCountSEQ::AkimovIWordsStringCountSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <span>
+
 #include "ashihmin_d_sum_of_elem/common/include/common.hpp"
 #include "task/include/task.hpp"
 
@@ -12,6 +14,9 @@ class AshihminDElemVecsSumMPI : public BaseTask {
   }
   explicit AshihminDElemVecsSumMPI(const InType &in);
 
+  /// @brief Sums every vector of a batch with one Scatterv and one Allreduce in total.
+  static bool RunBatch(std::span<AshihminDElemVecsSumMPI *const> batch);
+
  private:
   bool ValidationImpl() override;
   bool PreProcessingImpl() override;
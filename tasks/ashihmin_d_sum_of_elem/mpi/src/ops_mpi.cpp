@@ -3,12 +3,19 @@
 #include <mpi.h>
 
 #include <cstddef>
+#include <span>
 #include <vector>
 
 #include "ashihmin_d_sum_of_elem/common/include/common.hpp"
+#include "dist/include/block_range.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace ashihmin_d_sum_of_elem {
 
+namespace {
+const ppc::task::TaskRegistration<AshihminDElemVecsSumMPI> kRegistration;
+}  // namespace
+
 AshihminDElemVecsSumMPI::AshihminDElemVecsSumMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -66,6 +73,64 @@ bool AshihminDElemVecsSumMPI::RunImpl() {
   return true;
 }
 
+bool AshihminDElemVecsSumMPI::RunBatch(std::span<AshihminDElemVecsSumMPI *const> batch) {
+  int size = 0;
+  int rank = 0;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  // Every rank gets the same block of each vector as in RunImpl(), packed in batch order
+  auto block_of = [size](AshihminDElemVecsSumMPI *task, int proc) {
+    return ppc::dist::GetBlockRange(task->GetInput().size(), size, proc);
+  };
+
+  std::vector<int> counts(size, 0);
+  std::vector<int> displs(size, 0);
+  for (int proc = 0; proc < size; ++proc) {
+    for (auto *task : batch) {
+      counts[proc] += static_cast<int>(block_of(task, proc).count);
+    }
+    if (proc > 0) {
+      displs[proc] = displs[proc - 1] + counts[proc - 1];
+    }
+  }
+
+  std::vector<int> packed;
+  if (rank == 0) {
+    packed.reserve(static_cast<size_t>(displs[size - 1] + counts[size - 1]));
+    for (int proc = 0; proc < size; ++proc) {
+      for (auto *task : batch) {
+        const auto block = block_of(task, proc);
+        const auto first = task->GetInput().begin() + static_cast<std::ptrdiff_t>(block.begin);
+        packed.insert(packed.end(), first, first + static_cast<std::ptrdiff_t>(block.count));
+      }
+    }
+  }
+
+  std::vector<int> local(counts[rank]);
+  MPI_Scatterv(packed.data(), counts.data(), displs.data(), MPI_INT, local.data(), counts[rank], MPI_INT, 0,
+               MPI_COMM_WORLD);
+
+  std::vector<OutType> local_sums(batch.size(), 0);
+  size_t offset = 0;
+  for (size_t i = 0; i < batch.size(); ++i) {
+    const size_t count = block_of(batch[i], rank).count;
+    for (size_t j = 0; j < count; ++j) {
+      local_sums[i] += local[offset + j];
+    }
+    offset += count;
+  }
+
+  std::vector<OutType> global_sums(batch.size(), 0);
+  MPI_Allreduce(local_sums.data(), global_sums.data(), static_cast<int>(batch.size()), MPI_LONG_LONG, MPI_SUM,
+                MPI_COMM_WORLD);
+
+  for (size_t i = 0; i < batch.size(); ++i) {
+    batch[i]->GetOutput() = global_sums[i];
+  }
+  return true;
+}
+
 bool AshihminDElemVecsSumMPI::PostProcessingImpl() {
   return true;
 }
@@ -1,9 +1,14 @@
 #include "ashihmin_d_sum_of_elem/seq/include/ops_seq.hpp"
 
 #include "ashihmin_d_sum_of_elem/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace ashihmin_d_sum_of_elem {
 
+namespace {
+const ppc::task::TaskRegistration<AshihminDElemVecsSumSEQ> kRegistration;
+}  // namespace
+
 AshihminDElemVecsSumSEQ::AshihminDElemVecsSumSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
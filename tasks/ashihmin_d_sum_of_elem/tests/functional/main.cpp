@@ -2,9 +2,11 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cstddef>
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "ashihmin_d_sum_of_elem/common/include/common.hpp"
 #include "ashihmin_d_sum_of_elem/mpi/include/ops_mpi.hpp"
@@ -37,6 +39,44 @@ class AshihminDElemVecSumFuncTest : public ppc::util::BaseRunFuncTests<InType, O
   InType input_data_;
 };
 
+class AshihminDElemVecSumBatchFuncTest
+    : public ppc::util::BaseRunFuncTests<std::vector<InType>, std::vector<OutType>, TestType> {
+ public:
+  static std::string PrintTestParam(const TestType &param) {
+    return std::to_string(std::get<0>(param)) + "_" + std::get<1>(param);
+  }
+
+ protected:
+  void SetUp() override {
+    // Vectors of lengths 1..batch_size, so that some of them are shorter than the number of processes
+    int batch_size = std::get<0>(std::get<2>(GetParam()));
+    input_data_.clear();
+    for (int len = 1; len <= batch_size; ++len) {
+      input_data_.emplace_back(len, len);
+    }
+  }
+
+  bool CheckTestOutputData(std::vector<OutType> &output_data) final {
+    if (output_data.size() != input_data_.size()) {
+      return false;
+    }
+    for (std::size_t i = 0; i < output_data.size(); ++i) {
+      const auto len = static_cast<OutType>(input_data_[i].size());
+      if (output_data[i] != len * len) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::vector<InType> GetTestInputData() final {
+    return input_data_;
+  }
+
+ private:
+  std::vector<InType> input_data_;
+};
+
 namespace {
 
 TEST_P(AshihminDElemVecSumFuncTest, RunTests) {
@@ -55,5 +95,20 @@ const auto kPerfTestName = AshihminDElemVecSumFuncTest::PrintFuncTestName<Ashihm
 
 INSTANTIATE_TEST_SUITE_P(PicMatrixTests, AshihminDElemVecSumFuncTest, kGtestValues, kPerfTestName);
 
+TEST_P(AshihminDElemVecSumBatchFuncTest, RunBatchTests) {
+  ExecuteTest(GetParam());
+}
+
+const auto kBatchTestTasksList =
+    std::tuple_cat(ppc::util::AddBatchFuncTask<AshihminDElemVecsSumMPI>(kParams, PPC_SETTINGS_ashihmin_d_sum_of_elem),
+                   ppc::util::AddBatchFuncTask<AshihminDElemVecsSumSEQ>(kParams, PPC_SETTINGS_ashihmin_d_sum_of_elem));
+
+const auto kBatchGtestValues = ppc::util::ExpandToValues(kBatchTestTasksList);
+
+const auto kBatchTestName =
+    AshihminDElemVecSumBatchFuncTest::PrintFuncTestName<AshihminDElemVecSumBatchFuncTest>;
+
+INSTANTIATE_TEST_SUITE_P(BatchTests, AshihminDElemVecSumBatchFuncTest, kBatchGtestValues, kBatchTestName);
+
 }  // namespace
 }  // namespace ashihmin_d_sum_of_elem
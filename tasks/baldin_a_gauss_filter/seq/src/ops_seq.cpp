@@ -7,9 +7,14 @@
 #include <vector>
 
 #include "baldin_a_gauss_filter/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace baldin_a_gauss_filter {
 
+namespace {
+const ppc::task::TaskRegistration<BaldinAGaussFilterSEQ> kRegistration;
+}  // namespace
+
 BaldinAGaussFilterSEQ::BaldinAGaussFilterSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
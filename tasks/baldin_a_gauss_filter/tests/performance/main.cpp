@@ -4,34 +4,24 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
-#include <random>
 #include <vector>
 
 #include "baldin_a_gauss_filter/common/include/common.hpp"
 #include "baldin_a_gauss_filter/mpi/include/ops_mpi.hpp"
 #include "baldin_a_gauss_filter/seq/include/ops_seq.hpp"
+#include "util/include/datagen.hpp"
 #include "util/include/perf_test_util.hpp"
 
 namespace baldin_a_gauss_filter {
 
 namespace {
 
-ImageData GetRandomImage(int width, int height) {
+ImageData GetRandomImage(int width, int height, std::uint64_t seed) {
   ImageData data;
   data.width = width;
   data.height = height;
   data.channels = 3;
-
-  size_t size = static_cast<size_t>(width) * height * 3;
-  data.pixels.resize(size);
-
-  auto seed = static_cast<unsigned int>(width + height + 3);
-  std::mt19937 gen(seed);
-
-  for (size_t i = 0; i < size; ++i) {
-    data.pixels[i] = static_cast<uint8_t>(gen() % 256);
-  }
-
+  data.pixels = ppc::util::datagen::ImagePixels(seed, width, height, 3);
   return data;
 }
 
@@ -75,7 +65,7 @@ class BaldinAGaussFilterPerfTests : public ppc::util::BaseRunPerfTests<InType, O
     const int width = 3000;
     const int height = 3000;
 
-    input_data_ = GetRandomImage(width, height);
+    input_data_ = GetRandomImage(width, height, GetDataSeed());
     expected_output_ = CalculateGaussFilter(input_data_);
   }
 
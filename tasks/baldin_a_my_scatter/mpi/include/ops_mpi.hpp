@@ -1,5 +1,9 @@
 #pragma once
 
+#include <mpi.h>
+
+#include <cstddef>
+
 #include "baldin_a_my_scatter/common/include/common.hpp"
 #include "task/include/task.hpp"
 
@@ -17,6 +21,11 @@ class BaldinAMyScatterMPI : public BaseTask {
   bool PreProcessingImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+
+  // root посылает каждому процессу его долю напрямую; для больших долей
+  void ScatterLinear(int rank, int size, std::size_t block_bytes);
+  // Биномиальное дерево с разбиением поддеревьев на сегменты, пересылаемые конвейером
+  void ScatterBinomial(int rank, int size, MPI_Aint extent);
 };
 
 }  // namespace baldin_a_my_scatter
@@ -5,12 +5,17 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
-#include <vector>
+#include <utility>
 
 #include "baldin_a_my_scatter/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace baldin_a_my_scatter {
 
+namespace {
+const ppc::task::TaskRegistration<BaldinAMyScatterMPI> kRegistration;
+}  // namespace
+
 BaldinAMyScatterMPI::BaldinAMyScatterMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -49,6 +54,14 @@ bool BaldinAMyScatterMPI::PreProcessingImpl() {
 
 namespace {
 
+// Размер сегмента, на которые режутся поддеревья: промежуточный процесс пересылает
+// сегмент дальше, пока принимает следующие
+constexpr std::size_t kSegmentBytes = static_cast<std::size_t>(64) * 1024;
+
+// Начиная с такой доли на процесс root рассылает всем напрямую: сообщения и так
+// достаточно велики, а пересылка по дереву лишь гоняет те же байты несколько раз
+constexpr std::size_t kLinearBlockBytes = static_cast<std::size_t>(1024) * 1024;
+
 MPI_Aint GetDataTypeExtent(MPI_Datatype type) {
   MPI_Aint lb = 0;
   MPI_Aint extent = 0;
@@ -72,28 +85,45 @@ int CalculateInitialMask(int size) {
   return mask >> 1;
 }
 
-void PrepareRootBuffer(const void *sendbuf, int size, int root, int count, MPI_Aint extent, std::vector<char> &buffer) {
-  size_t total_bytes = static_cast<size_t>(size) * count * extent;
-  size_t chunk_bytes = static_cast<size_t>(count) * extent;
-
-  buffer.resize(total_bytes);
-
-  const char *send_ptr = static_cast<const char *>(sendbuf);
-  char *tmp_ptr = buffer.data();
+// Маска уровня, на котором процесс получает своё поддерево; его дети - v_rank + m для m < маски
+int CalculateReceiveMask(int v_rank, int size) {
+  return v_rank == 0 ? CalculateInitialMask(size) << 1 : (v_rank & -v_rank);
+}
 
-  // Логика сдвига: [root...end] -> начало, [0...root] -> конец
-  size_t first_part_bytes = (size - root) * chunk_bytes;
-  size_t second_part_bytes = root * chunk_bytes;
+// Разметка данных в виртуальном порядке рангов (root = 0), в байтах
+struct TreeLayout {
+  std::size_t block;  // доля одного процесса
+  std::size_t total;  // все доли
+  std::size_t wrap;   // начало доли реального ранга 0: здесь кончается непрерывный кусок sendbuf
+};
+
+// Делит [begin, end) на куски по границам сегментов, по wrap и по own_end (концу доли получателя).
+// Границы зависят только от разметки, поэтому отправитель и получатель режут одинаково
+template <typename Fn>
+void ForEachPiece(const TreeLayout &layout, std::size_t begin, std::size_t end, std::size_t own_end, Fn &&fn) {
+  while (begin < end) {
+    std::size_t next = std::min(end, ((begin / kSegmentBytes) + 1) * kSegmentBytes);
+    if (begin < layout.wrap && layout.wrap < next) {
+      next = layout.wrap;
+    }
+    if (begin < own_end && own_end < next) {
+      next = own_end;
+    }
+    fn(begin, next);
+    begin = next;
+  }
+}
 
-  std::memcpy(tmp_ptr, send_ptr + second_part_bytes, first_part_bytes);
-  std::memcpy(tmp_ptr + first_part_bytes, send_ptr, second_part_bytes);
+std::size_t CountPieces(const TreeLayout &layout, std::size_t begin, std::size_t end, std::size_t own_end) {
+  std::size_t count = 0;
+  ForEachPiece(layout, begin, end, own_end, [&](std::size_t /*piece_begin*/, std::size_t /*piece_end*/) { count++; });
+  return count;
 }
 
 }  // namespace
 
 bool BaldinAMyScatterMPI::RunImpl() {
-  auto &input = GetInput();
-  const auto &[sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm] = input;
+  const auto &[sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm] = GetInput();
 
   int rank = 0;
   int size = 0;
@@ -101,63 +131,132 @@ bool BaldinAMyScatterMPI::RunImpl() {
   MPI_Comm_size(comm, &size);
 
   MPI_Aint extent = GetDataTypeExtent(rank == root ? sendtype : recvtype);
+  const std::size_t block_bytes = static_cast<std::size_t>(recvcount) * static_cast<std::size_t>(extent);
 
-  std::vector<char> temp_buffer;
-  const char *curr_buf_ptr = nullptr;
-
-  // --- ЭТАП 1: Подготовка (только на root) ---
-  if (rank == root) {
-    PrepareRootBuffer(sendbuf, size, root, sendcount, extent, temp_buffer);
-    curr_buf_ptr = temp_buffer.data();
+  // recvcount одинаков на всех процессах, поэтому и выбор алгоритма тоже
+  if (block_bytes >= kLinearBlockBytes) {
+    ScatterLinear(rank, size, block_bytes);
+  } else {
+    ScatterBinomial(rank, size, extent);
   }
+  GetOutput() = recvbuf;
+  return true;
+}
 
-  int v_rank = (rank - root + size) % size;
-  int mask = CalculateInitialMask(size);
-
-  // --- ЭТАП 2: Рассылка по дереву ---
-  while (mask > 0) {
-    // Если процесс - отправитель на этом уровне
-    if (v_rank % (2 * mask) == 0) {
-      int v_dest = v_rank + mask;
-
-      if (v_dest < size) {
-        int subtree_size = CalculateSubtreeSize(v_dest, mask, size);
-        int count_to_send = (subtree_size - v_dest) * recvcount;
+void BaldinAMyScatterMPI::ScatterLinear(int rank, int size, std::size_t block_bytes) {
+  const auto &[sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm] = GetInput();
 
-        size_t offset_bytes = static_cast<size_t>(v_dest - v_rank) * recvcount * extent;
-        int real_dest = VirtualToRealRank(v_dest, root, size);
+  if (rank != root) {
+    MPI_Recv(recvbuf, recvcount, recvtype, root, 0, comm, MPI_STATUS_IGNORE);
+    return;
+  }
 
-        MPI_Send(curr_buf_ptr + offset_bytes, count_to_send, (rank == root ? sendtype : recvtype), real_dest, 0, comm);
-      }
+  // Каждый процесс получает свою долю прямо со своего смещения в sendbuf
+  const auto *send_ptr = static_cast<const char *>(sendbuf);
+  auto requests = GetScratch<MPI_Request>(static_cast<std::size_t>(size) - 1);
+  std::size_t num_requests = 0;
+  for (int dest = 0; dest < size; dest++) {
+    if (dest != root) {
+      MPI_Isend(send_ptr + (static_cast<std::size_t>(dest) * block_bytes), sendcount, sendtype, dest, 0, comm,
+                &requests[num_requests++]);
     }
+  }
+  if (recvbuf != MPI_IN_PLACE) {
+    std::memcpy(recvbuf, send_ptr + (static_cast<std::size_t>(root) * block_bytes), block_bytes);
+  }
+  MPI_Waitall(static_cast<int>(num_requests), requests.data(), MPI_STATUSES_IGNORE);
+}
 
-    // Если процесс - получатель
-    else if (v_rank % (2 * mask) == mask) {
-      int v_source = v_rank - mask;
-      int real_source = VirtualToRealRank(v_source, root, size);
-
-      int subtree_end = CalculateSubtreeSize(v_rank, mask, size);
-      int count_to_recv = (subtree_end - v_rank) * recvcount;
-
-      size_t bytes_to_recv = static_cast<size_t>(count_to_recv) * extent;
-      temp_buffer.resize(bytes_to_recv);
+void BaldinAMyScatterMPI::ScatterBinomial(int rank, int size, MPI_Aint extent) {
+  const auto &[sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm] = GetInput();
 
-      MPI_Recv(temp_buffer.data(), count_to_recv, recvtype, real_source, 0, comm, MPI_STATUS_IGNORE);
+  const std::size_t block = static_cast<std::size_t>(recvcount) * static_cast<std::size_t>(extent);
+  const TreeLayout layout{.block = block,
+                          .total = static_cast<std::size_t>(size) * block,
+                          .wrap = static_cast<std::size_t>(size - root) * block};
+  const MPI_Datatype type = (rank == root ? sendtype : recvtype);
+
+  const int v_rank = (rank - root + size) % size;
+  const int recv_mask = CalculateReceiveMask(v_rank, size);
+  const std::size_t lo = static_cast<std::size_t>(v_rank) * block;
+  const std::size_t own_end = lo + block;
+  const std::size_t hi = static_cast<std::size_t>(CalculateSubtreeSize(v_rank, recv_mask, size)) * block;
+
+  // Поддерево ребёнка, построенного на маске mask: [v_child, v_child + mask)
+  auto child_range = [&](int mask) {
+    const int v_child = v_rank + mask;
+    return std::pair{static_cast<std::size_t>(v_child) * block,
+                     static_cast<std::size_t>(CalculateSubtreeSize(v_child, mask, size)) * block};
+  };
 
-      // Теперь работаем с полученным буфером
-      curr_buf_ptr = temp_buffer.data();
+  // Число отправок известно заранее: каждый ребёнок получает свой диапазон по тем же кускам
+  std::size_t num_sends = 0;
+  for (int mask = recv_mask >> 1; mask > 0; mask >>= 1) {
+    if (v_rank + mask < size) {
+      const auto [child_lo, child_hi] = child_range(mask);
+      num_sends += CountPieces(layout, child_lo, child_hi, child_lo + block);
     }
-
-    mask >>= 1;
   }
+  auto sends = GetScratch<MPI_Request>(num_sends);
+  std::size_t sent = 0;
+
+  // Пересылает детям готовые данные [begin, end), лежащие по адресу src
+  auto forward = [&](std::size_t begin, std::size_t end, const char *src) {
+    for (int mask = recv_mask >> 1; mask > 0; mask >>= 1) {
+      if (v_rank + mask >= size) {
+        continue;
+      }
+      const auto [child_lo, child_hi] = child_range(mask);
+      const std::size_t from = std::max(begin, child_lo);
+      const std::size_t to = std::min(end, child_hi);
+      if (from >= to) {
+        continue;
+      }
+      const int real_dest = VirtualToRealRank(v_rank + mask, root, size);
+      ForEachPiece(layout, from, to, child_lo + block, [&](std::size_t piece_begin, std::size_t piece_end) {
+        MPI_Isend(src + (piece_begin - begin), static_cast<int>((piece_end - piece_begin) / extent), type, real_dest,
+                  0, comm, &sends[sent++]);
+      });
+    }
+  };
 
-  // --- ЭТАП 3: Копирование в пользовательский буфер ---
-  if (recvbuf != MPI_IN_PLACE && curr_buf_ptr != nullptr) {
-    // Копируем только свою долю (recvcount)
-    std::memcpy(recvbuf, curr_buf_ptr, recvcount * extent);
+  if (rank == root) {
+    // Без копии со сдвигом: виртуальный байт v лежит в sendbuf по смещению (v + root * block) % total,
+    // а куски не пересекают wrap и потому непрерывны
+    const auto *send_ptr = static_cast<const char *>(sendbuf);
+    ForEachPiece(layout, own_end, hi, own_end, [&](std::size_t piece_begin, std::size_t piece_end) {
+      const std::size_t real_offset = (piece_begin + (static_cast<std::size_t>(root) * block)) % layout.total;
+      forward(piece_begin, piece_end, send_ptr + real_offset);
+    });
+    if (recvbuf != MPI_IN_PLACE) {
+      std::memcpy(recvbuf, send_ptr + (static_cast<std::size_t>(root) * block), block);
+    }
+  } else {
+    // Своя доля принимается сразу в recvbuf, доли поддерева - в один буфер, выделенный один раз
+    auto subtree = GetScratch<char>(hi - own_end);
+    auto dest = [&](std::size_t v) {
+      return v < own_end ? static_cast<char *>(recvbuf) + (v - lo) : subtree.data() + (v - own_end);
+    };
+
+    const int real_source = VirtualToRealRank(v_rank - recv_mask, root, size);
+    auto recvs = GetScratch<MPI_Request>(CountPieces(layout, lo, hi, own_end));
+    std::size_t posted = 0;
+    ForEachPiece(layout, lo, hi, own_end, [&](std::size_t piece_begin, std::size_t piece_end) {
+      MPI_Irecv(dest(piece_begin), static_cast<int>((piece_end - piece_begin) / extent), recvtype, real_source, 0,
+                comm, &recvs[posted++]);
+    });
+
+    // Конвейер: сегмент уходит детям, как только пришёл, пока следующие ещё принимаются
+    std::size_t received = 0;
+    ForEachPiece(layout, lo, hi, own_end, [&](std::size_t piece_begin, std::size_t piece_end) {
+      MPI_Wait(&recvs[received++], MPI_STATUS_IGNORE);
+      if (piece_begin >= own_end) {
+        forward(piece_begin, piece_end, dest(piece_begin));
+      }
+    });
   }
-  GetOutput() = recvbuf;
-  return true;
+
+  MPI_Waitall(static_cast<int>(sent), sends.data(), MPI_STATUSES_IGNORE);
 }
 
 bool BaldinAMyScatterMPI::PostProcessingImpl() {
@@ -5,9 +5,14 @@
 #include <cstring>
 
 #include "baldin_a_my_scatter/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace baldin_a_my_scatter {
 
+namespace {
+const ppc::task::TaskRegistration<BaldinAMyScatterSEQ> kRegistration;
+}  // namespace
+
 BaldinAMyScatterSEQ::BaldinAMyScatterSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
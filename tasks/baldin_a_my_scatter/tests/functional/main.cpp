@@ -166,7 +166,7 @@ TEST_P(BaldinAMyScatterFuncTests, MyScatterTests) {
   ExecuteTest(GetParam());
 }
 
-const std::array<TestType, 19> kTestParam = {
+const std::array<TestType, 22> kTestParam = {
     std::make_tuple(1, 0, MPI_INT),
 
     std::make_tuple(10, 0, MPI_INT),   std::make_tuple(10, 0, MPI_FLOAT),   std::make_tuple(10, 0, MPI_DOUBLE),
@@ -179,7 +179,9 @@ const std::array<TestType, 19> kTestParam = {
 
     std::make_tuple(17, 0, MPI_INT),   std::make_tuple(123, 0, MPI_INT),    std::make_tuple(7, 1, MPI_DOUBLE),
 
-    std::make_tuple(1000, 0, MPI_INT), std::make_tuple(500, 1, MPI_DOUBLE), std::make_tuple(1500, 2, MPI_FLOAT)};
+    std::make_tuple(1000, 0, MPI_INT), std::make_tuple(500, 1, MPI_DOUBLE), std::make_tuple(1500, 2, MPI_FLOAT),
+
+    std::make_tuple(40000, 1, MPI_INT), std::make_tuple(50000, 3, MPI_FLOAT), std::make_tuple(300000, 2, MPI_DOUBLE)};
 
 const auto kTestTasksList =
     std::tuple_cat(ppc::util::AddFuncTask<BaldinAMyScatterMPI, InType>(kTestParam, PPC_SETTINGS_baldin_a_my_scatter),
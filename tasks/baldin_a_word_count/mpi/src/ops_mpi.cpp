@@ -8,9 +8,14 @@
 #include <vector>
 
 #include "baldin_a_word_count/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace baldin_a_word_count {
 
+namespace {
+const ppc::task::TaskRegistration<BaldinAWordCountMPI> kRegistration;
+}  // namespace
+
 BaldinAWordCountMPI::BaldinAWordCountMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
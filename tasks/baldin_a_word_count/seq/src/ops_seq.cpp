@@ -5,10 +5,13 @@
 #include <string>
 
 #include "baldin_a_word_count/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace baldin_a_word_count {
 
 namespace {
+const ppc::task::TaskRegistration<BaldinAWordCountSEQ> kRegistration;
+
 
 bool IsWordChar(char c) {
   return ((std::isalnum(static_cast<unsigned char>(c)) != 0) || c == '-' || c == '_');
@@ -9,9 +9,14 @@
 #include <vector>
 
 #include "chaschin_v_max_for_each_row/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace chaschin_v_max_for_each_row {
 
+namespace {
+const ppc::task::TaskRegistration<ChaschinVMaxForEachRow> kRegistration;
+}  // namespace
+
 ChaschinVMaxForEachRow::ChaschinVMaxForEachRow(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   auto in_copy = in;
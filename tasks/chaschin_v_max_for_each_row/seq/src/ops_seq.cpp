@@ -5,9 +5,14 @@
 #include <utility>
 
 #include "chaschin_v_max_for_each_row/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace chaschin_v_max_for_each_row {
 
+namespace {
+const ppc::task::TaskRegistration<ChaschinVMaxForEachRowSEQ> kRegistration;
+}  // namespace
+
 ChaschinVMaxForEachRowSEQ::ChaschinVMaxForEachRowSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   auto in_copy = in;
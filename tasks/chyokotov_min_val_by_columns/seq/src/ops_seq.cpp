@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "chyokotov_min_val_by_columns/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace chyokotov_min_val_by_columns {
 
+namespace {
+const ppc::task::TaskRegistration<ChyokotovMinValByColumnsSEQ> kRegistration;
+}  // namespace
+
 ChyokotovMinValByColumnsSEQ::ChyokotovMinValByColumnsSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput().clear();
@@ -0,0 +1,5 @@
+#include "runners/include/runners.hpp"
+
+int main(int argc, char **argv) {
+  return ppc::runners::ConvertTestData(argc, argv);
+}
@@ -10,9 +10,14 @@
 #include <vector>
 
 #include "dorofeev_i_monte_carlo_integration/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace dorofeev_i_monte_carlo_integration_processes {
 
+namespace {
+const ppc::task::TaskRegistration<DorofeevIMonteCarloIntegrationMPI> kRegistration;
+}  // namespace
+
 DorofeevIMonteCarloIntegrationMPI::DorofeevIMonteCarloIntegrationMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
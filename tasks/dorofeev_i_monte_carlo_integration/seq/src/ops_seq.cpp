@@ -8,9 +8,14 @@
 #include <vector>
 
 #include "dorofeev_i_monte_carlo_integration/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace dorofeev_i_monte_carlo_integration_processes {
 
+namespace {
+const ppc::task::TaskRegistration<DorofeevIMonteCarloIntegrationSEQ> kRegistration;
+}  // namespace
+
 DorofeevIMonteCarloIntegrationSEQ::DorofeevIMonteCarloIntegrationSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
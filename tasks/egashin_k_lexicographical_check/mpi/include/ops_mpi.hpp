@@ -21,7 +21,6 @@ class TestTaskMPI : public BaseTask {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
-  static void CalculateDistribution(int size, int min_len, std::vector<int> &counts, std::vector<int> &displs);
   static int CompareLocal(const std::vector<char> &s1, const std::vector<char> &s2, int count);
   static bool GetFinalDecision(const std::vector<int> &global_results, int s1_len, int s2_len);
 };
@@ -3,12 +3,20 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <vector>
 
+#include "dist/include/distribute.hpp"
+#include "dist/include/partition.hpp"
 #include "egashin_k_lexicographical_check/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace egashin_k_lexicographical_check {
 
+namespace {
+const ppc::task::TaskRegistration<TestTaskMPI> kRegistration;
+}  // namespace
+
 TestTaskMPI::TestTaskMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -27,15 +35,6 @@ bool TestTaskMPI::PostProcessingImpl() {
   return true;
 }
 
-void TestTaskMPI::CalculateDistribution(int size, int min_len, std::vector<int> &counts, std::vector<int> &displs) {
-  int delta = min_len / size;
-  int remainder = min_len % size;
-  for (int i = 0; i < size; ++i) {
-    counts[i] = delta + (i < remainder ? 1 : 0);
-    displs[i] = (i == 0) ? 0 : displs[i - 1] + counts[i - 1];
-  }
-}
-
 int TestTaskMPI::CompareLocal(const std::vector<char> &s1, const std::vector<char> &s2, int count) {
   for (int i = 0; i < count; ++i) {
     auto c1 = static_cast<unsigned char>(s1[i]);
@@ -84,30 +83,10 @@ bool TestTaskMPI::RunImpl() {
     return true;
   }
 
-  std::vector<int> counts(size);
-  std::vector<int> displs(size);
-
-  if (rank == 0) {
-    CalculateDistribution(size, min_len, counts, displs);
-  }
-
-  int local_count = 0;
-  MPI_Scatter(counts.data(), 1, MPI_INT, &local_count, 1, MPI_INT, 0, MPI_COMM_WORLD);
-
-  std::vector<char> local_s1(local_count);
-  std::vector<char> local_s2(local_count);
-  const char *send_s1 = (rank == 0) ? GetInput().first.data() : nullptr;
-  const char *send_s2 = (rank == 0) ? GetInput().second.data() : nullptr;
-
-  if (local_count > 0 || rank == 0) {
-    MPI_Scatterv(send_s1, counts.data(), displs.data(), MPI_CHAR, local_s1.data(), local_count, MPI_CHAR, 0,
-                 MPI_COMM_WORLD);
-    MPI_Scatterv(send_s2, counts.data(), displs.data(), MPI_CHAR, local_s2.data(), local_count, MPI_CHAR, 0,
-                 MPI_COMM_WORLD);
-  } else {
-    MPI_Scatterv(send_s1, counts.data(), displs.data(), MPI_CHAR, local_s1.data(), 0, MPI_CHAR, 0, MPI_COMM_WORLD);
-    MPI_Scatterv(send_s2, counts.data(), displs.data(), MPI_CHAR, local_s2.data(), 0, MPI_CHAR, 0, MPI_COMM_WORLD);
-  }
+  const auto partition = ppc::dist::Partition::Block(static_cast<std::size_t>(min_len), size);
+  const int local_count = partition.GetCount(rank);
+  const std::vector<char> local_s1 = ppc::dist::Scatter<char>(partition, GetInput().first);
+  const std::vector<char> local_s2 = ppc::dist::Scatter<char>(partition, GetInput().second);
 
   int local_res = CompareLocal(local_s1, local_s2, local_count);
 
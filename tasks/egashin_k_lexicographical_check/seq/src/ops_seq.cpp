@@ -4,9 +4,14 @@
 #include <cstddef>
 
 #include "egashin_k_lexicographical_check/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace egashin_k_lexicographical_check {
 
+namespace {
+const ppc::task::TaskRegistration<TestTaskSEQ> kRegistration;
+}  // namespace
+
 TestTaskSEQ::TestTaskSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "egorova_l_find_max_val_col_matrix/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace egorova_l_find_max_val_col_matrix {
 
+namespace {
+const ppc::task::TaskRegistration<EgorovaLFindMaxValColMatrixSEQ> kRegistration;
+}  // namespace
+
 #ifdef __GNUC__
 #  pragma GCC diagnostic push
 #  pragma GCC diagnostic ignored "-Wnull-dereference"
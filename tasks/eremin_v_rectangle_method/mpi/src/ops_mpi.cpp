@@ -6,9 +6,14 @@
 #include <tuple>
 
 #include "eremin_v_rectangle_method/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace eremin_v_rectangle_method {
 
+namespace {
+const ppc::task::TaskRegistration<EreminVRectangleMethodMPI> kRegistration;
+}  // namespace
+
 EreminVRectangleMethodMPI::EreminVRectangleMethodMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
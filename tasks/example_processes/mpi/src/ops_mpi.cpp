@@ -6,10 +6,15 @@
 #include <vector>
 
 #include "example_processes/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 #include "util/include/util.hpp"
 
 namespace nesterov_a_test_task_processes {
 
+namespace {
+const ppc::task::TaskRegistration<NesterovATestTaskMPI> kRegistration;
+}  // namespace
+
 NesterovATestTaskMPI::NesterovATestTaskMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -4,10 +4,15 @@
 #include <vector>
 
 #include "example_processes/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 #include "util/include/util.hpp"
 
 namespace nesterov_a_test_task_processes {
 
+namespace {
+const ppc::task::TaskRegistration<NesterovATestTaskSEQ> kRegistration;
+}  // namespace
+
 NesterovATestTaskSEQ::NesterovATestTaskSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
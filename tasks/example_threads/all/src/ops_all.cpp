@@ -9,10 +9,15 @@
 
 #include "example_threads/common/include/common.hpp"
 #include "oneapi/tbb/parallel_for.h"
+#include "task/include/task_registry.hpp"
 #include "util/include/util.hpp"
 
 namespace nesterov_a_test_task_threads {
 
+namespace {
+const ppc::task::TaskRegistration<NesterovATestTaskALL> kRegistration;
+}  // namespace
+
 NesterovATestTaskALL::NesterovATestTaskALL(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
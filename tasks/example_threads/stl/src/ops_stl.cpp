@@ -6,10 +6,15 @@
 #include <vector>
 
 #include "example_threads/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 #include "util/include/util.hpp"
 
 namespace nesterov_a_test_task_threads {
 
+namespace {
+const ppc::task::TaskRegistration<NesterovATestTaskSTL> kRegistration;
+}  // namespace
+
 NesterovATestTaskSTL::NesterovATestTaskSTL(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
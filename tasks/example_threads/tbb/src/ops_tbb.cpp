@@ -9,9 +9,14 @@
 
 #include "example_threads/common/include/common.hpp"
 #include "oneapi/tbb/parallel_for.h"
+#include "task/include/task_registry.hpp"
 
 namespace nesterov_a_test_task_threads {
 
+namespace {
+const ppc::task::TaskRegistration<NesterovATestTaskTBB> kRegistration;
+}  // namespace
+
 NesterovATestTaskTBB::NesterovATestTaskTBB(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -5,9 +5,14 @@
 #include <vector>
 
 #include "fatehov_k_matrix_max_elem/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace fatehov_k_matrix_max_elem {
 
+namespace {
+const ppc::task::TaskRegistration<FatehovKMatrixMaxElemSEQ> kRegistration;
+}  // namespace
+
 FatehovKMatrixMaxElemSEQ::FatehovKMatrixMaxElemSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
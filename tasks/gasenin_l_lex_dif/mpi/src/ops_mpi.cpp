@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "gasenin_l_lex_dif/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace {
 
@@ -52,6 +53,10 @@ int GetFinalResultByLength(int len1, int len2) {
 
 namespace gasenin_l_lex_dif {
 
+namespace {
+const ppc::task::TaskRegistration<GaseninLLexDifMPI> kRegistration;
+}  // namespace
+
 GaseninLLexDifMPI::GaseninLLexDifMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -4,9 +4,14 @@
 #include <cstddef>
 
 #include "gasenin_l_lex_dif/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace gasenin_l_lex_dif {
 
+namespace {
+const ppc::task::TaskRegistration<GaseninLLexDifSEQ> kRegistration;
+}  // namespace
+
 GaseninLLexDifSEQ::GaseninLLexDifSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
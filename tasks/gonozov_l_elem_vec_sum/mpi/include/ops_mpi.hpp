@@ -10,7 +10,7 @@ class GonozovLElemVecSumMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit GonozovLElemVecSumMPI(const InType &in);
+  explicit GonozovLElemVecSumMPI(InType in);
 
  private:
   bool ValidationImpl() override;
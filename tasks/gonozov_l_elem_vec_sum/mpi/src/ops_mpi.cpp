@@ -3,15 +3,21 @@
 #include <mpi.h>
 
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #include "gonozov_l_elem_vec_sum/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace gonozov_l_elem_vec_sum {
 
-GonozovLElemVecSumMPI::GonozovLElemVecSumMPI(const InType &in) {
+namespace {
+const ppc::task::TaskRegistration<GonozovLElemVecSumMPI> kRegistration;
+}  // namespace
+
+GonozovLElemVecSumMPI::GonozovLElemVecSumMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
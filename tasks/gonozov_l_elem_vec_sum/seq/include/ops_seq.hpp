@@ -10,7 +10,7 @@ class GonozovLElemVecSumSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit GonozovLElemVecSumSEQ(const InType &in);
+  explicit GonozovLElemVecSumSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
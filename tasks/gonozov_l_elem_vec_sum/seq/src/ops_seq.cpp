@@ -1,15 +1,21 @@
 #include "gonozov_l_elem_vec_sum/seq/include/ops_seq.hpp"
 
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #include "gonozov_l_elem_vec_sum/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace gonozov_l_elem_vec_sum {
 
-GonozovLElemVecSumSEQ::GonozovLElemVecSumSEQ(const InType &in) {
+namespace {
+const ppc::task::TaskRegistration<GonozovLElemVecSumSEQ> kRegistration;
+}  // namespace
+
+GonozovLElemVecSumSEQ::GonozovLElemVecSumSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0LL;
 }
 
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <utility>
 #include <vector>
 
 #include "gonozov_l_elem_vec_sum/common/include/common.hpp"
@@ -27,7 +28,7 @@ class GonozovLElemVecSumPerfTests : public ppc::util::BaseRunPerfTests<InType, O
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
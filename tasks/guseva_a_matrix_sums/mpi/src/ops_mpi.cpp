@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "guseva_a_matrix_sums/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace guseva_a_matrix_sums {
 
+namespace {
+const ppc::task::TaskRegistration<GusevaAMatrixSumsMPI> kRegistration;
+}  // namespace
+
 GusevaAMatrixSumsMPI::GusevaAMatrixSumsMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
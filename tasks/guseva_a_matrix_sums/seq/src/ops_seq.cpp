@@ -3,9 +3,14 @@
 #include <cstdint>
 
 #include "guseva_a_matrix_sums/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace guseva_a_matrix_sums {
 
+namespace {
+const ppc::task::TaskRegistration<GusevaAMatrixSumsSEQ> kRegistration;
+}  // namespace
+
 GusevaAMatrixSumsSEQ::GusevaAMatrixSumsSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
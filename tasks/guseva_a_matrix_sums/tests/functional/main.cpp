@@ -5,6 +5,7 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <fstream>
 #include <string>
 #include <tuple>
@@ -13,7 +14,9 @@
 #include "guseva_a_matrix_sums/common/include/common.hpp"
 #include "guseva_a_matrix_sums/mpi/include/ops_mpi.hpp"
 #include "guseva_a_matrix_sums/seq/include/ops_seq.hpp"
+#include "util/include/binary_data.hpp"
 #include "util/include/func_test_util.hpp"
+#include "util/include/perf_test_util.hpp"
 #include "util/include/util.hpp"
 
 namespace guseva_a_matrix_sums {
@@ -100,6 +103,41 @@ inline const auto kPerfTestName = GusevaARunFuncTestsProcesses::PrintFuncTestNam
 // NOLINTNEXTLINE
 INSTANTIATE_TEST_SUITE_P(GusevaAMatrix, GusevaARunFuncTestsProcesses, kGtestValues, kPerfTestName);
 
+// No binary data is shipped, so the layout read by the performance test is produced here from a text case
+TEST(GusevaAMatrixSumsBinaryData, ConvertedCaseGivesExpectedSums) {
+  const auto dir =
+      std::filesystem::temp_directory_path() / ("ppc_guseva_a_matrix_sums_" + std::to_string(ppc::util::GetMPIRank()));
+  std::filesystem::create_directories(dir);
+  const auto input_path = (dir / "input.ppcb").string();
+  const auto expected_path = (dir / "expected.ppcb").string();
+  ppc::util::ConvertTextToBinary(ppc::util::GetAbsoluteTaskPath(PPC_ID_guseva_a_matrix_sums, "cases/test1.txt"),
+                                 input_path, ppc::util::DType::kFloat64, {2});
+  ppc::util::ConvertTextToBinary(ppc::util::GetAbsoluteTaskPath(PPC_ID_guseva_a_matrix_sums, "expected/test1.txt"),
+                                 expected_path, ppc::util::DType::kFloat64, {1});
+
+  InType input;
+  OutType expected;
+  {
+    const ppc::util::BinaryDataFile input_file(input_path);
+    const auto &shape = input_file.GetArrayShape(0);
+    const auto values = input_file.GetArray<double>(0);
+    input = InType(static_cast<uint32_t>(shape.at(0)), static_cast<uint32_t>(shape.at(1)),
+                   std::vector<double>(values.begin(), values.end()));
+    const ppc::util::BinaryDataFile expected_file(expected_path);
+    const auto expected_values = expected_file.GetArray<double>(0);
+    expected = OutType(expected_values.begin(), expected_values.end());
+  }
+  std::filesystem::remove_all(dir);
+
+  GusevaAMatrixSumsSEQ task(input);
+  ASSERT_TRUE(task.Validation() && task.PreProcessing() && task.Run() && task.PostProcessing());
+  const auto &output = task.GetOutput();
+  ASSERT_EQ(output.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); i++) {
+    EXPECT_NEAR(output[i], expected[i], kEpsilon);
+  }
+}
+
 }  // namespace
 
 }  // namespace guseva_a_matrix_sums
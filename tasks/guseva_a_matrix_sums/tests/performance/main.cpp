@@ -9,6 +9,7 @@
 #include "guseva_a_matrix_sums/common/include/common.hpp"
 #include "guseva_a_matrix_sums/mpi/include/ops_mpi.hpp"
 #include "guseva_a_matrix_sums/seq/include/ops_seq.hpp"
+#include "util/include/binary_data.hpp"
 #include "util/include/perf_test_util.hpp"
 #include "util/include/util.hpp"
 
@@ -22,27 +23,49 @@ class GusevaAMatrixSumsRunPerfTestProcesses : public ppc::util::BaseRunPerfTests
     std::string input_data_source = ppc::util::GetAbsoluteTaskPath(PPC_ID_guseva_a_matrix_sums, "perf/input.txt");
     std::string expected_data_source = ppc::util::GetAbsoluteTaskPath(PPC_ID_guseva_a_matrix_sums, "perf/expected.txt");
 
-    std::ifstream file(input_data_source);
+    // Binary variants are produced with: ppc_convert_data input.txt float64 2; ppc_convert_data expected.txt float64 1
+    if (ppc::util::IsBinaryDataPath(input_data_source)) {
+      const ppc::util::BinaryDataFile file(input_data_source);
+      const auto &shape = file.GetArrayShape(0);
+      const auto values = file.GetArray<double>(0);
+      input_data_ = InType(static_cast<uint32_t>(shape.at(0)), static_cast<uint32_t>(shape.at(1)),
+                           std::vector<double>(values.begin(), values.end()));
+    } else {
+      input_data_ = ReadTextInput(input_data_source);
+    }
+    if (ppc::util::IsBinaryDataPath(expected_data_source)) {
+      const ppc::util::BinaryDataFile file(expected_data_source);
+      const auto values = file.GetArray<double>(0);
+      expected_data_ = OutType(values.begin(), values.end());
+    } else {
+      expected_data_ = ReadTextExpected(expected_data_source);
+    }
+  }
+
+  static InType ReadTextInput(const std::string &path) {
+    std::ifstream file(path);
     uint32_t rows = 0;
     uint32_t columns = 0;
     std::vector<double> inp;
-    std::vector<double> exp;
     file >> rows;
     file >> columns;
     int num = 0;
     while (file >> num) {
       inp.push_back(num);
     }
-    file.close();
-    file = std::ifstream(expected_data_source);
+    return {rows, columns, inp};
+  }
+
+  static OutType ReadTextExpected(const std::string &path) {
+    std::ifstream file(path);
+    uint32_t columns = 0;
+    std::vector<double> exp;
     file >> columns;
+    int num = 0;
     while (file >> num) {
       exp.push_back(num);
     }
-    file.close();
-
-    input_data_ = InType(rows, columns, inp);
-    expected_data_ = OutType(exp);
+    return exp;
   }
 
   bool CheckTestOutputData(OutType &output_data) final {
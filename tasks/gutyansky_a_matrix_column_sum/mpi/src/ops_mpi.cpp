@@ -8,9 +8,14 @@
 #include <vector>
 
 #include "gutyansky_a_matrix_column_sum/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace gutyansky_a_matrix_column_sum {
 
+namespace {
+const ppc::task::TaskRegistration<GutyanskyAMatrixColumnSumMPI> kRegistration;
+}  // namespace
+
 GutyanskyAMatrixColumnSumMPI::GutyanskyAMatrixColumnSumMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
 
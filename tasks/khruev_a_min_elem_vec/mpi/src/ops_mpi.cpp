@@ -7,9 +7,14 @@
 #include <vector>
 
 #include "khruev_a_min_elem_vec/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace khruev_a_min_elem_vec {
 
+namespace {
+const ppc::task::TaskRegistration<KhruevAMinElemVecMPI> kRegistration;
+}  // namespace
+
 KhruevAMinElemVecMPI::KhruevAMinElemVecMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());  // mpi scoreboard
   GetInput() = in;                       // dannie doljna bit vidna vsem func rodytelya and stabilizaciya
@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "khruev_a_min_elem_vec/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace khruev_a_min_elem_vec {
 
+namespace {
+const ppc::task::TaskRegistration<KhruevAMinElemVecSEQ> kRegistration;
+}  // namespace
+
 KhruevAMinElemVecSEQ::KhruevAMinElemVecSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
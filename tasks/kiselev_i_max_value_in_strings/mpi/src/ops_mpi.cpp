@@ -9,9 +9,14 @@
 #include <vector>
 
 #include "kiselev_i_max_value_in_strings/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace kiselev_i_max_value_in_strings {
 
+namespace {
+const ppc::task::TaskRegistration<KiselevITestTaskMPI> kRegistration;
+}  // namespace
+
 KiselevITestTaskMPI::KiselevITestTaskMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   auto in_copy = in;
@@ -12,9 +12,14 @@
 #include <vector>
 
 #include "kondakov_v_global_search/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace kondakov_v_global_search {
 
+namespace {
+const ppc::task::TaskRegistration<KondakovVGlobalSearchMPI> kRegistration;
+}  // namespace
+
 KondakovVGlobalSearchMPI::KondakovVGlobalSearchMPI(const InType &in) {
   MPI_Comm_rank(MPI_COMM_WORLD, &world_rank_);
   MPI_Comm_size(MPI_COMM_WORLD, &world_size_);
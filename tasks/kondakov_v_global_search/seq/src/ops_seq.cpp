@@ -8,9 +8,14 @@
 #include <vector>
 
 #include "kondakov_v_global_search/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace kondakov_v_global_search {
 
+namespace {
+const ppc::task::TaskRegistration<KondakovVGlobalSearchSEQ> kRegistration;
+}  // namespace
+
 KondakovVGlobalSearchSEQ::KondakovVGlobalSearchSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "kondakov_v_min_val_in_matrix_str/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace kondakov_v_min_val_in_matrix_str {
 
+namespace {
+const ppc::task::TaskRegistration<KondakovVMinValMatrixSEQ> kRegistration;
+}  // namespace
+
 KondakovVMinValMatrixSEQ::KondakovVMinValMatrixSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   InType tmp = in;
@@ -5,9 +5,14 @@
 #include <vector>
 
 #include "kosolapov_v_max_values_in_col_matrix/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace kosolapov_v_max_values_in_col_matrix {
 
+namespace {
+const ppc::task::TaskRegistration<KosolapovVMaxValuesInColMatrixSEQ> kRegistration;
+}  // namespace
+
 KosolapovVMaxValuesInColMatrixSEQ::KosolapovVMaxValuesInColMatrixSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = InType(in);
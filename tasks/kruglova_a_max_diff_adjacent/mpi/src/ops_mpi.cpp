@@ -8,9 +8,14 @@
 #include <vector>
 
 #include "kruglova_a_max_diff_adjacent/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace kruglova_a_max_diff_adjacent {
 
+namespace {
+const ppc::task::TaskRegistration<KruglovaAMaxDiffAdjacentMPI> kRegistration;
+}  // namespace
+
 KruglovaAMaxDiffAdjacentMPI::KruglovaAMaxDiffAdjacentMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
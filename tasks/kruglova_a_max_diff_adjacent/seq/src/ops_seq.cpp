@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "kruglova_a_max_diff_adjacent/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace kruglova_a_max_diff_adjacent {
 
+namespace {
+const ppc::task::TaskRegistration<KruglovaAMaxDiffAdjacentSEQ> kRegistration;
+}  // namespace
+
 KruglovaAMaxDiffAdjacentSEQ::KruglovaAMaxDiffAdjacentSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
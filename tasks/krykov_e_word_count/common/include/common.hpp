@@ -7,7 +7,7 @@
 
 namespace krykov_e_word_count {
 
-using InType = std::string;
+using InType = ppc::task::DistributedInput<char>;  // characters of the text
 using OutType = int;
 using TestType = std::tuple<std::string, int>;
 using BaseTask = ppc::task::Task<InType, OutType>;
@@ -2,32 +2,23 @@
 
 #include <mpi.h>
 
-#include <algorithm>
 #include <cctype>
 #include <cstdint>
-#include <ranges>
-#include <string>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "dist/include/distribute.hpp"
+#include "dist/include/partition.hpp"
 #include "krykov_e_word_count/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace krykov_e_word_count {
 
 namespace {
-void ChunkSizesAndDispls(int text_size, int world_size, std::vector<int> &chunk_sizes, std::vector<int> &displs) {
-  int base_size = text_size / world_size;
-  int remainder = text_size % world_size;
-
-  int offset = 0;
-  for (int i = 0; i < world_size; ++i) {
-    chunk_sizes[i] = base_size + (i < remainder ? 1 : 0);
-    displs[i] = offset;
-    offset += chunk_sizes[i];
-  }
-}
+const ppc::task::TaskRegistration<KrykovEWordCountMPI> kRegistration;
 
-uint64_t CountWordsInChunk(const std::vector<char> &local_chunk) {
+uint64_t CountWordsInChunk(std::span<const char> local_chunk) {
   uint64_t local_count = 0;
   bool in_word = false;
   for (char c : local_chunk) {
@@ -43,7 +34,7 @@ uint64_t CountWordsInChunk(const std::vector<char> &local_chunk) {
   return local_count;
 }
 
-std::pair<int, int> StartsEndsFromChunk(const std::vector<char> &local_chunk) {
+std::pair<int, int> StartsEndsFromChunk(std::span<const char> local_chunk) {
   int starts_with_space = 1;
   int ends_with_space = 1;
   if (!local_chunk.empty()) {
@@ -62,52 +53,30 @@ KrykovEWordCountMPI::KrykovEWordCountMPI(const InType &in) {
 }
 
 bool KrykovEWordCountMPI::ValidationImpl() {
-  return (!GetInput().empty()) && (GetOutput() == 0);
+  return (GetInput().GlobalSize() != 0) && (GetOutput() == 0);
 }
 
+// Leading and trailing spaces do not change the count, so the text is not trimmed
 bool KrykovEWordCountMPI::PreProcessingImpl() {
-  const auto &input = GetInput();
-  auto trimmed = input;
-
-  trimmed.erase(trimmed.begin(),
-                std::ranges::find_if(trimmed, [](char ch) { return !std::isspace(static_cast<unsigned char>(ch)); }));
-
-  trimmed.erase(std::ranges::find_if(std::ranges::reverse_view(trimmed),
-                                     [](char ch) {
-    return !std::isspace(static_cast<unsigned char>(ch));
-  }).base(),
-                trimmed.end());
-
-  GetInput() = trimmed;
   return true;
 }
 
 bool KrykovEWordCountMPI::RunImpl() {
-  const std::string &text = GetInput();
+  const auto &input = GetInput();
 
   int world_size = 0;
   int world_rank = 0;
   MPI_Comm_size(MPI_COMM_WORLD, &world_size);
   MPI_Comm_rank(MPI_COMM_WORLD, &world_rank);
 
-  int text_size = static_cast<int>(text.size());
-  MPI_Bcast(&text_size, 1, MPI_INT, 0, MPI_COMM_WORLD);
-
-  std::vector<int> chunk_sizes(world_size);
-  std::vector<int> displs(world_size);
-
-  ChunkSizesAndDispls(text_size, world_size, chunk_sizes, displs);
-
-  int local_size = chunk_sizes[world_rank];
-  std::vector<char> local_chunk(local_size);
-
-  std::vector<char> text_buf;
-  if (world_rank == 0) {
-    text_buf.assign(text.begin(), text.end());
+  // A distributed input already holds this rank's block of the text
+  std::vector<char> scattered;
+  if (!input.distributed) {
+    const auto partition = ppc::dist::Partition::Block(input.GlobalSize(), world_size);
+    scattered = ppc::dist::Scatter<char>(partition, input.local);
   }
-
-  MPI_Scatterv(world_rank == 0 ? text_buf.data() : nullptr, chunk_sizes.data(), displs.data(), MPI_CHAR,
-               local_chunk.data(), local_size, MPI_CHAR, 0, MPI_COMM_WORLD);
+  const std::span<const char> local_chunk =
+      input.distributed ? std::span<const char>(input.local) : std::span<const char>(scattered);
 
   uint64_t local_count = CountWordsInChunk(local_chunk);
 
@@ -1,15 +1,18 @@
 #include "krykov_e_word_count/seq/include/ops_seq.hpp"
 
-#include <algorithm>
 #include <cctype>
 #include <cstddef>
-#include <ranges>
-#include <string>
+#include <vector>
 
 #include "krykov_e_word_count/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace krykov_e_word_count {
 
+namespace {
+const ppc::task::TaskRegistration<KrykovEWordCountSEQ> kRegistration;
+}  // namespace
+
 KrykovEWordCountSEQ::KrykovEWordCountSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -17,20 +20,16 @@ KrykovEWordCountSEQ::KrykovEWordCountSEQ(const InType &in) {
 }
 
 bool KrykovEWordCountSEQ::ValidationImpl() {
-  return (!GetInput().empty()) && (GetOutput() == 0);
+  return (!GetInput().local.empty()) && (GetOutput() == 0);
 }
 
+// Leading and trailing spaces do not change the count, so the text is not trimmed
 bool KrykovEWordCountSEQ::PreProcessingImpl() {
-  auto &input = GetInput();
-  input.erase(input.begin(), std::ranges::find_if(input, [](unsigned char ch) { return !std::isspace(ch); }));
-  input.erase(
-      std::ranges::find_if(std::ranges::reverse_view(input), [](unsigned char ch) { return !std::isspace(ch); }).base(),
-      input.end());
   return true;
 }
 
 bool KrykovEWordCountSEQ::RunImpl() {
-  const std::string &text = GetInput();
+  const std::vector<char> &text = GetInput().local;
 
   bool in_word = false;
   size_t word_count = 0;
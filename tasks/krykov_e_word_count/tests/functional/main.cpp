@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include "krykov_e_word_count/common/include/common.hpp"
 #include "krykov_e_word_count/mpi/include/ops_mpi.hpp"
@@ -46,11 +47,11 @@ class KrykovEWordCountFuncTests : public ppc::util::BaseRunFuncTests<InType, Out
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return ppc::task::MakeWholeInput(std::vector<char>(input_data_.begin(), input_data_.end()));
   }
 
  private:
-  InType input_data_;
+  std::string input_data_;
   OutType expected_output_{};
 };
 
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
-#include <string>
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <utility>
 
 #include "krykov_e_word_count/common/include/common.hpp"
 #include "krykov_e_word_count/mpi/include/ops_mpi.hpp"
@@ -11,16 +14,19 @@ namespace krykov_e_word_count {
 
 class KrykovEWordCountPerfTests : public ppc::util::BaseRunPerfTests<InType, OutType> {
  private:
+  static constexpr std::string_view kBaseText = "word ";
   const int kRepeatCount_ = 2000000;
   InType input_data_;
   OutType expected_result_ = 0;
 
   void SetUp() override {
-    std::string base_text = "word ";
-    input_data_.clear();
-    for (int i = 0; i < kRepeatCount_; i++) {
-      input_data_ += base_text;
-    }
+    // Each rank of the MPI version generates only its own block of the text instead of receiving it from rank 0
+    const auto text_size = static_cast<std::size_t>(kRepeatCount_) * kBaseText.size();
+    input_data_ = MakeDistributedTestInput<char>({text_size}, [](std::span<char> block, std::size_t first_index) {
+      for (std::size_t i = 0; i < block.size(); i++) {
+        block[i] = kBaseText[(first_index + i) % kBaseText.size()];
+      }
+    });
 
     expected_result_ = kRepeatCount_;
   }
@@ -30,7 +36,7 @@ class KrykovEWordCountPerfTests : public ppc::util::BaseRunPerfTests<InType, Out
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
  public:
@@ -7,9 +7,14 @@
 #include <vector>
 
 #include "kurpiakov_a_elem_vec_sum/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace kurpiakov_a_elem_vec_sum {
 
+namespace {
+const ppc::task::TaskRegistration<KurpiakovAElemVecSumMPI> kRegistration;
+}  // namespace
+
 KurpiakovAElemVecSumMPI::KurpiakovAElemVecSumMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -4,8 +4,13 @@
 #include <vector>
 
 #include "kurpiakov_a_elem_vec_sum/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace kurpiakov_a_elem_vec_sum {
+
+namespace {
+const ppc::task::TaskRegistration<KurpiakovAElemVecSumSEQ> kRegistration;
+}  // namespace
 KurpiakovAElemVecSumSEQ::KurpiakovAElemVecSumSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -2,15 +2,22 @@
 
 #include <mpi.h>
 
-#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <vector>
 
+#include "dist/include/distribute.hpp"
+#include "dist/include/partition.hpp"
 #include "kutergin_a_closest_pair/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace kutergin_a_closest_pair {
 
+namespace {
+const ppc::task::TaskRegistration<KuterginAClosestPairMPI> kRegistration;
+}  // namespace
+
 KuterginAClosestPairMPI::KuterginAClosestPairMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -27,37 +34,6 @@ bool KuterginAClosestPairMPI::PreProcessingImpl() {
 
 namespace {
 
-std::vector<int> DistributeData(int rank, int size, int n, const std::vector<int> &v) {
-  int local_size = n / size;
-  int remainder = n % size;
-
-  int start = (rank * local_size) + std::min(rank, remainder);
-  int end = start + local_size + (rank < remainder ? 1 : 0);
-
-  if (rank == size - 1) {
-    end = n;
-  }
-
-  std::vector<int> local_data(end - start);
-  if (rank == 0) {
-    std::copy(v.begin() + start, v.begin() + end, local_data.begin());
-
-    for (int i = 1; i < size; ++i) {
-      int other_start = (i * local_size) + std::min(i, remainder);
-      int other_end = other_start + local_size + (i < remainder ? 1 : 0);
-      if (i == size - 1) {
-        other_end = n;
-      }
-
-      MPI_Send(v.data() + other_start, other_end - other_start, MPI_INT, i, 0, MPI_COMM_WORLD);
-    }
-  } else {
-    MPI_Recv(local_data.data(), static_cast<int>(local_data.size()), MPI_INT, 0, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-  }
-
-  return local_data;
-}
-
 int FindLocalMin(const std::vector<int> &local_data, int start_idx, int &found_idx) {
   int local_min = std::numeric_limits<int>::max();
   found_idx = -1;
@@ -73,22 +49,6 @@ int FindLocalMin(const std::vector<int> &local_data, int start_idx, int &found_i
   return local_min;
 }
 
-int CalculateStartIndex(int rank, int size, int n) {
-  int local_size = n / size;
-  int remainder = n % size;
-  return (rank * local_size) + std::min(rank, remainder);
-}
-
-int CalculateEndIndex(int rank, int size, int n) {
-  int local_size = n / size;
-  int remainder = n % size;
-  int end = CalculateStartIndex(rank, size, n) + local_size + (rank < remainder ? 1 : 0);
-  if (rank == size - 1) {
-    end = n;
-  }
-  return end;
-}
-
 int CheckBoundary(int rank, int size, int end, int n, const std::vector<int> &v, const std::vector<int> &local_data,
                   int current_min, int &current_idx) {
   if (rank < size - 1 && end < n) {
@@ -119,18 +79,18 @@ bool KuterginAClosestPairMPI::RunImpl() {
     return true;
   }
 
-  auto local_data = DistributeData(rank, size, n, v);
-  if (local_data.empty()) {
-    GetOutput() = -1;
-    return true;
-  }
+  const auto partition = ppc::dist::Partition::Block(static_cast<std::size_t>(n), size);
+  const auto local_data = ppc::dist::Scatter<int>(partition, v);
 
-  int start_idx = CalculateStartIndex(rank, size, n);
+  // Ranks without elements still take part in the reduction below, with no candidate
+  int start_idx = partition.GetDispl(rank);
   int local_idx = -1;
   int local_min = FindLocalMin(local_data, start_idx, local_idx);
 
-  int end = CalculateEndIndex(rank, size, n);
-  local_min = CheckBoundary(rank, size, end, n, v, local_data, local_min, local_idx);
+  if (!local_data.empty()) {
+    int end = start_idx + partition.GetCount(rank);
+    local_min = CheckBoundary(rank, size, end, n, v, local_data, local_min, local_idx);
+  }
 
   struct MinIndex {
     int val = 0;
@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "kutergin_a_closest_pair/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace kutergin_a_closest_pair {
 
+namespace {
+const ppc::task::TaskRegistration<KuterginAClosestPairSEQ> kRegistration;
+}  // namespace
+
 KuterginAClosestPairSEQ::KuterginAClosestPairSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -5,9 +5,14 @@
 #include <cmath>
 
 #include "../../common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace kutergin_v_trapezoid_mpi {
 
+namespace {
+const ppc::task::TaskRegistration<TrapezoidIntegrationMPI> kRegistration;
+}  // namespace
+
 double Func(double x)  // интегрируемая функция для примера
 {
   return x * x;
@@ -1,9 +1,14 @@
 #include "../include/trapezoid_integration_sequential.hpp"
 
 #include "../../common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace kutergin_v_trapezoid_seq {
 
+namespace {
+const ppc::task::TaskRegistration<TrapezoidIntegrationSequential> kRegistration;
+}  // namespace
+
 double Func(double x)  // интегрируемая функция для примера
 {
   return x * x;
@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "kutuzov_i_elem_vec_average/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace kutuzov_i_elem_vec_average {
 
+namespace {
+const ppc::task::TaskRegistration<KutuzovIElemVecAverageMPI> kRegistration;
+}  // namespace
+
 KutuzovIElemVecAverageMPI::KutuzovIElemVecAverageMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
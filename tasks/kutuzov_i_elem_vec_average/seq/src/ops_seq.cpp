@@ -3,9 +3,14 @@
 #include <vector>
 
 #include "kutuzov_i_elem_vec_average/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace kutuzov_i_elem_vec_average {
 
+namespace {
+const ppc::task::TaskRegistration<KutuzovIElemVecAverageSEQ> kRegistration;
+}  // namespace
+
 KutuzovIElemVecAverageSEQ::KutuzovIElemVecAverageSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
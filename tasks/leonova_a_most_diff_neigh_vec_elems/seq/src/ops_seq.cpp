@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "leonova_a_most_diff_neigh_vec_elems/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace leonova_a_most_diff_neigh_vec_elems {
 
+namespace {
+const ppc::task::TaskRegistration<LeonovaAMostDiffNeighVecElemsSEQ> kRegistration;
+}  // namespace
+
 LeonovaAMostDiffNeighVecElemsSEQ::LeonovaAMostDiffNeighVecElemsSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -1,12 +1,12 @@
 #include <gtest/gtest.h>
 
 #include <cstddef>
-#include <random>
 #include <tuple>
 
 #include "leonova_a_most_diff_neigh_vec_elems/common/include/common.hpp"
 #include "leonova_a_most_diff_neigh_vec_elems/mpi/include/ops_mpi.hpp"
 #include "leonova_a_most_diff_neigh_vec_elems/seq/include/ops_seq.hpp"
+#include "util/include/datagen.hpp"
 #include "util/include/perf_test_util.hpp"
 
 namespace leonova_a_most_diff_neigh_vec_elems {
@@ -17,19 +17,12 @@ class MostDiffNeighVecElemsRunPerfTestsProcesses : public ppc::util::BaseRunPerf
   OutType expected_output_;
 
   void SetUp() override {
-    input_data_.resize(n_);
-
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<int> dist(-100000, 100000);
-
-    for (size_t index = 0; index < n_; ++index) {
-      input_data_[index] = dist(gen);
-    }
+    const auto seed = GetDataSeed();
+    input_data_ = ppc::util::datagen::UniformVector<int>(seed, n_, -100000, 100000);
 
     // СЛУЧАЙНАЯ поз для макс
-    std::uniform_int_distribution<size_t> pos_dist(0, n_ - 2);  // От 0 до n-2 (чтобы была пара)
-    size_t max_diff_position = pos_dist(gen);
+    // От 0 до n-2 (чтобы была пара)
+    size_t max_diff_position = ppc::util::datagen::UniformValue<size_t>(seed, n_, 0, n_ - 2);
 
     // гарантированно макс пара
     input_data_[max_diff_position] = -150000;
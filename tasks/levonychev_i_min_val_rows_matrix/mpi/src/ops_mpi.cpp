@@ -7,9 +7,14 @@
 #include <vector>
 
 #include "levonychev_i_min_val_rows_matrix/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace levonychev_i_min_val_rows_matrix {
 
+namespace {
+const ppc::task::TaskRegistration<LevonychevIMinValRowsMatrixMPI> kRegistration;
+}  // namespace
+
 LevonychevIMinValRowsMatrixMPI::LevonychevIMinValRowsMatrixMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
 
@@ -5,9 +5,14 @@
 #include <vector>
 
 #include "levonychev_i_min_val_rows_matrix/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace levonychev_i_min_val_rows_matrix {
 
+namespace {
+const ppc::task::TaskRegistration<LevonychevIMinValRowsMatrixSEQ> kRegistration;
+}  // namespace
+
 LevonychevIMinValRowsMatrixSEQ::LevonychevIMinValRowsMatrixSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
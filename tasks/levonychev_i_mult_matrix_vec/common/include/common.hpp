@@ -7,7 +7,7 @@
 
 namespace levonychev_i_mult_matrix_vec {
 
-using InType = std::tuple<std::vector<double>, int, int, std::vector<double>>;
+using InType = std::tuple<ppc::task::DistributedInput<double>, int, int, std::vector<double>>;  // A, rows, cols, x
 using OutType = std::vector<double>;
 using TestType = std::tuple<int, int>;
 using BaseTask = ppc::task::Task<InType, OutType>;
@@ -10,6 +10,9 @@ class LevonychevIMultMatrixVecMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
+  static constexpr bool AcceptsDistributedInput() {
+    return true;
+  }
   explicit LevonychevIMultMatrixVecMPI(const InType &in);
 
  private:
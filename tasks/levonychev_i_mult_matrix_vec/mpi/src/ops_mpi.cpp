@@ -5,16 +5,24 @@
 #include <cstddef>
 #include <vector>
 
+#include "dist/include/distribute.hpp"
+#include "dist/include/partition.hpp"
 #include "levonychev_i_mult_matrix_vec/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace levonychev_i_mult_matrix_vec {
 
+namespace {
+const ppc::task::TaskRegistration<LevonychevIMultMatrixVecMPI> kRegistration;
+}  // namespace
+
 LevonychevIMultMatrixVecMPI::LevonychevIMultMatrixVecMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
 
   int rank = 0;
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-  if (rank == 0) {
+  // A distributed input gives every rank its own rows; otherwise only rank 0 keeps the whole matrix
+  if (rank == 0 || std::get<0>(in).distributed) {
     GetInput() = in;
   }
   GetOutput() = {};
@@ -24,7 +32,7 @@ bool LevonychevIMultMatrixVecMPI::ValidationImpl() {
   int rank = 0;
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   if (rank == 0) {
-    const size_t matrix_size = std::get<0>(GetInput()).size();
+    const size_t matrix_size = std::get<0>(GetInput()).GlobalSize();
     const int rows = std::get<1>(GetInput());
     const int cols = std::get<2>(GetInput());
     bool is_correct_matrix_size = (matrix_size == static_cast<size_t>(rows) * static_cast<size_t>(cols));
@@ -58,11 +66,6 @@ bool LevonychevIMultMatrixVecMPI::RunImpl() {
   int cols = 0;
   std::vector<double> x;
 
-  std::vector<int> recvcounts_scatterv(proc_num);
-  std::vector<int> displs_scatterv(proc_num);
-  std::vector<int> recvcounts_gatherv(proc_num);
-  std::vector<int> displs_gatherv(proc_num);
-
   rows = std::get<1>(GetInput());
   cols = std::get<2>(GetInput());
   x = std::get<3>(GetInput());
@@ -70,20 +73,20 @@ bool LevonychevIMultMatrixVecMPI::RunImpl() {
   MPI_Bcast(&cols, 1, MPI_INT, 0, MPI_COMM_WORLD);
   x.resize(cols);
   MPI_Bcast(x.data(), cols, MPI_DOUBLE, 0, MPI_COMM_WORLD);
-  for (int i = 0; i < proc_num; ++i) {
-    int local_count_of_rows = i == (proc_num - 1) ? ((rows / proc_num) + (rows % proc_num)) : (rows / proc_num);
-    recvcounts_scatterv[i] = local_count_of_rows * cols;
-    recvcounts_gatherv[i] = local_count_of_rows;
-    int start = i * (rows / proc_num);
-    displs_scatterv[i] = start * cols;
-    displs_gatherv[i] = start;
-  }
 
-  int local_count_of_rows = (proc_rank == (proc_num - 1)) ? ((rows / proc_num) + (rows % proc_num)) : (rows / proc_num);
-  int recvcount = local_count_of_rows * cols;
-  OutType local_matrix(recvcount);
-  MPI_Scatterv(std::get<0>(GetInput()).data(), recvcounts_scatterv.data(), displs_scatterv.data(), MPI_DOUBLE,
-               local_matrix.data(), recvcount, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+  // Balanced row blocks: the remainder rows go one each to the first ranks instead of all to the last one
+  const auto row_partition = ppc::dist::Partition::Block(static_cast<std::size_t>(rows), proc_num);
+  const auto matrix_partition =
+      ppc::dist::Partition::BlockRows(static_cast<std::size_t>(rows), static_cast<std::size_t>(cols), proc_num);
+
+  const int local_count_of_rows = row_partition.GetCount(proc_rank);
+  // A distributed input already holds this rank's rows in the same layout
+  const auto &matrix = std::get<0>(GetInput());
+  OutType scattered;
+  if (!matrix.distributed) {
+    scattered = ppc::dist::Scatter<double>(matrix_partition, matrix.local);
+  }
+  const std::vector<double> &local_matrix = matrix.distributed ? matrix.local : scattered;
   OutType local_b(local_count_of_rows);
   for (int i = 0; i < local_count_of_rows; ++i) {
     const int start = cols * i;
@@ -94,8 +97,7 @@ bool LevonychevIMultMatrixVecMPI::RunImpl() {
     local_b[i] = scalar_product;
   }
 
-  MPI_Allgatherv(local_b.data(), local_count_of_rows, MPI_DOUBLE, global_b.data(), recvcounts_gatherv.data(),
-                 displs_gatherv.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+  ppc::dist::Allgather<double>(row_partition, local_b, global_b);
   return true;
 }
 
@@ -4,9 +4,14 @@
 #include <vector>
 
 #include "levonychev_i_mult_matrix_vec/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace levonychev_i_mult_matrix_vec {
 
+namespace {
+const ppc::task::TaskRegistration<LevonychevIMultMatrixVecSEQ> kRegistration;
+}  // namespace
+
 LevonychevIMultMatrixVecSEQ::LevonychevIMultMatrixVecSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -14,7 +19,7 @@ LevonychevIMultMatrixVecSEQ::LevonychevIMultMatrixVecSEQ(const InType &in) {
 }
 
 bool LevonychevIMultMatrixVecSEQ::ValidationImpl() {
-  const size_t matrix_size = std::get<0>(GetInput()).size();
+  const size_t matrix_size = std::get<0>(GetInput()).local.size();
   const int rows = std::get<1>(GetInput());
   const int cols = std::get<2>(GetInput());
   bool is_correct_matrix_size = (matrix_size == static_cast<size_t>(rows) * static_cast<size_t>(cols));
@@ -28,7 +33,7 @@ bool LevonychevIMultMatrixVecSEQ::PreProcessingImpl() {
 }
 
 bool LevonychevIMultMatrixVecSEQ::RunImpl() {
-  const std::vector<double> &matrix = std::get<0>(GetInput());
+  const std::vector<double> &matrix = std::get<0>(GetInput()).local;
   const int rows = std::get<1>(GetInput());
   const int cols = std::get<2>(GetInput());
   const std::vector<double> &vec_x = std::get<3>(GetInput());
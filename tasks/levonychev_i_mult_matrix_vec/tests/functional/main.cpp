@@ -34,7 +34,9 @@ class LevonychevIMultMatrixVecFuncTests : public ppc::util::BaseRunFuncTests<InT
     for (int i = 0; i < cols; ++i) {
       x[i] = static_cast<double>(i + 1);
     }
-    input_data_ = std::make_tuple(matrix, rows, cols, x);
+    input_data_ = std::make_tuple(
+        ppc::task::MakeWholeInput(matrix, {static_cast<std::size_t>(rows), static_cast<std::size_t>(cols)}), rows,
+        cols, x);
     output_data_.resize(rows);
     for (int i = 0; i < rows; ++i) {
       double scalar_product = 0.0;
@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <cstddef>
+#include <span>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "levonychev_i_mult_matrix_vec/common/include/common.hpp"
@@ -17,22 +19,27 @@ class LevonychevIMultMatrixVecPerfTests : public ppc::util::BaseRunPerfTests<InT
   InType input_data_;
   OutType expected_result_;
   void SetUp() override {
-    std::vector<double> matrix(static_cast<size_t>(ROWS_) * static_cast<size_t>(COLS_));
     std::vector<double> x(COLS_);
     for (int j = 0; j < COLS_; ++j) {
       x[j] = static_cast<double>((j) % 100) * 0.57932;
     }
-    for (int i = 0; i < ROWS_; ++i) {
-      for (int j = 0; j < COLS_; ++j) {
-        matrix[(i * COLS_) + j] = static_cast<double>((i + j) % 100) * 89.56916;
+    const auto cols = static_cast<std::size_t>(COLS_);
+    auto matrix_value = [cols](std::size_t index) {
+      return static_cast<double>(((index / cols) + (index % cols)) % 100) * 89.56916;
+    };
+    // Each rank of the MPI version generates only its own rows instead of receiving them from rank 0
+    auto matrix = MakeDistributedTestInput<double>(
+        {static_cast<std::size_t>(ROWS_), cols}, [&matrix_value](std::span<double> block, std::size_t first_index) {
+      for (std::size_t k = 0; k < block.size(); k++) {
+        block[k] = matrix_value(first_index + k);
       }
-    }
-    input_data_ = std::make_tuple(matrix, ROWS_, COLS_, x);
+    });
+    input_data_ = std::make_tuple(std::move(matrix), ROWS_, COLS_, x);
     expected_result_.resize(ROWS_);
     for (int i = 0; i < ROWS_; ++i) {
       double scalar_product = 0;
       for (int j = 0; j < COLS_; ++j) {
-        scalar_product += matrix[(i * COLS_) + j] * x[j];
+        scalar_product += matrix_value((static_cast<std::size_t>(i) * cols) + static_cast<std::size_t>(j)) * x[j];
       }
       expected_result_[i] = scalar_product;
     }
@@ -43,7 +50,7 @@ class LevonychevIMultMatrixVecPerfTests : public ppc::util::BaseRunPerfTests<InT
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
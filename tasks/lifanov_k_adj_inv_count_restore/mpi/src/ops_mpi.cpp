@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "lifanov_k_adj_inv_count_restore/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace lifanov_k_adj_inv_count_restore {
 
+namespace {
+const ppc::task::TaskRegistration<LifanovKAdjacentInversionCountMPI> kRegistration;
+}  // namespace
+
 LifanovKAdjacentInversionCountMPI::LifanovKAdjacentInversionCountMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
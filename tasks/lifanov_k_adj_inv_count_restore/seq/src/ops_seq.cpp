@@ -4,9 +4,14 @@
 #include <vector>
 
 #include "lifanov_k_adj_inv_count_restore/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace lifanov_k_adj_inv_count_restore {
 
+namespace {
+const ppc::task::TaskRegistration<LifanovKAdjacentInversionCountSEQ> kRegistration;
+}  // namespace
+
 LifanovKAdjacentInversionCountSEQ::LifanovKAdjacentInversionCountSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -8,9 +8,14 @@
 #include <vector>
 
 #include "liulin_y_matrix_max_column/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace liulin_y_matrix_max_column {
 
+namespace {
+const ppc::task::TaskRegistration<LiulinYMatrixMaxColumnMPI> kRegistration;
+}  // namespace
+
 int LiulinYMatrixMaxColumnMPI::TournamentMax(const std::vector<int> &column) {
   if (column.empty()) {
     return std::numeric_limits<int>::min();
@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "liulin_y_matrix_max_column/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace liulin_y_matrix_max_column {
 
+namespace {
+const ppc::task::TaskRegistration<LiulinYMatrixMaxColumnSEQ> kRegistration;
+}  // namespace
+
 LiulinYMatrixMaxColumnSEQ::LiulinYMatrixMaxColumnSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
 
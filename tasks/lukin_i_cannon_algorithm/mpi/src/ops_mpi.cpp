@@ -9,9 +9,14 @@
 #include <vector>
 
 #include "lukin_i_cannon_algorithm/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace lukin_i_cannon_algorithm {
 
+namespace {
+const ppc::task::TaskRegistration<LukinICannonAlgorithmMPI> kRegistration;
+}  // namespace
+
 LukinICannonAlgorithmMPI::LukinICannonAlgorithmMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
 
@@ -7,9 +7,14 @@
 #include <vector>
 
 #include "lukin_i_cannon_algorithm/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace lukin_i_cannon_algorithm {
 
+namespace {
+const ppc::task::TaskRegistration<LukinICannonAlgorithmSEQ> kRegistration;
+}  // namespace
+
 LukinICannonAlgorithmSEQ::LukinICannonAlgorithmSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -10,7 +10,7 @@ class LukinIElemVecSumMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit LukinIElemVecSumMPI(const InType &in);
+  explicit LukinIElemVecSumMPI(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -3,19 +3,25 @@
 #include <mpi.h>
 
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #include "lukin_i_elem_vec_sum/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace lukin_i_elem_vec_sum {
 
-LukinIElemVecSumMPI::LukinIElemVecSumMPI(const InType &in) {
+namespace {
+const ppc::task::TaskRegistration<LukinIElemVecSumMPI> kRegistration;
+}  // namespace
+
+LukinIElemVecSumMPI::LukinIElemVecSumMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
 
   int rank = 0;
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   if (rank == 0) {
-    GetInput() = in;
+    GetInput() = std::move(in);
   }
 
   GetOutput() = 0;
@@ -10,7 +10,7 @@ class LukinIElemVecSumSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit LukinIElemVecSumSEQ(const InType &in);
+  explicit LukinIElemVecSumSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
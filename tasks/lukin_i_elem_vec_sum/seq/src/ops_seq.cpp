@@ -1,15 +1,21 @@
 #include "lukin_i_elem_vec_sum/seq/include/ops_seq.hpp"
 
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #include "lukin_i_elem_vec_sum/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace lukin_i_elem_vec_sum {
 
-LukinIElemVecSumSEQ::LukinIElemVecSumSEQ(const InType &in) {
+namespace {
+const ppc::task::TaskRegistration<LukinIElemVecSumSEQ> kRegistration;
+}  // namespace
+
+LukinIElemVecSumSEQ::LukinIElemVecSumSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
@@ -1,26 +1,32 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <limits>
+#include <utility>
 #include <vector>
 
 #include "lukin_i_elem_vec_sum/common/include/common.hpp"
 #include "lukin_i_elem_vec_sum/mpi/include/ops_mpi.hpp"
 #include "lukin_i_elem_vec_sum/seq/include/ops_seq.hpp"
+#include "performance/include/performance.hpp"
 #include "util/include/perf_test_util.hpp"
 
 namespace lukin_i_elem_vec_sum {
 
 class LukinIRunPerfTestProcesses : public ppc::util::BaseRunPerfTests<InType, OutType> {
-  const int vec_size_ = 20000000;
-
   InType input_data_;
   OutType expected_result_ = 0LL;
 
   void SetUp() override {
-    input_data_ = std::vector<int>(vec_size_);
-    for (int i = 0; i < vec_size_; i++) {
+    // Elements are 1..n, so n must fit into int
+    const auto requested_size = GetRequestedInputSize();
+    ASSERT_LE(requested_size, static_cast<std::size_t>(std::numeric_limits<int>::max()));
+    const auto vec_size = static_cast<int>(requested_size);
+    input_data_ = std::vector<int>(vec_size);
+    for (int i = 0; i < vec_size; i++) {
       input_data_[i] = i + 1;
     }
-    expected_result_ = static_cast<OutType>(vec_size_) * (vec_size_ + 1) / 2;
+    expected_result_ = static_cast<OutType>(vec_size) * (vec_size + 1) / 2;
   }
 
   bool CheckTestOutputData(OutType &output_data) final {
@@ -28,7 +34,12 @@ class LukinIRunPerfTestProcesses : public ppc::util::BaseRunPerfTests<InType, Ou
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
+  }
+
+  ppc::performance::PerfWork GetWork() final {
+    const auto count = static_cast<double>(input_data_.size());
+    return {.elements = count, .bytes = count * sizeof(int), .flops = count};
   }
 };
 
@@ -36,10 +47,10 @@ TEST_P(LukinIRunPerfTestProcesses, RunPerfModes) {
   ExecuteTest(GetParam());
 }
 
-const auto kAllPerfTasks =
-    ppc::util::MakeAllPerfTasks<InType, LukinIElemVecSumMPI, LukinIElemVecSumSEQ>(PPC_SETTINGS_lukin_i_elem_vec_sum);
+const auto kAllPerfTasks = ppc::util::MakeAllSizedPerfTasks<InType, LukinIElemVecSumMPI, LukinIElemVecSumSEQ>(
+    PPC_SETTINGS_lukin_i_elem_vec_sum, {1000000, 20000000});
 
-const auto kGtestValues = ppc::util::TupleToGTestValues(kAllPerfTasks);
+const auto kGtestValues = ::testing::ValuesIn(kAllPerfTasks);
 
 const auto kPerfTestName = LukinIRunPerfTestProcesses::CustomPerfTestName;
 
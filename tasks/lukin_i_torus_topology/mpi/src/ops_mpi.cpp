@@ -8,9 +8,14 @@
 #include <vector>
 
 #include "lukin_i_torus_topology/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace lukin_i_torus_topology {
 
+namespace {
+const ppc::task::TaskRegistration<LukinIThorTopologyMPI> kRegistration;
+}  // namespace
+
 LukinIThorTopologyMPI::LukinIThorTopologyMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
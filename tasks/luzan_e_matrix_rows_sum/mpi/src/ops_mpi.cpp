@@ -7,9 +7,14 @@
 #include <vector>
 
 #include "luzan_e_matrix_rows_sum/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace luzan_e_matrix_rows_sum {
 
+namespace {
+const ppc::task::TaskRegistration<LuzanEMatrixRowsSumMPI> kRegistration;
+}  // namespace
+
 LuzanEMatrixRowsSumMPI::LuzanEMatrixRowsSumMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetOutput() = {};
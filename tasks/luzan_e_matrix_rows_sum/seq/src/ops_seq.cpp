@@ -5,9 +5,14 @@
 #include <vector>
 
 #include "luzan_e_matrix_rows_sum/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace luzan_e_matrix_rows_sum {
 
+namespace {
+const ppc::task::TaskRegistration<LuzanEMatrixRowsSumSEQ> kRegistration;
+}  // namespace
+
 LuzanEMatrixRowsSumSEQ::LuzanEMatrixRowsSumSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
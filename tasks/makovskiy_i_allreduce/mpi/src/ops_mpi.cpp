@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "makovskiy_i_allreduce/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace makovskiy_i_allreduce {
 
+namespace {
+const ppc::task::TaskRegistration<TestTaskMPI> kRegistration;
+}  // namespace
+
 TestTaskMPI::TestTaskMPI(const InType &in) {
   InType temp(in);
   this->GetInput().swap(temp);
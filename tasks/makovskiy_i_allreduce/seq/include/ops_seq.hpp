@@ -7,9 +7,8 @@ namespace makovskiy_i_allreduce {
 
 class TestTaskSEQ : public BaseTask {
  public:
-  // для покрытия
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
-    return ppc::task::TypeOfTask::kMPI;
+    return ppc::task::TypeOfTask::kSEQ;
   }
   explicit TestTaskSEQ(const InType &in);
 
@@ -4,9 +4,14 @@
 #include <vector>
 
 #include "makovskiy_i_allreduce/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace makovskiy_i_allreduce {
 
+namespace {
+const ppc::task::TaskRegistration<TestTaskSEQ> kRegistration;
+}  // namespace
+
 TestTaskSEQ::TestTaskSEQ(const InType &in) {
   InType temp(in);
   this->GetInput().swap(temp);
@@ -10,10 +10,13 @@
 #include <vector>
 
 #include "makovskiy_i_gauss_filter_vert/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace makovskiy_i_gauss_filter_vert {
 
 namespace {
+const ppc::task::TaskRegistration<GaussFilterMPI> kRegistration;
+
 
 int GetPixelValue(int x, int y, int strip_w, int total_h, int rank, const std::vector<int> &all_strip_widths,
                   const std::vector<int> &left_ghost, const std::vector<int> &right_ghost,
@@ -7,9 +7,14 @@
 #include <vector>
 
 #include "makovskiy_i_gauss_filter_vert/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace makovskiy_i_gauss_filter_vert {
 
+namespace {
+const ppc::task::TaskRegistration<GaussFilterSEQ> kRegistration;
+}  // namespace
+
 GaussFilterSEQ::GaussFilterSEQ(const InType &in) {
   InType temp(in);
   this->GetInput().swap(temp);
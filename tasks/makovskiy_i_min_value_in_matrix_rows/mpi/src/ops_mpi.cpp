@@ -6,10 +6,13 @@
 #include <vector>
 
 #include "makovskiy_i_min_value_in_matrix_rows/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace makovskiy_i_min_value_in_matrix_rows {
 
 namespace {
+const ppc::task::TaskRegistration<MinValueMPI> kRegistration;
+
 void SendDataToWorkers(const InType &matrix, int size, int rows_per_proc, int remaining_rows, int &current_row_idx) {
   for (int i = 1; i < size; ++i) {
     const int rows_for_this_proc = rows_per_proc + (i < remaining_rows ? 1 : 0);
@@ -5,9 +5,14 @@
 #include <vector>
 
 #include "makovskiy_i_min_value_in_matrix_rows/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace makovskiy_i_min_value_in_matrix_rows {
 
+namespace {
+const ppc::task::TaskRegistration<MinValueSEQ> kRegistration;
+}  // namespace
+
 MinValueSEQ::MinValueSEQ(const InType &in) {
   InType temp(in);
   this->GetInput().swap(temp);
@@ -11,9 +11,14 @@
 #include <vector>
 
 #include "maslova_u_char_frequency_count/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace maslova_u_char_frequency_count {
 
+namespace {
+const ppc::task::TaskRegistration<MaslovaUCharFrequencyCountMPI> kRegistration;
+}  // namespace
+
 MaslovaUCharFrequencyCountMPI::MaslovaUCharFrequencyCountMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -5,9 +5,14 @@
 #include <string>
 
 #include "maslova_u_char_frequency_count/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace maslova_u_char_frequency_count {
 
+namespace {
+const ppc::task::TaskRegistration<MaslovaUCharFrequencyCountSEQ> kRegistration;
+}  // namespace
+
 MaslovaUCharFrequencyCountSEQ::MaslovaUCharFrequencyCountSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -7,9 +7,14 @@
 #include <vector>
 
 #include "mityaeva_d_min_v_rows_matrix/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace mityaeva_d_min_v_rows_matrix {
 
+namespace {
+const ppc::task::TaskRegistration<MinValuesInRowsMPI> kRegistration;
+}  // namespace
+
 MinValuesInRowsMPI::MinValuesInRowsMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
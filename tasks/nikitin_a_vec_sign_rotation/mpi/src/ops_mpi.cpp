@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "nikitin_a_vec_sign_rotation/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace nikitin_a_vec_sign_rotation {
 
+namespace {
+const ppc::task::TaskRegistration<NikitinAVecSignRotationMPI> kRegistration;
+}  // namespace
+
 NikitinAVecSignRotationMPI::NikitinAVecSignRotationMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
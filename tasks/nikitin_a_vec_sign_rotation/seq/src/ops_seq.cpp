@@ -4,9 +4,14 @@
 #include <vector>
 
 #include "nikitin_a_vec_sign_rotation/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace nikitin_a_vec_sign_rotation {
 
+namespace {
+const ppc::task::TaskRegistration<NikitinAVecSignRotationSEQ> kRegistration;
+}  // namespace
+
 NikitinAVecSignRotationSEQ::NikitinAVecSignRotationSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -9,9 +9,14 @@
 #include <vector>
 
 #include "nikitina_v_max_elem_matr/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace nikitina_v_max_elem_matr {
 
+namespace {
+const ppc::task::TaskRegistration<MaxElementMatrMPI> kRegistration;
+}  // namespace
+
 MaxElementMatrMPI::MaxElementMatrMPI(const InType &in) : BaseTask() {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -7,9 +7,14 @@
 #include <vector>
 
 #include "nikitina_v_max_elem_matr/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace nikitina_v_max_elem_matr {
 
+namespace {
+const ppc::task::TaskRegistration<MaxElementMatrSEQ> kRegistration;
+}  // namespace
+
 MaxElementMatrSEQ::MaxElementMatrSEQ(const InType &in) : BaseTask() {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -8,7 +8,7 @@
 
 namespace nikitina_v_quick_sort_merge {
 
-using InType = std::vector<int>;
+using InType = ppc::task::DistributedInput<int>;
 using OutType = std::vector<int>;
 using BaseTask = ppc::task::Task<InType, OutType>;
 
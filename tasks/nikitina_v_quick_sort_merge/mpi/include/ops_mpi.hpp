@@ -10,6 +10,9 @@ class TestTaskMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
+  static constexpr bool AcceptsDistributedInput() {
+    return true;
+  }
   explicit TestTaskMPI(const InType &in);
 
  private:
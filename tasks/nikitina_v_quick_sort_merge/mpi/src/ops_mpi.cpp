@@ -3,12 +3,20 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <vector>
 
+#include "dist/include/block_range.hpp"
 #include "nikitina_v_quick_sort_merge/common/include/common.hpp"
+#include "task/include/task.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace nikitina_v_quick_sort_merge {
 
+namespace {
+const ppc::task::TaskRegistration<TestTaskMPI> kRegistration;
+}  // namespace
+
 TestTaskMPI::TestTaskMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -28,9 +36,10 @@ bool TestTaskMPI::RunImpl() {
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   MPI_Comm_size(MPI_COMM_WORLD, &size);
 
+  auto &input = GetInput();
   int total_elements = 0;
   if (rank == 0) {
-    total_elements = static_cast<int>(GetInput().size());
+    total_elements = static_cast<int>(input.GlobalSize());
   }
 
   MPI_Bcast(&total_elements, 1, MPI_INT, 0, MPI_COMM_WORLD);
@@ -42,20 +51,21 @@ bool TestTaskMPI::RunImpl() {
   std::vector<int> send_counts(size);
   std::vector<int> displs(size);
 
-  int base_count = total_elements / size;
-  int remainder = total_elements % size;
-
-  int current_displ = 0;
   for (int i = 0; i < size; ++i) {
-    send_counts[i] = base_count + (i < remainder ? 1 : 0);
-    displs[i] = current_displ;
-    current_displ += send_counts[i];
+    const auto block = ppc::dist::GetBlockRange(static_cast<std::size_t>(total_elements), size, i);
+    send_counts[i] = static_cast<int>(block.count);
+    displs[i] = static_cast<int>(block.begin);
   }
 
-  std::vector<int> local_vec(send_counts[rank]);
-
-  MPI_Scatterv(rank == 0 ? GetInput().data() : nullptr, send_counts.data(), displs.data(), MPI_INT, local_vec.data(),
-               send_counts[rank], MPI_INT, 0, MPI_COMM_WORLD);
+  // A distributed input already holds this rank's block in the same layout and is sorted where it is; sorting it
+  // again in a later run gives the same block
+  std::vector<int> scattered;
+  if (!input.distributed) {
+    scattered.resize(send_counts[rank]);
+    MPI_Scatterv(rank == 0 ? input.local.data() : nullptr, send_counts.data(), displs.data(), MPI_INT,
+                 scattered.data(), send_counts[rank], MPI_INT, 0, MPI_COMM_WORLD);
+  }
+  std::vector<int> &local_vec = input.distributed ? input.local : scattered;
 
   if (!local_vec.empty()) {
     QuickSortImpl(local_vec, 0, static_cast<int>(local_vec.size()) - 1);
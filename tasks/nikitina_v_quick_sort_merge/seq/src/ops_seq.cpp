@@ -3,9 +3,14 @@
 #include <vector>
 
 #include "nikitina_v_quick_sort_merge/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace nikitina_v_quick_sort_merge {
 
+namespace {
+const ppc::task::TaskRegistration<TestTaskSEQ> kRegistration;
+}  // namespace
+
 TestTaskSEQ::TestTaskSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -16,7 +21,7 @@ bool TestTaskSEQ::ValidationImpl() {
 }
 
 bool TestTaskSEQ::PreProcessingImpl() {
-  GetOutput() = GetInput();
+  GetOutput() = GetInput().local;
   return true;
 }
 
@@ -56,11 +56,11 @@ class RunFuncTests : public ppc::util::BaseRunFuncTests<InType, OutType, TestPar
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return ppc::task::MakeWholeInput(input_data_);
   }
 
  private:
-  InType input_data_;
+  TestParams input_data_;
 };
 
 namespace {
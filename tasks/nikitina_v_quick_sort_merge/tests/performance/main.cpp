@@ -1,28 +1,31 @@
 #include <gtest/gtest.h>
 #include <mpi.h>
 
-#include <random>
+#include <cstddef>
+#include <span>
+#include <utility>
 #include <vector>
 
 #include "nikitina_v_quick_sort_merge/common/include/common.hpp"
 #include "nikitina_v_quick_sort_merge/mpi/include/ops_mpi.hpp"
 #include "nikitina_v_quick_sort_merge/seq/include/ops_seq.hpp"
+#include "util/include/datagen.hpp"
 #include "util/include/perf_test_util.hpp"
 
 namespace nikitina_v_quick_sort_merge {
 
 class RunPerfTests : public ppc::util::BaseRunPerfTests<InType, OutType> {
  protected:
-  void SetUp() override {
-    const int count = 1000000;
-    input_data_.resize(count);
+  static constexpr std::size_t kCount = 1000000;
+  static constexpr int kMinValue = -100000;
+  static constexpr int kMaxValue = 100000;
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<int> dist(-100000, 100000);
-    for (int &val : input_data_) {
-      val = dist(gen);
-    }
+  void SetUp() override {
+    // Each rank of the MPI version generates only its own block instead of receiving it from rank 0
+    const auto seed = GetDataSeed();
+    input_data_ = MakeDistributedTestInput<int>({kCount}, [seed](std::span<int> block, std::size_t first_index) {
+      ppc::util::datagen::FillUniform<int>(block, seed, kMinValue, kMaxValue, first_index);
+    });
   }
 
   bool CheckTestOutputData(OutType &output_data) final {
@@ -33,7 +36,7 @@ class RunPerfTests : public ppc::util::BaseRunPerfTests<InType, OutType> {
       return true;
     }
 
-    std::vector<int> ref = input_data_;
+    std::vector<int> ref = ppc::util::datagen::UniformVector<int>(GetDataSeed(), kCount, kMinValue, kMaxValue);
     if (!ref.empty()) {
       QuickSortImpl(ref, 0, static_cast<int>(ref.size()) - 1);
     }
@@ -41,7 +44,7 @@ class RunPerfTests : public ppc::util::BaseRunPerfTests<InType, OutType> {
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
  private:
@@ -7,10 +7,16 @@
 #include <functional>
 #include <vector>
 
+#include "dist/include/allreduce.hpp"
 #include "nikitina_v_trans_all_one_distrib/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace nikitina_v_trans_all_one_distrib {
 
+namespace {
+const ppc::task::TaskRegistration<TestTaskMPI> kRegistration;
+}  // namespace
+
 TestTaskMPI::TestTaskMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   InType tmp = in;
@@ -27,9 +33,7 @@ bool TestTaskMPI::PreProcessingImpl() {
 
 bool TestTaskMPI::RunImpl() {
   int rank = 0;
-  int size = 0;
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-  MPI_Comm_size(MPI_COMM_WORLD, &size);
 
   int input_size = static_cast<int>(GetInput().size());
   int global_vec_size = input_size;
@@ -44,38 +48,7 @@ bool TestTaskMPI::RunImpl() {
     current_values.resize(static_cast<size_t>(global_vec_size), 0);
   }
 
-  int left_child = (2 * rank) + 1;
-  int right_child = (2 * rank) + 2;
-  int parent = (rank - 1) / 2;
-
-  MPI_Status status;
-
-  if (left_child < size) {
-    std::vector<int> recv_buf(static_cast<size_t>(global_vec_size));
-    MPI_Recv(recv_buf.data(), global_vec_size, MPI_INT, left_child, 0, MPI_COMM_WORLD, &status);
-    std::ranges::transform(current_values, recv_buf, current_values.begin(), std::plus<>());
-  }
-
-  if (right_child < size) {
-    std::vector<int> recv_buf(static_cast<size_t>(global_vec_size));
-    MPI_Recv(recv_buf.data(), global_vec_size, MPI_INT, right_child, 0, MPI_COMM_WORLD, &status);
-    std::ranges::transform(current_values, recv_buf, current_values.begin(), std::plus<>());
-  }
-
-  if (rank != 0) {
-    MPI_Send(current_values.data(), global_vec_size, MPI_INT, parent, 0, MPI_COMM_WORLD);
-  }
-
-  if (rank != 0) {
-    MPI_Recv(current_values.data(), global_vec_size, MPI_INT, parent, 1, MPI_COMM_WORLD, &status);
-  }
-
-  if (left_child < size) {
-    MPI_Send(current_values.data(), global_vec_size, MPI_INT, left_child, 1, MPI_COMM_WORLD);
-  }
-  if (right_child < size) {
-    MPI_Send(current_values.data(), global_vec_size, MPI_INT, right_child, 1, MPI_COMM_WORLD);
-  }
+  ppc::dist::Allreduce<int>(current_values, std::plus<>{}, MPI_COMM_WORLD);
 
   if (rank == 0) {
     GetOutput().resize(static_cast<size_t>(global_vec_size));
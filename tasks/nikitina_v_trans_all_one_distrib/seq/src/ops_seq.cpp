@@ -1,9 +1,14 @@
 #include "nikitina_v_trans_all_one_distrib/seq/include/ops_seq.hpp"
 
 #include "nikitina_v_trans_all_one_distrib/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace nikitina_v_trans_all_one_distrib {
 
+namespace {
+const ppc::task::TaskRegistration<TestTaskSEQ> kRegistration;
+}  // namespace
+
 TestTaskSEQ::TestTaskSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   InType tmp = in;
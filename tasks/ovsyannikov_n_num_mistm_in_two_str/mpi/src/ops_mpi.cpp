@@ -5,9 +5,14 @@
 #include <vector>
 
 #include "ovsyannikov_n_num_mistm_in_two_str/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace ovsyannikov_n_num_mistm_in_two_str {
 
+namespace {
+const ppc::task::TaskRegistration<OvsyannikovNNumMistmInTwoStrMPI> kRegistration;
+}  // namespace
+
 OvsyannikovNNumMistmInTwoStrMPI::OvsyannikovNNumMistmInTwoStrMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -4,9 +4,14 @@
 
 // Clang-Tidy требует явного подключения файла, где определен InType
 #include "ovsyannikov_n_num_mistm_in_two_str/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace ovsyannikov_n_num_mistm_in_two_str {
 
+namespace {
+const ppc::task::TaskRegistration<OvsyannikovNNumMistmInTwoStrSEQ> kRegistration;
+}  // namespace
+
 OvsyannikovNNumMistmInTwoStrSEQ::OvsyannikovNNumMistmInTwoStrSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
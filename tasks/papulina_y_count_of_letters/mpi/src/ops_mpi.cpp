@@ -7,9 +7,14 @@
 #include <string>
 
 #include "papulina_y_count_of_letters/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace papulina_y_count_of_letters {
 
+namespace {
+const ppc::task::TaskRegistration<PapulinaYCountOfLettersMPI> kRegistration;
+}  // namespace
+
 PapulinaYCountOfLettersMPI::PapulinaYCountOfLettersMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -3,9 +3,14 @@
 #include <cctype>
 
 #include "papulina_y_count_of_letters/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace papulina_y_count_of_letters {
 
+namespace {
+const ppc::task::TaskRegistration<PapulinaYCountOfLettersSEQ> kRegistration;
+}  // namespace
+
 PapulinaYCountOfLettersSEQ::PapulinaYCountOfLettersSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -12,9 +12,14 @@
 #include <vector>
 
 #include "papulina_y_simple_iteration/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace papulina_y_simple_iteration {
 
+namespace {
+const ppc::task::TaskRegistration<PapulinaYSimpleIterationMPI> kRegistration;
+}  // namespace
+
 PapulinaYSimpleIterationMPI::PapulinaYSimpleIterationMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -8,9 +8,14 @@
 #include <vector>
 
 #include "papulina_y_simple_iteration/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace papulina_y_simple_iteration {
 
+namespace {
+const ppc::task::TaskRegistration<PapulinaYSimpleIterationSEQ> kRegistration;
+}  // namespace
+
 PapulinaYSimpleIterationSEQ::PapulinaYSimpleIterationSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
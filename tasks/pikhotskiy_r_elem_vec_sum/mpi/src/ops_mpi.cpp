@@ -7,9 +7,14 @@
 #include <vector>
 
 #include "pikhotskiy_r_elem_vec_sum/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace pikhotskiy_r_elem_vec_sum {
 
+namespace {
+const ppc::task::TaskRegistration<PikhotskiyRElemVecSumMPI> kRegistration;
+}  // namespace
+
 PikhotskiyRElemVecSumMPI::PikhotskiyRElemVecSumMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
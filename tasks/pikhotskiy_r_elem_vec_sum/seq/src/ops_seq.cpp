@@ -4,8 +4,13 @@
 #include <vector>
 
 #include "pikhotskiy_r_elem_vec_sum/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace pikhotskiy_r_elem_vec_sum {
+
+namespace {
+const ppc::task::TaskRegistration<PikhotskiyRElemVecSumSEQ> kRegistration;
+}  // namespace
 PikhotskiyRElemVecSumSEQ::PikhotskiyRElemVecSumSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
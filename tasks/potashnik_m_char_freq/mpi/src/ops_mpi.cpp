@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "potashnik_m_char_freq/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace potashnik_m_char_freq {
 
+namespace {
+const ppc::task::TaskRegistration<PotashnikMCharFreqMPI> kRegistration;
+}  // namespace
+
 PotashnikMCharFreqMPI::PotashnikMCharFreqMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
 
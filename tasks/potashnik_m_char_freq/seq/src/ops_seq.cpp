@@ -3,9 +3,14 @@
 #include <string>
 
 #include "potashnik_m_char_freq/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace potashnik_m_char_freq {
 
+namespace {
+const ppc::task::TaskRegistration<PotashnikMCharFreqSEQ> kRegistration;
+}  // namespace
+
 PotashnikMCharFreqSEQ::PotashnikMCharFreqSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -8,9 +8,14 @@
 #include <vector>
 
 #include "pylaeva_s_max_elem_matrix/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace pylaeva_s_max_elem_matrix {
 
+namespace {
+const ppc::task::TaskRegistration<PylaevaSMaxElemMatrixMPI> kRegistration;
+}  // namespace
+
 PylaevaSMaxElemMatrixMPI::PylaevaSMaxElemMatrixMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
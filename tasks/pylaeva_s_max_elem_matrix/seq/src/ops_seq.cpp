@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "pylaeva_s_max_elem_matrix/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace pylaeva_s_max_elem_matrix {
 
+namespace {
+const ppc::task::TaskRegistration<PylaevaSMaxElemMatrixSEQ> kRegistration;
+}  // namespace
+
 PylaevaSMaxElemMatrixSEQ::PylaevaSMaxElemMatrixSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
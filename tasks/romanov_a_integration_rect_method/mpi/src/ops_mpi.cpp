@@ -5,9 +5,14 @@
 #include <algorithm>
 
 #include "romanov_a_integration_rect_method/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace romanov_a_integration_rect_method {
 
+namespace {
+const ppc::task::TaskRegistration<RomanovAIntegrationRectMethodMPI> kRegistration;
+}  // namespace
+
 RomanovAIntegrationRectMethodMPI::RomanovAIntegrationRectMethodMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -3,9 +3,14 @@
 #include <cmath>
 
 #include "romanov_a_integration_rect_method/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace romanov_a_integration_rect_method {
 
+namespace {
+const ppc::task::TaskRegistration<RomanovAIntegrationRectMethodSEQ> kRegistration;
+}  // namespace
+
 RomanovAIntegrationRectMethodSEQ::RomanovAIntegrationRectMethodSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
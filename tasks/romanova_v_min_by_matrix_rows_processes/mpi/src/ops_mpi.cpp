@@ -7,9 +7,14 @@
 #include <vector>
 
 #include "romanova_v_min_by_matrix_rows_processes/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace romanova_v_min_by_matrix_rows_processes {
 
+namespace {
+const ppc::task::TaskRegistration<RomanovaVMinByMatrixRowsMPI> kRegistration;
+}  // namespace
+
 RomanovaVMinByMatrixRowsMPI::RomanovaVMinByMatrixRowsMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -6,9 +6,14 @@
 #include <vector>
 
 #include "rozenberg_a_matrix_column_sum/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace rozenberg_a_matrix_column_sum {
 
+namespace {
+const ppc::task::TaskRegistration<RozenbergAMatrixColumnSumMPI> kRegistration;
+}  // namespace
+
 RozenbergAMatrixColumnSumMPI::RozenbergAMatrixColumnSumMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
 
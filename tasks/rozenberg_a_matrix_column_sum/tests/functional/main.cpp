@@ -3,6 +3,7 @@
 
 #include <array>
 #include <cstddef>
+#include <filesystem>
 #include <fstream>
 #include <string>
 #include <tuple>
@@ -11,6 +12,7 @@
 #include "rozenberg_a_matrix_column_sum/common/include/common.hpp"
 #include "rozenberg_a_matrix_column_sum/mpi/include/ops_mpi.hpp"
 #include "rozenberg_a_matrix_column_sum/seq/include/ops_seq.hpp"
+#include "util/include/binary_data.hpp"
 #include "util/include/func_test_util.hpp"
 #include "util/include/perf_test_util.hpp"
 #include "util/include/util.hpp"
@@ -98,6 +100,36 @@ const auto kPerfTestName = RozenbergAMatrixColumnFuncTests::PrintFuncTestName<Ro
 
 INSTANTIATE_TEST_SUITE_P(PicMatrixTests, RozenbergAMatrixColumnFuncTests, kGtestValues, kPerfTestName);
 
+// No binary data is shipped, so the layout read by the performance test is produced here from a text case
+TEST(RozenbergAMatrixColumnSumBinaryData, ConvertedCaseGivesExpectedSums) {
+  const auto dir = std::filesystem::temp_directory_path() /
+                   ("ppc_rozenberg_a_matrix_column_sum_" + std::to_string(ppc::util::GetMPIRank()));
+  std::filesystem::create_directories(dir);
+  const auto binary_path = (dir / "random_data_test.ppcb").string();
+  ppc::util::ConvertTextToBinary(
+      ppc::util::GetAbsoluteTaskPath(PPC_ID_rozenberg_a_matrix_column_sum, "random_data_test.txt"), binary_path,
+      ppc::util::DType::kInt32, {2, 0});
+
+  InType input;
+  OutType expected;
+  {
+    const ppc::util::BinaryDataFile file(binary_path);
+    const auto matrix = file.GetArray<int>(0);
+    const auto columns = static_cast<std::size_t>(file.GetArrayShape(0).at(1));
+    for (std::size_t offset = 0; offset < matrix.size(); offset += columns) {
+      input.emplace_back(matrix.begin() + static_cast<std::ptrdiff_t>(offset),
+                         matrix.begin() + static_cast<std::ptrdiff_t>(offset + columns));
+    }
+    const auto expected_values = file.GetArray<int>(1);
+    expected.assign(expected_values.begin(), expected_values.end());
+  }
+  std::filesystem::remove_all(dir);
+
+  RozenbergAMatrixColumnSumSEQ task(input);
+  ASSERT_TRUE(task.Validation() && task.PreProcessing() && task.Run() && task.PostProcessing());
+  EXPECT_EQ(task.GetOutput(), expected);
+}
+
 }  // namespace
 
 }  // namespace rozenberg_a_matrix_column_sum
@@ -8,6 +8,7 @@
 #include "rozenberg_a_matrix_column_sum/common/include/common.hpp"
 #include "rozenberg_a_matrix_column_sum/mpi/include/ops_mpi.hpp"
 #include "rozenberg_a_matrix_column_sum/seq/include/ops_seq.hpp"
+#include "util/include/binary_data.hpp"
 #include "util/include/perf_test_util.hpp"
 #include "util/include/util.hpp"
 
@@ -19,28 +20,49 @@ class RozenbergAMatrixColumnSumPerfTests : public ppc::util::BaseRunPerfTests<In
     output_data_.clear();
     if (CheckTestAndRank()) {
       std::string abs_path = ppc::util::GetAbsoluteTaskPath(PPC_ID_rozenberg_a_matrix_column_sum, "perf_test.txt");
-      std::ifstream file(abs_path);
-
-      if (file.is_open()) {
-        int rows = 0;
-        int columns = 0;
-        file >> rows >> columns;
-
-        InType input_data(rows, std::vector<int>(columns));
-        for (int i = 0; i < rows; i++) {
-          for (int j = 0; j < columns; j++) {
-            file >> input_data[i][j];
-          }
-        }
+      if (ppc::util::IsBinaryDataPath(abs_path)) {
+        ReadBinaryData(abs_path);
+      } else {
+        ReadTextData(abs_path);
+      }
+    }
+  }
+
+  void ReadTextData(const std::string &abs_path) {
+    std::ifstream file(abs_path);
+
+    if (file.is_open()) {
+      int rows = 0;
+      int columns = 0;
+      file >> rows >> columns;
 
-        OutType output_data(columns);
-        for (int i = 0; i < columns; i++) {
-          file >> output_data[i];
+      InType input_data(rows, std::vector<int>(columns));
+      for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < columns; j++) {
+          file >> input_data[i][j];
         }
-        input_data_ = input_data;
-        output_data_ = output_data;
       }
+
+      OutType output_data(columns);
+      for (int i = 0; i < columns; i++) {
+        file >> output_data[i];
+      }
+      input_data_ = input_data;
+      output_data_ = output_data;
+    }
+  }
+
+  // Produced with: ppc_convert_data perf_test.txt int32 2,0
+  void ReadBinaryData(const std::string &abs_path) {
+    const ppc::util::BinaryDataFile file(abs_path);
+    const auto matrix = file.GetArray<int>(0);
+    const auto columns = static_cast<std::size_t>(file.GetArrayShape(0).at(1));
+    for (std::size_t offset = 0; offset < matrix.size(); offset += columns) {
+      input_data_.emplace_back(matrix.begin() + static_cast<std::ptrdiff_t>(offset),
+                               matrix.begin() + static_cast<std::ptrdiff_t>(offset + columns));
     }
+    const auto expected = file.GetArray<int>(1);
+    output_data_.assign(expected.begin(), expected.end());
   }
 
   bool CheckTestOutputData(OutType &output_data) final {
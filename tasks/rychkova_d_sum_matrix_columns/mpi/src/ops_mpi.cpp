@@ -7,9 +7,14 @@
 #include <vector>
 
 #include "rychkova_d_sum_matrix_columns/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace rychkova_d_sum_matrix_columns {
 
+namespace {
+const ppc::task::TaskRegistration<RychkovaDSumMatrixColumnsMPI> kRegistration;
+}  // namespace
+
 RychkovaDSumMatrixColumnsMPI::RychkovaDSumMatrixColumnsMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput().resize(in.size());
@@ -4,9 +4,14 @@
 #include <vector>
 
 #include "rychkova_d_sum_matrix_columns/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace rychkova_d_sum_matrix_columns {
 
+namespace {
+const ppc::task::TaskRegistration<RychkovaDSumMatrixColumnsSEQ> kRegistration;
+}  // namespace
+
 RychkovaDSumMatrixColumnsSEQ::RychkovaDSumMatrixColumnsSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput().resize(in.size());
@@ -9,9 +9,14 @@
 #include <vector>
 
 #include "sakharov_a_num_of_letters/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace sakharov_a_num_of_letters {
 
+namespace {
+const ppc::task::TaskRegistration<SakharovANumberOfLettersMPI> kRegistration;
+}  // namespace
+
 SakharovANumberOfLettersMPI::SakharovANumberOfLettersMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
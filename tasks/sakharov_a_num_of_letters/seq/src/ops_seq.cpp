@@ -5,9 +5,14 @@
 #include <utility>
 
 #include "sakharov_a_num_of_letters/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace sakharov_a_num_of_letters {
 
+namespace {
+const ppc::task::TaskRegistration<SakharovANumberOfLettersSEQ> kRegistration;
+}  // namespace
+
 SakharovANumberOfLettersSEQ::SakharovANumberOfLettersSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
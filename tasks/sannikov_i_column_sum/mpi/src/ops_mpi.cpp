@@ -8,9 +8,14 @@
 #include <vector>
 
 #include "sannikov_i_column_sum/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace sannikov_i_column_sum {
 
+namespace {
+const ppc::task::TaskRegistration<SannikovIColumnSumMPI> kRegistration;
+}  // namespace
+
 SannikovIColumnSumMPI::SannikovIColumnSumMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   auto &input_buffer = GetInput();
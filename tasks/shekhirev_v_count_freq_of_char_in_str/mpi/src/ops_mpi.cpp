@@ -8,9 +8,14 @@
 #include <vector>
 
 #include "../../common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace shekhirev_v_char_freq_mpi {
 
+namespace {
+const ppc::task::TaskRegistration<CharFreqMPI> kRegistration;
+}  // namespace
+
 CharFreqMPI::CharFreqMPI(const shekhirev_v_char_freq_seq::InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
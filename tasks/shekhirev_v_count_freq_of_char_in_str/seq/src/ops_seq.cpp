@@ -1,9 +1,14 @@
 #include "../include/ops_seq.hpp"
 
 #include "../../common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace shekhirev_v_char_freq_seq {
 
+namespace {
+const ppc::task::TaskRegistration<CharFreqSequential> kRegistration;
+}  // namespace
+
 CharFreqSequential::CharFreqSequential(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
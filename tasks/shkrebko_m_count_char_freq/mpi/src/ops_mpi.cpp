@@ -7,9 +7,14 @@
 #include <vector>
 
 #include "shkrebko_m_count_char_freq/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace shkrebko_m_count_char_freq {
 
+namespace {
+const ppc::task::TaskRegistration<ShkrebkoMCountCharFreqMPI> kRegistration;
+}  // namespace
+
 ShkrebkoMCountCharFreqMPI::ShkrebkoMCountCharFreqMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -4,9 +4,14 @@
 #include <string>
 
 #include "shkrebko_m_count_char_freq/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace shkrebko_m_count_char_freq {
 
+namespace {
+const ppc::task::TaskRegistration<ShkrebkoMCountCharFreqSEQ> kRegistration;
+}  // namespace
+
 ShkrebkoMCountCharFreqSEQ::ShkrebkoMCountCharFreqSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
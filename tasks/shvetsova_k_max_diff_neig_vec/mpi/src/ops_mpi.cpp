@@ -10,9 +10,14 @@
 #include <vector>
 
 #include "shvetsova_k_max_diff_neig_vec/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace shvetsova_k_max_diff_neig_vec {
 
+namespace {
+const ppc::task::TaskRegistration<ShvetsovaKMaxDiffNeigVecMPI> kRegistration;
+}  // namespace
+
 ShvetsovaKMaxDiffNeigVecMPI::ShvetsovaKMaxDiffNeigVecMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
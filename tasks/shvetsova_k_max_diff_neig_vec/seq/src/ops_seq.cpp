@@ -4,9 +4,14 @@
 #include <utility>
 
 #include "shvetsova_k_max_diff_neig_vec/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace shvetsova_k_max_diff_neig_vec {
 
+namespace {
+const ppc::task::TaskRegistration<ShvetsovaKMaxDiffNeigVecSEQ> kRegistration;
+}  // namespace
+
 ShvetsovaKMaxDiffNeigVecSEQ::ShvetsovaKMaxDiffNeigVecSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
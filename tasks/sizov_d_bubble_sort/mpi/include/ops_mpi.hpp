@@ -1,7 +1,5 @@
 #pragma once
 
-#include <vector>
-
 #include "sizov_d_bubble_sort/common/include/common.hpp"
 #include "task/include/task.hpp"
 
@@ -16,8 +14,6 @@ class SizovDBubbleSortMPI : public BaseTask {
   explicit SizovDBubbleSortMPI(const InType &in);
 
  private:
-  std::vector<int> data_;
-
   bool ValidationImpl() override;
   bool PreProcessingImpl() override;
   bool RunImpl() override;
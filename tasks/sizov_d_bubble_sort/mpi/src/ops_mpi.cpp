@@ -3,27 +3,21 @@
 #include <mpi.h>
 
 #include <algorithm>
-#include <vector>
+#include <cstddef>
+#include <span>
 
+#include "dist/include/distribute.hpp"
+#include "dist/include/partition.hpp"
 #include "sizov_d_bubble_sort/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace sizov_d_bubble_sort {
 
 namespace {
+const ppc::task::TaskRegistration<SizovDBubbleSortMPI> kRegistration;
 
-void ComputeScatterInfo(int total, int size, std::vector<int> &counts, std::vector<int> &displs) {
-  const int base = total / size;
-  const int rem = total % size;
 
-  int offset = 0;
-  for (int i = 0; i < size; ++i) {
-    counts[i] = base + (i < rem ? 1 : 0);
-    displs[i] = offset;
-    offset += counts[i];
-  }
-}
-
-void LocalOddEvenPass(std::vector<int> &local, int global_start, int parity) {
+void LocalOddEvenPass(std::span<int> local, int global_start, int parity) {
   const int n = static_cast<int>(local.size());
   for (int i = 0; i + 1 < n; ++i) {
     const int gidx = global_start + i;
@@ -35,9 +29,9 @@ void LocalOddEvenPass(std::vector<int> &local, int global_start, int parity) {
   }
 }
 
-void ExchangeBoundary(std::vector<int> &local, const std::vector<int> &counts, int rank, int partner) {
+void ExchangeBoundary(std::span<int> local, const ppc::dist::Partition &partition, int rank, int partner) {
   const int local_n = static_cast<int>(local.size());
-  const int partner_n = counts[partner];
+  const int partner_n = partition.GetCount(partner);
 
   if (local_n == 0 || partner_n == 0) {
     return;
@@ -57,14 +51,13 @@ void ExchangeBoundary(std::vector<int> &local, const std::vector<int> &counts, i
   }
 }
 
-void OddEvenPhase(std::vector<int> &local, const std::vector<int> &counts, const std::vector<int> &displs, int rank,
-                  int size, int phase) {
+void OddEvenPhase(std::span<int> local, const ppc::dist::Partition &partition, int rank, int size, int phase) {
   if (local.empty()) {
     return;
   }
 
   const int parity = phase % 2;
-  const int global_start = displs[rank];
+  const int global_start = partition.GetDispl(rank);
 
   LocalOddEvenPass(local, global_start, parity);
 
@@ -74,7 +67,7 @@ void OddEvenPhase(std::vector<int> &local, const std::vector<int> &counts, const
   int partner = (even_phase == even_rank) ? rank + 1 : rank - 1;
 
   if (partner >= 0 && partner < size) {
-    ExchangeBoundary(local, counts, rank, partner);
+    ExchangeBoundary(local, partition, rank, partner);
   }
 }
 
@@ -96,7 +89,6 @@ bool SizovDBubbleSortMPI::ValidationImpl() {
 }
 
 bool SizovDBubbleSortMPI::PreProcessingImpl() {
-  data_ = GetInput();
   return true;
 }
 
@@ -106,46 +98,34 @@ bool SizovDBubbleSortMPI::RunImpl() {
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   MPI_Comm_size(MPI_COMM_WORLD, &size);
 
-  int n = (rank == 0 ? static_cast<int>(data_.size()) : 0);
+  int n = (rank == 0 ? static_cast<int>(GetInput().size()) : 0);
   MPI_Bcast(&n, 1, MPI_INT, 0, MPI_COMM_WORLD);
 
   if (n <= 1) {
-    if (rank != 0) {
-      data_.assign(n, 0);
+    if (rank == 0) {
+      GetOutput() = GetInput();
+    } else {
+      GetOutput().assign(n, 0);
     }
     if (n > 0) {
-      MPI_Bcast(data_.data(), n, MPI_INT, 0, MPI_COMM_WORLD);
+      MPI_Bcast(GetOutput().data(), n, MPI_INT, 0, MPI_COMM_WORLD);
     }
-    GetOutput() = data_;
     return true;
   }
 
-  std::vector<int> counts(size);
-  std::vector<int> displs(size);
-  ComputeScatterInfo(n, size, counts, displs);
+  const auto partition = ppc::dist::Partition::Block(static_cast<std::size_t>(n), size);
 
-  const int local_n = counts[rank];
-  std::vector<int> local(local_n);
-
-  MPI_Scatterv((rank == 0 ? data_.data() : nullptr), counts.data(), displs.data(), MPI_INT, local.data(), local_n,
-               MPI_INT, 0, MPI_COMM_WORLD);
+  // The block is reused by every following Run() instead of being reallocated
+  const auto local = GetScratch<int>(partition.GetCount(rank));
+  ppc::dist::Scatter<int>(partition, GetInput(), local);
 
   for (int phase = 0; phase < n; ++phase) {
-    OddEvenPhase(local, counts, displs, rank, size, phase);
-  }
-
-  std::vector<int> result(n);
-  MPI_Gatherv(local.data(), local_n, MPI_INT, result.data(), counts.data(), displs.data(), MPI_INT, 0, MPI_COMM_WORLD);
-
-  if (rank == 0) {
-    GetOutput() = result;
-  } else {
-    GetOutput().assign(n, 0);
+    OddEvenPhase(local, partition, rank, size, phase);
   }
 
-  if (n > 0) {
-    MPI_Bcast(GetOutput().data(), n, MPI_INT, 0, MPI_COMM_WORLD);
-  }
+  GetOutput().resize(n);
+  ppc::dist::Gather<int>(partition, local, GetOutput());
+  MPI_Bcast(GetOutput().data(), n, MPI_INT, 0, MPI_COMM_WORLD);
 
   return true;
 }
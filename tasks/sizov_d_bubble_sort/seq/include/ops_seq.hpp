@@ -1,6 +1,6 @@
 #pragma once
 
-#include <vector>
+#include <span>
 
 #include "sizov_d_bubble_sort/common/include/common.hpp"
 #include "task/include/task.hpp"
@@ -16,7 +16,7 @@ class SizovDBubbleSortSEQ : public BaseTask {
   explicit SizovDBubbleSortSEQ(const InType &in);
 
  private:
-  std::vector<int> data_;
+  std::span<int> data_;
 
   bool ValidationImpl() override;
   bool PreProcessingImpl() override;
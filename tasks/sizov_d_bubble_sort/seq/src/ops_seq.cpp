@@ -1,13 +1,18 @@
 #include "sizov_d_bubble_sort/seq/include/ops_seq.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <utility>
-#include <vector>
 
 #include "sizov_d_bubble_sort/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace sizov_d_bubble_sort {
 
+namespace {
+const ppc::task::TaskRegistration<SizovDBubbleSortSEQ> kRegistration;
+}  // namespace
+
 SizovDBubbleSortSEQ::SizovDBubbleSortSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -20,7 +25,8 @@ bool SizovDBubbleSortSEQ::ValidationImpl() {
 }
 
 bool SizovDBubbleSortSEQ::PreProcessingImpl() {
-  data_ = GetInput();
+  data_ = GetScratch<int>(GetInput().size());
+  std::ranges::copy(GetInput(), data_.begin());
   return true;
 }
 
@@ -53,7 +59,7 @@ bool SizovDBubbleSortSEQ::RunImpl() {
 }
 
 bool SizovDBubbleSortSEQ::PostProcessingImpl() {
-  GetOutput() = data_;
+  GetOutput().assign(data_.begin(), data_.end());
   return true;
 }
 
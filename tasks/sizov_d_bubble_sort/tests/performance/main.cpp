@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <tuple>
 #include <vector>
 
 #include "sizov_d_bubble_sort/common/include/common.hpp"
@@ -46,8 +47,10 @@ TEST_P(SizovDRunPerfTestsBubbleSort, RunPerfModes) {
   ExecuteTest(GetParam());
 }
 
-const auto kAllPerfTasks =
-    ppc::util::MakeAllPerfTasks<InType, SizovDBubbleSortMPI, SizovDBubbleSortSEQ>(PPC_SETTINGS_sizov_d_bubble_sort);
+const auto kAllPerfTasks = std::tuple_cat(
+    ppc::util::MakeAllPerfTasks<InType, SizovDBubbleSortMPI, SizovDBubbleSortSEQ>(PPC_SETTINGS_sizov_d_bubble_sort),
+    ppc::util::MakeAllWarmPerfTasks<InType, SizovDBubbleSortMPI, SizovDBubbleSortSEQ>(
+        PPC_SETTINGS_sizov_d_bubble_sort));
 
 const auto kGtestValues = ppc::util::TupleToGTestValues(kAllPerfTasks);
 
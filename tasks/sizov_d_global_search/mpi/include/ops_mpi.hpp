@@ -33,8 +33,6 @@ class SizovDGlobalSearchMPI : public BaseTask {
     int idx = -1;
   };
 
-  static void GetChunk(std::size_t intervals, int rank, int size, std::size_t &begin, std::size_t &end);
-
   [[nodiscard]] double EstimateM(double reliability, int rank, int size) const;
   [[nodiscard]] double Characteristic(std::size_t i, double m) const;
   [[nodiscard]] double NewPoint(std::size_t i, double m) const;
@@ -9,10 +9,16 @@
 #include <limits>
 #include <vector>
 
+#include "dist/include/block_range.hpp"
 #include "sizov_d_global_search/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace sizov_d_global_search {
 
+namespace {
+const ppc::task::TaskRegistration<SizovDGlobalSearchMPI> kRegistration;
+}  // namespace
+
 SizovDGlobalSearchMPI::SizovDGlobalSearchMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -90,24 +96,6 @@ bool SizovDGlobalSearchMPI::PreProcessingImpl() {
   return true;
 }
 
-void SizovDGlobalSearchMPI::GetChunk(std::size_t intervals, int rank, int size, std::size_t &begin, std::size_t &end) {
-  if (intervals == 0U || size <= 0) {
-    begin = 0;
-    end = 0;
-    return;
-  }
-
-  const auto s = static_cast<std::size_t>(size);
-  const auto r = static_cast<std::size_t>(rank);
-
-  const std::size_t base = intervals / s;
-  const std::size_t rem = intervals % s;
-
-  begin = (r * base) + std::min(r, rem);
-  end = begin + base + ((r < rem) ? 1U : 0U);
-  end = std::min(end, intervals);
-}
-
 double SizovDGlobalSearchMPI::EstimateM(double reliability, int rank, int size) const {
   constexpr double kMinSlope = 1e-2;
 
@@ -118,12 +106,10 @@ double SizovDGlobalSearchMPI::EstimateM(double reliability, int rank, int size)
 
   const std::size_t intervals = n - 1U;
 
-  std::size_t begin = 0;
-  std::size_t end = 0;
-  GetChunk(intervals, rank, size, begin, end);
+  const auto chunk = ppc::dist::GetBlockRange(intervals, size, rank);
 
   double local_max = 0.0;
-  for (std::size_t k = begin; k < end; ++k) {
+  for (std::size_t k = chunk.begin; k < chunk.begin + chunk.count; ++k) {
     const std::size_t i = k + 1U;
 
     const double dx = x_[i] - x_[i - 1U];
@@ -192,11 +178,9 @@ SizovDGlobalSearchMPI::IntervalChar SizovDGlobalSearchMPI::ComputeLocalBestInter
 
   const std::size_t intervals = n - 1U;
 
-  std::size_t begin = 0;
-  std::size_t end = 0;
-  GetChunk(intervals, rank, size, begin, end);
+  const auto chunk = ppc::dist::GetBlockRange(intervals, size, rank);
 
-  for (std::size_t k = begin; k < end; ++k) {
+  for (std::size_t k = chunk.begin; k < chunk.begin + chunk.count; ++k) {
     const std::size_t i = k + 1U;
     const double c = Characteristic(i, m);
     if (c > res.characteristic) {
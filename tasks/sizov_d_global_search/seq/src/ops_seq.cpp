@@ -8,9 +8,14 @@
 #include <vector>
 
 #include "sizov_d_global_search/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace sizov_d_global_search {
 
+namespace {
+const ppc::task::TaskRegistration<SizovDGlobalSearchSEQ> kRegistration;
+}  // namespace
+
 SizovDGlobalSearchSEQ::SizovDGlobalSearchSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
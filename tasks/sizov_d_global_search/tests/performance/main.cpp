@@ -54,12 +54,8 @@ auto BuildPerfTestParams() {
   std::vector<ppc::util::PerfTestParam<InType, OutType>> result;
   result.reserve(kSize);
 
-  ForEachTupleElement(tuple_tasks, [&result](const auto &task_tuple) {
-    const auto &task_getter = std::get<static_cast<std::size_t>(ppc::util::GTestParamIndex::kTaskGetter)>(task_tuple);
-    const auto &name = std::get<static_cast<std::size_t>(ppc::util::GTestParamIndex::kNameTest)>(task_tuple);
-    const auto &mode = std::get<static_cast<std::size_t>(ppc::util::GTestParamIndex::kTestParams)>(task_tuple);
-    result.emplace_back(task_getter, name, mode);
-  }, std::make_index_sequence<kSize>{});
+  ForEachTupleElement(tuple_tasks, [&result](const auto &task_tuple) { result.emplace_back(task_tuple); },
+                      std::make_index_sequence<kSize>{});
 
   return result;
 }
@@ -5,9 +5,14 @@
 #include <vector>
 
 #include "sizov_d_string_mismatch_count/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace sizov_d_string_mismatch_count {
 
+namespace {
+const ppc::task::TaskRegistration<SizovDStringMismatchCountMPI> kRegistration;
+}  // namespace
+
 SizovDStringMismatchCountMPI::SizovDStringMismatchCountMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
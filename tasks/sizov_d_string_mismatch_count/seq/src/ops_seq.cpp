@@ -4,9 +4,14 @@
 #include <string>
 
 #include "sizov_d_string_mismatch_count/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace sizov_d_string_mismatch_count {
 
+namespace {
+const ppc::task::TaskRegistration<SizovDStringMismatchCountSEQ> kRegistration;
+}  // namespace
+
 SizovDStringMismatchCountSEQ::SizovDStringMismatchCountSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
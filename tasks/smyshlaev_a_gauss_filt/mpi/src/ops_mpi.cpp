@@ -11,10 +11,13 @@
 
 #include "smyshlaev_a_gauss_filt/common/include/common.hpp"
 #include "smyshlaev_a_gauss_filt/seq/include/ops_seq.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace smyshlaev_a_gauss_filt {
 
 namespace {
+const ppc::task::TaskRegistration<SmyshlaevAGaussFiltMPI> kRegistration;
+
 const std::vector<int> kErnel = {1, 2, 1, 2, 4, 2, 1, 2, 1};
 const int kErnelSum = 16;
 
@@ -6,10 +6,13 @@
 #include <vector>
 
 #include "smyshlaev_a_gauss_filt/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace smyshlaev_a_gauss_filt {
 
 namespace {
+const ppc::task::TaskRegistration<SmyshlaevAGaussFiltSEQ> kRegistration;
+
 int GetPixelClamped(const InType &img, int x, int y, int ch) {
   const int w = img.width;
   const int h = img.height;
@@ -7,10 +7,13 @@
 #include <vector>
 
 #include "smyshlaev_a_mat_mul/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace smyshlaev_a_mat_mul {
 
 namespace {
+const ppc::task::TaskRegistration<SmyshlaevAMatMulMPI> kRegistration;
+
 
 void CalculateDistribution(int total_len, int proc_count, std::vector<int> &counts, std::vector<int> &offsets) {
   const int chunk = total_len / proc_count;
@@ -4,9 +4,14 @@
 #include <vector>
 
 #include "smyshlaev_a_mat_mul/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace smyshlaev_a_mat_mul {
 
+namespace {
+const ppc::task::TaskRegistration<SmyshlaevAMatMulSEQ> kRegistration;
+}  // namespace
+
 SmyshlaevAMatMulSEQ::SmyshlaevAMatMulSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -7,10 +7,13 @@
 #include <vector>
 
 #include "smyshlaev_a_str_order_check/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace smyshlaev_a_str_order_check {
 
 namespace {
+const ppc::task::TaskRegistration<SmyshlaevAStrOrderCheckMPI> kRegistration;
+
 
 int CompareBuffers(const char *s1, const char *s2, int len) {
   for (int i = 0; i < len; ++i) {
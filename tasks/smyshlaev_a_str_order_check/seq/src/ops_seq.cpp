@@ -5,9 +5,14 @@
 #include <utility>
 
 #include "smyshlaev_a_str_order_check/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace smyshlaev_a_str_order_check {
 
+namespace {
+const ppc::task::TaskRegistration<SmyshlaevAStrOrderCheckSEQ> kRegistration;
+}  // namespace
+
 SmyshlaevAStrOrderCheckSEQ::SmyshlaevAStrOrderCheckSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
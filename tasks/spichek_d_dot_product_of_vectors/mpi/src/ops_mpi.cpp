@@ -8,9 +8,14 @@
 #include <vector>
 
 #include "spichek_d_dot_product_of_vectors/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace spichek_d_dot_product_of_vectors {
 
+namespace {
+const ppc::task::TaskRegistration<SpichekDDotProductOfVectorsMPI> kRegistration;
+}  // namespace
+
 SpichekDDotProductOfVectorsMPI::SpichekDDotProductOfVectorsMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
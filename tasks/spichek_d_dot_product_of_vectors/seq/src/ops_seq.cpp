@@ -3,9 +3,14 @@
 #include <cstddef>
 
 #include "spichek_d_dot_product_of_vectors/common/include/common.hpp"
+#include "task/include/task_registry.hpp"
 
 namespace spichek_d_dot_product_of_vectors {
 
+namespace {
+const ppc::task::TaskRegistration<SpichekDDotProductOfVectorsSEQ> kRegistration;
+}  // namespace
+
 SpichekDDotProductOfVectorsSEQ::SpichekDDotProductOfVectorsSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
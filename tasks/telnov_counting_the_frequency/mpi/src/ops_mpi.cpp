@@ -5,12 +5,19 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
-#include <string>
+#include <span>
 
+#include "dist/include/block_range.hpp"
+#include "dist/include/node_collectives.hpp"
+#include "task/include/task_registry.hpp"
 #include "telnov_counting_the_frequency/common/include/common.hpp"
 
 namespace telnov_counting_the_frequency {
 
+namespace {
+const ppc::task::TaskRegistration<TelnovCountingTheFrequencyMPI> kRegistration;
+}  // namespace
+
 TelnovCountingTheFrequencyMPI::TelnovCountingTheFrequencyMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -32,36 +39,15 @@ bool TelnovCountingTheFrequencyMPI::RunImpl() {
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   MPI_Comm_size(MPI_COMM_WORLD, &size);
 
-  uint64_t n = 0;
-  if (rank == 0) {
-    n = static_cast<uint64_t>(GlobalData::g_data_string.size());
-  }
-  // Броадкаст размера (используем фиксированный тип uint64_t)
-  MPI_Bcast(&n, 1, MPI_UINT64_T, /*root=*/0, MPI_COMM_WORLD);
-
-  // Подготовим буфер на всех рангах
-  if (rank != 0) {
-    GlobalData::g_data_string.clear();
-    GlobalData::g_data_string.resize(static_cast<size_t>(n), '\0');
-  }
-
-  if (n > 0) {
-    // Передаём данные
-    MPI_Bcast(const_cast<char *>(GlobalData::g_data_string.data()), static_cast<int>(n), MPI_CHAR, /*root=*/0,
-              MPI_COMM_WORLD);
-  }
-
-  // Теперь все ранги имеют одинаковую g_data_string
-  const std::string &s = GlobalData::g_data_string;
-  size_t total_length = s.size();
+  // Строка хранится в одном экземпляре на узел, ранги читают её на месте
+  const auto shared = ppc::dist::BcastShared<char>(GlobalData::g_data_string);
+  const std::span<const char> s = shared.Get();
 
-  // Разбиение работы между ранги
-  size_t chunk = total_length / static_cast<size_t>(size);
-  size_t start = static_cast<size_t>(rank) * chunk;
-  size_t end = (rank == size - 1 ? total_length : start + chunk);
+  // Разбиение работы между рангами поровну
+  const auto range = ppc::dist::GetBlockRange(s.size(), size, rank);
 
   int64_t local = 0;
-  for (size_t i = start; i < end; i++) {
+  for (size_t i = range.begin; i < range.begin + range.count; i++) {
     if (s[i] == 'X') {
       local++;
     }
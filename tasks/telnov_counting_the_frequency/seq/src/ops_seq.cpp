@@ -4,10 +4,15 @@
 #include <cstdint>
 #include <string>
 
+#include "task/include/task_registry.hpp"
 #include "telnov_counting_the_frequency/common/include/common.hpp"
 
 namespace telnov_counting_the_frequency {
 
+namespace {
+const ppc::task::TaskRegistration<TelnovCountingTheFrequencySEQ> kRegistration;
+}  // namespace
+
 TelnovCountingTheFrequencySEQ::TelnovCountingTheFrequencySEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -7,10 +7,15 @@
 #include <cstddef>
 #include <vector>
 
+#include "task/include/task_registry.hpp"
 #include "telnov_strongin_algorithm/common/include/common.hpp"
 
 namespace telnov_strongin_algorithm {
 
+namespace {
+const ppc::task::TaskRegistration<TelnovStronginAlgorithmMPI> kRegistration;
+}  // namespace
+
 struct MaxData {
   double value{};
   int index{};
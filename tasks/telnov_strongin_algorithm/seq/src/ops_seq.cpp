@@ -5,10 +5,15 @@
 #include <cstddef>
 #include <vector>
 
+#include "task/include/task_registry.hpp"
 #include "telnov_strongin_algorithm/common/include/common.hpp"
 
 namespace telnov_strongin_algorithm {
 
+namespace {
+const ppc::task::TaskRegistration<TelnovStronginAlgorithmSEQ> kRegistration;
+}  // namespace
+
 TelnovStronginAlgorithmSEQ::TelnovStronginAlgorithmSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -5,6 +5,8 @@
 #include <cstdlib>
 #include <type_traits>
 
+#include "task/include/task_registry.hpp"
+
 namespace telnov_transfer_one_all {
 
 template <typename T>
@@ -87,4 +89,9 @@ template class TelnovTransferOneAllMPI<int>;
 template class TelnovTransferOneAllMPI<float>;
 template class TelnovTransferOneAllMPI<double>;
 
+namespace {
+// The tests run the int instantiation
+const ppc::task::TaskRegistration<TelnovTransferOneAllMPI<int>> kRegistration;
+}  // namespace
+
 }  // namespace telnov_transfer_one_all
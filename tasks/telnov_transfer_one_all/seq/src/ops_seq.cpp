@@ -1,5 +1,7 @@
 #include "telnov_transfer_one_all/seq/include/ops_seq.hpp"
 
+#include "task/include/task_registry.hpp"
+
 namespace telnov_transfer_one_all {
 
 template <typename T>
@@ -34,4 +36,9 @@ template class TelnovTransferOneAllSEQ<int>;
 template class TelnovTransferOneAllSEQ<float>;
 template class TelnovTransferOneAllSEQ<double>;
 
+namespace {
+// The tests run the int instantiation
+const ppc::task::TaskRegistration<TelnovTransferOneAllSEQ<int>> kRegistration;
+}  // namespace
+
 }  // namespace telnov_transfer_one_all
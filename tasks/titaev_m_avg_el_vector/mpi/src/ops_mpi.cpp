@@ -5,10 +5,15 @@
 #include <cstddef>
 #include <vector>
 
+#include "task/include/task_registry.hpp"
 #include "titaev_m_avg_el_vector/common/include/common.hpp"
 
 namespace titaev_m_avg_el_vector {
 
+namespace {
+const ppc::task::TaskRegistration<TitaevMElemVecsAvgMPI> kRegistration;
+}  // namespace
+
 TitaevMElemVecsAvgMPI::TitaevMElemVecsAvgMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
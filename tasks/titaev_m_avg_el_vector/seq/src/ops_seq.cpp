@@ -1,9 +1,14 @@
 #include "titaev_m_avg_el_vector/seq/include/ops_seq.hpp"
 
+#include "task/include/task_registry.hpp"
 #include "titaev_m_avg_el_vector/common/include/common.hpp"
 
 namespace titaev_m_avg_el_vector {
 
+namespace {
+const ppc::task::TaskRegistration<TitaevMElemVecsAvgSEQ> kRegistration;
+}  // namespace
+
 TitaevMElemVecsAvgSEQ::TitaevMElemVecsAvgSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -6,10 +6,13 @@
 #include <numeric>
 #include <vector>
 
+#include "task/include/task_registry.hpp"
 #include "vector_scalar_product/common/include/common.hpp"
 
 namespace vector_scalar_product {
 namespace {
+const ppc::task::TaskRegistration<VectorScalarProductMpi> kRegistration;
+
 std::vector<int> BuildCounts(int total, int parts) {
   std::vector<int> counts(parts, 0);
   const int base = total / parts;
@@ -2,10 +2,15 @@
 
 #include <numeric>
 
+#include "task/include/task_registry.hpp"
 #include "vector_scalar_product/common/include/common.hpp"
 
 namespace vector_scalar_product {
 
+namespace {
+const ppc::task::TaskRegistration<VectorScalarProductSeq> kRegistration;
+}  // namespace
+
 VectorScalarProductSeq::VectorScalarProductSeq(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
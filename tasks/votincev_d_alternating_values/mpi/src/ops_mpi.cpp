@@ -5,10 +5,15 @@
 #include <algorithm>
 #include <vector>
 
+#include "task/include/task_registry.hpp"
 #include "votincev_d_alternating_values/common/include/common.hpp"
 
 namespace votincev_d_alternating_values {
 
+namespace {
+const ppc::task::TaskRegistration<VotincevDAlternatingValuesMPI> kRegistration;
+}  // namespace
+
 VotincevDAlternatingValuesMPI::VotincevDAlternatingValuesMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -3,10 +3,15 @@
 #include <cstddef>  // для size_t
 #include <vector>
 
+#include "task/include/task_registry.hpp"
 #include "votincev_d_alternating_values/common/include/common.hpp"
 
 namespace votincev_d_alternating_values {
 
+namespace {
+const ppc::task::TaskRegistration<VotincevDAlternatingValuesSEQ> kRegistration;
+}  // namespace
+
 VotincevDAlternatingValuesSEQ::VotincevDAlternatingValuesSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
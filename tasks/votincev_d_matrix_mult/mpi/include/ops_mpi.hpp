@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include "task/include/task.hpp"
@@ -27,10 +28,10 @@ class VotincevDMatrixMultMPI : public BaseTask {
                        std::vector<double> &local_matrix, std::vector<double> &matrix_a);
 
   static void MatrixPartMult(int param_k, int param_n, std::vector<double> &local_matrix,
-                             const std::vector<double> &matrix_b);
+                             std::span<const double> matrix_b);
 
   static std::vector<double> SeqMatrixMult(int param_m, int param_n, int param_k, std::vector<double> &matrix_a,
-                                           std::vector<double> &matrix_b);
+                                           std::span<const double> matrix_b);
 };
 
 }  // namespace votincev_d_matrix_mult
@@ -4,13 +4,20 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <span>
 #include <tuple>
 #include <vector>
 
+#include "dist/include/node_collectives.hpp"
+#include "task/include/task_registry.hpp"
 #include "votincev_d_matrix_mult/common/include/common.hpp"
 
 namespace votincev_d_matrix_mult {
 
+namespace {
+const ppc::task::TaskRegistration<VotincevDMatrixMultMPI> kRegistration;
+}  // namespace
+
 VotincevDMatrixMultMPI::VotincevDMatrixMultMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -58,16 +65,16 @@ bool VotincevDMatrixMultMPI::RunImpl() {
   //  (потому что разедление по строкам)
   process_n = std::min(process_n, m);
 
+  // матрицу B получают все процессы: одна копия на узел, читается на месте
+  const auto shared_b = ppc::dist::BcastShared<double>(std::get<4>(in));
+  const std::span<const double> matrix_b = shared_b.Get();
+
   // "лишние" процессы не работают
   if (proc_rank >= process_n) {
     return true;
   }
 
   std::vector<double> matrix_a;
-  std::vector<double> matrix_b;
-
-  // матрицу B получают все процессы
-  matrix_b = std::get<4>(in);
 
   // матрицу А получит полностью только 0й процесс
   if (proc_rank == 0) {
@@ -210,7 +217,7 @@ void VotincevDMatrixMultMPI::SendData(int k, int proc_rank, int process_n, std::
 // простое последовательное умножение (если кол-во_процессов == 1)
 std::vector<double> VotincevDMatrixMultMPI::SeqMatrixMult(int param_m, int param_n, int param_k,
                                                           std::vector<double> &matrix_a,
-                                                          std::vector<double> &matrix_b) {
+                                                          std::span<const double> matrix_b) {
   std::vector<double> matrix_res;
   matrix_res.assign(static_cast<size_t>(param_m) * static_cast<size_t>(param_n), 0.0);
 
@@ -228,7 +235,7 @@ std::vector<double> VotincevDMatrixMultMPI::SeqMatrixMult(int param_m, int param
 
 // умножение части матрицы A на всю матрицу B
 void VotincevDMatrixMultMPI::MatrixPartMult(int param_k, int param_n, std::vector<double> &local_matrix,
-                                            const std::vector<double> &matrix_b) {
+                                            std::span<const double> matrix_b) {
   size_t str_count = local_matrix.size() / param_k;
 
   std::vector<double> result;
@@ -4,10 +4,15 @@
 #include <tuple>
 #include <vector>
 
+#include "task/include/task_registry.hpp"
 #include "votincev_d_matrix_mult/common/include/common.hpp"
 
 namespace votincev_d_matrix_mult {
 
+namespace {
+const ppc::task::TaskRegistration<VotincevDMatrixMultSEQ> kRegistration;
+}  // namespace
+
 VotincevDMatrixMultSEQ::VotincevDMatrixMultSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
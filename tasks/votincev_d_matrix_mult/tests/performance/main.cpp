@@ -4,6 +4,7 @@
 #include <tuple>
 #include <vector>
 
+#include "performance/include/performance.hpp"
 #include "util/include/perf_test_util.hpp"
 #include "votincev_d_matrix_mult/common/include/common.hpp"
 #include "votincev_d_matrix_mult/mpi/include/ops_mpi.hpp"
@@ -17,6 +18,14 @@ class VotincevDMatrixMultRunPerfTestsProcesses : public ppc::util::BaseRunPerfTe
     return input_data;
   }
 
+  ppc::performance::PerfWork GetWork() final {
+    const auto m = static_cast<double>(std::get<0>(input_data));
+    const auto n = static_cast<double>(std::get<1>(input_data));
+    const auto k = static_cast<double>(std::get<2>(input_data));
+    // Multiply-add per (i, j, k); A and B are read, R is written
+    return {.elements = m * n, .bytes = ((m * k) + (k * n) + (m * n)) * sizeof(double), .flops = 2.0 * m * n * k};
+  }
+
  protected:
   InType input_data;
   OutType expected_res;
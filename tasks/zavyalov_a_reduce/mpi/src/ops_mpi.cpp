@@ -3,100 +3,113 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstring>
+#include <limits>
 #include <memory>
-#include <vector>
 
+#include "task/include/task_registry.hpp"
 #include "zavyalov_a_reduce/common/include/common.hpp"
 
 namespace zavyalov_a_reduce {
 
+namespace {
+const ppc::task::TaskRegistration<ZavyalovAReduceMPI> kRegistration;
+}  // namespace
+
 namespace {  // внутренние helper-ы
 
-template <typename T>
-inline void ApplySum(std::vector<T> &acc, const std::vector<T> &temp, int count) {
-  for (int i = 0; i < count; i++) {
-    acc[i] += temp[i];
-  }
-}
+// Длинные векторы редуцируются сегментами такого размера: пока родитель объединяет один сегмент,
+// дети уже присылают следующий
+constexpr std::size_t kSegmentBytes = static_cast<std::size_t>(64) * 1024;
 
-template <typename T>
-inline void ApplyMin(std::vector<T> &acc, const std::vector<T> &temp, int count) {
-  for (int i = 0; i < count; i++) {
-    acc[i] = std::min(acc[i], temp[i]);
-  }
+int VirtualToRealRank(int v_rank, int root, int world_size) {
+  return (v_rank + root) % world_size;
 }
 
-template <typename T>
-void ReduceBinaryTree(const void *sendbuf, void *recvbuf, int count, int root, MPI_Comm comm, MPI_Datatype type,
-                      void (*apply_op)(std::vector<T> &, const std::vector<T> &, int)) {
+}  // namespace
+
+void ZavyalovAReduceMPI::MyReduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op operation,
+                                  int root, MPI_Comm comm) {
   int world_size = 0;
   int world_rank = 0;
   MPI_Comm_size(comm, &world_size);
   MPI_Comm_rank(comm, &world_rank);
 
-  std::vector<T> acc(count);
-  std::vector<T> tmp(count);
-
-  std::memcpy(acc.data(), sendbuf, sizeof(T) * count);
-
-  for (int offset = 1; offset < world_size; offset <<= 1) {
-    int group_leader = world_rank % (2 * offset);
-
-    if (group_leader == 0) {
-      int src = world_rank + offset;
-      if (src < world_size) {
-        MPI_Recv(tmp.data(), count, type, src, src, comm, MPI_STATUS_IGNORE);
-        apply_op(acc, tmp, count);
-      }
-    } else {
-      MPI_Send(acc.data(), count, type, world_rank - offset, world_rank, comm);
+  MPI_Aint lb = 0;
+  MPI_Aint extent = 0;
+  MPI_Type_get_extent(type, &lb, &extent);
+  const auto elem_bytes = static_cast<std::size_t>(extent);
+
+  // Биномиальное дерево с корнем в root: дети v_rank - это v_rank + mask для mask меньше
+  // младшего единичного бита v_rank, родитель - v_rank без этого бита
+  const int v_rank = (world_rank - root + world_size) % world_size;
+  int parent = -1;
+  int num_children = 0;
+  int mask = 1;
+  for (; mask < world_size; mask <<= 1) {
+    if ((v_rank & mask) != 0) {
+      parent = VirtualToRealRank(v_rank - mask, root, world_size);
       break;
     }
-  }
-
-  if (world_rank == 0) {
-    if (root == 0) {
-      std::memcpy(recvbuf, acc.data(), sizeof(T) * count);
-    } else {
-      MPI_Send(acc.data(), count, type, root, 0, comm);
+    if (v_rank + mask < world_size) {
+      num_children++;
     }
-  } else if (world_rank == root) {
-    MPI_Recv(recvbuf, count, type, 0, 0, comm, MPI_STATUS_IGNORE);
   }
-}
-
-template <typename T>
-void ReduceSumImpl(const void *sendbuf, void *recvbuf, int count, int root, MPI_Comm comm, MPI_Datatype type) {
-  ReduceBinaryTree<T>(sendbuf, recvbuf, count, root, comm, type, ApplySum<T>);
-}
-
-template <typename T>
-void ReduceMinImpl(const void *sendbuf, void *recvbuf, int count, int root, MPI_Comm comm, MPI_Datatype type) {
-  ReduceBinaryTree<T>(sendbuf, recvbuf, count, root, comm, type, ApplyMin<T>);
-}
+  auto children = GetScratch<int>(static_cast<std::size_t>(num_children));
+  for (int child_mask = 1, child = 0; child < num_children; child_mask <<= 1, child++) {
+    children[static_cast<std::size_t>(child)] = VirtualToRealRank(v_rank + child_mask, root, world_size);
+  }
 
-}  // namespace
+  // Аккумулятор: у root - сразу recvbuf, у листьев не нужен (они только отправляют sendbuf)
+  const auto total_bytes = static_cast<std::size_t>(count) * elem_bytes;
+  std::byte *acc = nullptr;
+  if (world_rank == root) {
+    acc = static_cast<std::byte *>(recvbuf);
+  } else if (num_children > 0) {
+    acc = GetScratch<std::byte>(total_bytes).data();
+  }
+  if (acc != nullptr) {
+    std::memcpy(acc, sendbuf, total_bytes);
+  }
+  const auto *result = acc != nullptr ? acc : static_cast<const std::byte *>(sendbuf);
+
+  const int segment = std::clamp(static_cast<int>(kSegmentBytes / std::max<std::size_t>(elem_bytes, 1)), 1, count);
+  const int num_segments = (count + segment - 1) / segment;
+  auto segment_length = [&](int seg) { return std::min(segment, count - (seg * segment)); };
+  const auto slot_bytes = static_cast<std::size_t>(segment) * elem_bytes;
+  auto segment_offset = [&](int seg) { return static_cast<std::size_t>(seg) * slot_bytes; };
+
+  // Два слота приёма на каждого ребёнка: в один принимается следующий сегмент, пока другой объединяется
+  auto incoming = GetScratch<std::byte>(2 * static_cast<std::size_t>(num_children) * slot_bytes);
+  auto recv_requests = GetScratch<MPI_Request>(2 * static_cast<std::size_t>(num_children));
+  auto send_requests = GetScratch<MPI_Request>(parent >= 0 ? static_cast<std::size_t>(num_segments) : 0);
+  auto slot = [&](int seg, int child) {
+    return static_cast<std::size_t>(((seg % 2) * num_children) + child);
+  };
+  auto post_receives = [&](int seg) {
+    for (int child = 0; child < num_children; child++) {
+      MPI_Irecv(incoming.data() + (slot(seg, child) * slot_bytes), segment_length(seg), type,
+                children[static_cast<std::size_t>(child)], 0, comm, &recv_requests[slot(seg, child)]);
+    }
+  };
 
-void ZavyalovAReduceMPI::MyReduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype type, MPI_Op operation,
-                                  int root, MPI_Comm comm) {
-  if (operation == MPI_SUM) {
-    if (type == MPI_INT) {
-      ReduceSumImpl<int>(sendbuf, recvbuf, count, root, comm, MPI_INT);
-    } else if (type == MPI_FLOAT) {
-      ReduceSumImpl<float>(sendbuf, recvbuf, count, root, comm, MPI_FLOAT);
-    } else {
-      ReduceSumImpl<double>(sendbuf, recvbuf, count, root, comm, MPI_DOUBLE);
+  post_receives(0);
+  for (int seg = 0; seg < num_segments; seg++) {
+    if (seg + 1 < num_segments) {
+      post_receives(seg + 1);
     }
-  } else if (operation == MPI_MIN) {
-    if (type == MPI_INT) {
-      ReduceMinImpl<int>(sendbuf, recvbuf, count, root, comm, MPI_INT);
-    } else if (type == MPI_FLOAT) {
-      ReduceMinImpl<float>(sendbuf, recvbuf, count, root, comm, MPI_FLOAT);
-    } else {
-      ReduceMinImpl<double>(sendbuf, recvbuf, count, root, comm, MPI_DOUBLE);
+    for (int child = 0; child < num_children; child++) {
+      MPI_Wait(&recv_requests[slot(seg, child)], MPI_STATUS_IGNORE);
+      MPI_Reduce_local(incoming.data() + (slot(seg, child) * slot_bytes), acc + segment_offset(seg),
+                       segment_length(seg), type, operation);
+    }
+    if (parent >= 0) {
+      MPI_Isend(result + segment_offset(seg), segment_length(seg), type, parent, 0, comm,
+                &send_requests[static_cast<std::size_t>(seg)]);
     }
   }
+  MPI_Waitall(static_cast<int>(send_requests.size()), send_requests.data(), MPI_STATUSES_IGNORE);
 }
 
 ZavyalovAReduceMPI::ZavyalovAReduceMPI(const InType &in) {
@@ -106,23 +119,30 @@ ZavyalovAReduceMPI::ZavyalovAReduceMPI(const InType &in) {
 }
 
 bool ZavyalovAReduceMPI::ValidationImpl() {
-  int rank = 0;
   int world_size = 0;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   MPI_Comm_size(MPI_COMM_WORLD, &world_size);
-  if (rank != 0) {
-    return true;
-  }
 
   bool ok = true;
+  // Подходит любая коммутативная операция, в том числе созданная через MPI_Op_create:
+  // дерево объединяет вклады процессов не в порядке их номеров
   MPI_Op op = std::get<0>(GetInput());
-  ok &= (op == MPI_SUM || op == MPI_MIN);
+  int commutative = 0;
+  ok &= (op != MPI_OP_NULL) && (MPI_Op_commutative(op, &commutative) == MPI_SUCCESS) && (commutative != 0);
 
+  // Любой тип, в том числе производный, если элементы массива лежат подряд с шагом extent
   MPI_Datatype type = std::get<1>(GetInput());
-  ok &= (type == MPI_INT || type == MPI_FLOAT || type == MPI_DOUBLE);
+  ok &= (type != MPI_DATATYPE_NULL);
+  if (ok) {
+    int type_size = 0;
+    MPI_Aint lb = 0;
+    MPI_Aint extent = 0;
+    MPI_Type_size(type, &type_size);
+    MPI_Type_get_extent(type, &lb, &extent);
+    ok &= (type_size > 0) && (lb == 0) && (extent >= type_size);
+  }
 
   size_t sz = std::get<2>(GetInput());
-  ok &= (sz > 0);
+  ok &= (sz > 0) && (sz <= static_cast<size_t>(std::numeric_limits<int>::max()));
 
   auto ptr = std::get<3>(GetInput());
   ok &= (ptr != nullptr);
@@ -160,10 +180,11 @@ bool ZavyalovAReduceMPI::RunImpl() {
   int rank = 0;
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
-  int type_size = 0;
-  MPI_Type_size(type, &type_size);
+  MPI_Aint lb = 0;
+  MPI_Aint extent = 0;
+  MPI_Type_get_extent(type, &lb, &extent);
 
-  auto *raw_output = new char[sz * type_size];
+  auto *raw_output = new char[sz * static_cast<size_t>(extent)];
   std::shared_ptr<void> out_ptr(raw_output, [](void *p) { delete[] static_cast<char *>(p); });
 
   if (rank == root) {
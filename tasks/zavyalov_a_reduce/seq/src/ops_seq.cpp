@@ -2,10 +2,15 @@
 
 #include <cstdlib>
 
+#include "task/include/task_registry.hpp"
 #include "zavyalov_a_reduce/common/include/common.hpp"
 
 namespace zavyalov_a_reduce {
 
+namespace {
+const ppc::task::TaskRegistration<ZavyalovAReduceSEQ> kRegistration;
+}  // namespace
+
 ZavyalovAReduceSEQ::ZavyalovAReduceSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
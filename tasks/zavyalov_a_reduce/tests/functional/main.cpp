@@ -222,7 +222,7 @@ TEST_P(ZavyalovAReduceFuncTests, MatmulFromPic) {
   ExecuteTest(GetParam());
 }
 
-const std::array<TestType, 36> kTestParam = {
+const std::array<TestType, 40> kTestParam = {
     std::make_tuple(MPI_SUM, MPI_INT, 10U, 0),    std::make_tuple(MPI_SUM, MPI_INT, 10U, 1),
     std::make_tuple(MPI_SUM, MPI_INT, 9U, 0),     std::make_tuple(MPI_SUM, MPI_INT, 9U, 1),
     std::make_tuple(MPI_SUM, MPI_FLOAT, 10U, 0),  std::make_tuple(MPI_SUM, MPI_FLOAT, 10U, 1),
@@ -241,6 +241,8 @@ const std::array<TestType, 36> kTestParam = {
     std::make_tuple(MPI_MIN, MPI_FLOAT, 50U, 0),  std::make_tuple(MPI_MIN, MPI_INT, 50U, 0),
     std::make_tuple(MPI_MIN, MPI_DOUBLE, 50U, 0), std::make_tuple(MPI_MIN, MPI_FLOAT, 50U, 1),
     std::make_tuple(MPI_MIN, MPI_INT, 50U, 1),    std::make_tuple(MPI_MIN, MPI_DOUBLE, 50U, 1),
+    std::make_tuple(MPI_SUM, MPI_INT, 100000U, 1), std::make_tuple(MPI_SUM, MPI_DOUBLE, 100000U, 2),
+    std::make_tuple(MPI_MIN, MPI_FLOAT, 100000U, 0), std::make_tuple(MPI_MIN, MPI_DOUBLE, 16385U, 3),
 };
 
 const auto kTestTasksList =
@@ -253,6 +255,124 @@ const auto kPerfTestName = ZavyalovAReduceFuncTests::PrintFuncTestName<ZavyalovA
 
 INSTANTIATE_TEST_SUITE_P(PicMatrixTests, ZavyalovAReduceFuncTests, kGtestValues, kPerfTestName);
 
+OutType RunMpiReduce(MPI_Op operation, MPI_Datatype type, size_t count, const std::shared_ptr<void> &data, int root) {
+  ZavyalovAReduceMPI task(std::make_tuple(operation, type, count, data, root));
+  EXPECT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+  return task.GetOutput();
+}
+
+bool IsMpiInitialized() {
+  int is_mpi_initialized = 0;
+  MPI_Initialized(&is_mpi_initialized);
+  return is_mpi_initialized != 0;
+}
+
+struct ValueWithIndex {
+  double value;
+  int index;
+};
+
+TEST(ZavyalovAReduceUserTypes, MinLocFindsValueAndOwner) {
+  if (!IsMpiInitialized()) {
+    GTEST_SKIP();
+  }
+  int rank = 0;
+  int world_size = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+
+  const size_t count = 20000;
+  auto data =
+      std::shared_ptr<void>(new ValueWithIndex[count], [](void *p) { delete[] static_cast<ValueWithIndex *>(p); });
+  auto *values = static_cast<ValueWithIndex *>(data.get());
+  for (size_t i = 0; i < count; i++) {
+    // The minimum of element i is on rank i % world_size
+    const auto owner = static_cast<int>(i % static_cast<size_t>(world_size));
+    values[i] = {.value = (rank == owner) ? -static_cast<double>(i) : static_cast<double>(rank), .index = rank};
+  }
+
+  auto output = RunMpiReduce(MPI_MINLOC, MPI_DOUBLE_INT, count, data, world_size - 1);
+  const auto *result = static_cast<const ValueWithIndex *>(std::get<0>(output).get());
+  for (size_t i = 0; i < count; i++) {
+    ASSERT_EQ(result[i].value, -static_cast<double>(i));
+    ASSERT_EQ(result[i].index, static_cast<int>(i % static_cast<size_t>(world_size)));
+  }
+}
+
+constexpr int kBins = 8;
+
+void AddHistograms(void *in, void *inout, int *len, MPI_Datatype * /*type*/) {
+  const auto *src = static_cast<const int *>(in);
+  auto *dst = static_cast<int *>(inout);
+  for (int i = 0; i < *len * kBins; i++) {
+    dst[i] += src[i];
+  }
+}
+
+TEST(ZavyalovAReduceUserTypes, UserOpMergesHistograms) {
+  if (!IsMpiInitialized()) {
+    GTEST_SKIP();
+  }
+  int rank = 0;
+  int world_size = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+
+  MPI_Datatype histogram_type = MPI_DATATYPE_NULL;
+  MPI_Type_contiguous(kBins, MPI_INT, &histogram_type);
+  MPI_Type_commit(&histogram_type);
+  MPI_Op add_histograms = MPI_OP_NULL;
+  MPI_Op_create(AddHistograms, 1, &add_histograms);
+
+  // Enough histograms for several segments
+  const size_t count = 5000;
+  auto data = std::shared_ptr<void>(new int[count * kBins], [](void *p) { delete[] static_cast<int *>(p); });
+  auto *bins = static_cast<int *>(data.get());
+  for (size_t i = 0; i < count * kBins; i++) {
+    bins[i] = (static_cast<int>(i % kBins) == rank % kBins) ? 1 : 0;
+  }
+
+  auto output = RunMpiReduce(add_histograms, histogram_type, count, data, 1 % world_size);
+  const auto *result = static_cast<const int *>(std::get<0>(output).get());
+  for (size_t i = 0; i < count * kBins; i++) {
+    const int bin = static_cast<int>(i % kBins);
+    int expected = 0;
+    for (int other = 0; other < world_size; other++) {
+      expected += (other % kBins == bin) ? 1 : 0;
+    }
+    ASSERT_EQ(result[i], expected);
+  }
+
+  MPI_Op_free(&add_histograms);
+  MPI_Type_free(&histogram_type);
+}
+
+void SubtractInts(void *in, void *inout, int *len, MPI_Datatype * /*type*/) {
+  const auto *src = static_cast<const int *>(in);
+  auto *dst = static_cast<int *>(inout);
+  for (int i = 0; i < *len; i++) {
+    dst[i] = src[i] - dst[i];
+  }
+}
+
+TEST(ZavyalovAReduceUserTypes, RejectsNonCommutativeOps) {
+  if (!IsMpiInitialized()) {
+    GTEST_SKIP();
+  }
+  MPI_Op subtract = MPI_OP_NULL;
+  MPI_Op_create(SubtractInts, 0, &subtract);
+  auto data = std::shared_ptr<void>(new int[kBins](), [](void *p) { delete[] static_cast<int *>(p); });
+  ZavyalovAReduceMPI task(std::make_tuple(subtract, MPI_INT, static_cast<size_t>(kBins), data, 0));
+  EXPECT_FALSE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+  MPI_Op_free(&subtract);
+}
+
 }  // namespace
 
 }  // namespace zavyalov_a_reduce
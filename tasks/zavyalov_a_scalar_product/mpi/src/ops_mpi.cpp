@@ -4,10 +4,15 @@
 
 #include <vector>
 
+#include "task/include/task_registry.hpp"
 #include "zavyalov_a_scalar_product/common/include/common.hpp"
 
 namespace zavyalov_a_scalar_product {
 
+namespace {
+const ppc::task::TaskRegistration<ZavyalovAScalarProductMPI> kRegistration;
+}  // namespace
+
 ZavyalovAScalarProductMPI::ZavyalovAScalarProductMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   int rank = 0;
@@ -3,10 +3,15 @@
 #include <cstdlib>
 #include <vector>
 
+#include "task/include/task_registry.hpp"
 #include "zavyalov_a_scalar_product/common/include/common.hpp"
 
 namespace zavyalov_a_scalar_product {
 
+namespace {
+const ppc::task::TaskRegistration<ZavyalovAScalarProductSEQ> kRegistration;
+}  // namespace
+
 ZavyalovAScalarProductSEQ::ZavyalovAScalarProductSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
@@ -9,10 +9,15 @@
 #include <utility>
 #include <vector>
 
+#include "task/include/task_registry.hpp"
 #include "zenin_a_sum_values_by_columns_matrix/common/include/common.hpp"
 
 namespace zenin_a_sum_values_by_columns_matrix {
 
+namespace {
+const ppc::task::TaskRegistration<ZeninASumValuesByColumnsMatrixMPI> kRegistration;
+}  // namespace
+
 ZeninASumValuesByColumnsMatrixMPI::ZeninASumValuesByColumnsMatrixMPI(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;
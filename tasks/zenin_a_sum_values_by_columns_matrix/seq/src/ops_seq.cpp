@@ -4,10 +4,15 @@
 #include <cstddef>
 #include <vector>
 
+#include "task/include/task_registry.hpp"
 #include "zenin_a_sum_values_by_columns_matrix/common/include/common.hpp"
 
 namespace zenin_a_sum_values_by_columns_matrix {
 
+namespace {
+const ppc::task::TaskRegistration<ZeninASumValuesByColumnsMatrixSEQ> kRegistration;
+}  // namespace
+
 ZeninASumValuesByColumnsMatrixSEQ::ZeninASumValuesByColumnsMatrixSEQ(const InType &in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetInput() = in;